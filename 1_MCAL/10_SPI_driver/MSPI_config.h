@@ -0,0 +1,33 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSPI_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MSPI_CONFIG_H_
+#define MSPI_CONFIG_H_
+
+/* DMA requests of each SPI: { RX controller, stream, channel, TX controller, stream, channel }
+ * Options (reference manual request tables):
+ *  SPI1 RX: DMA2 stream 0 or 2, channel 3   TX: DMA2 stream 3 or 5, channel 3
+ *  SPI2 RX: DMA1 stream 3, channel 0        TX: DMA1 stream 4, channel 0
+ *  SPI3 RX: DMA1 stream 0 or 2, channel 0   TX: DMA1 stream 5 or 7, channel 0
+ *  SPI4 RX: DMA2 stream 0 (ch 4) or 3 (ch 5) TX: DMA2 stream 1 (ch 4) or 4 (ch 5)
+ * A stream serves one request at a time (see the map in MDMA_config.h):
+ * SPI3 RX shares DMA1 stream 0 with I2C1 reception, SPI4 RX shares DMA2
+ * stream 3 with SPI1 TX. */
+#define MSPI1_DMA       { MDMA_DMA2, 2, 3, MDMA_DMA2, 3, 3 }
+#define MSPI2_DMA       { MDMA_DMA1, 3, 0, MDMA_DMA1, 4, 0 }
+#define MSPI3_DMA       { MDMA_DMA1, 0, 0, MDMA_DMA1, 7, 0 }
+#define MSPI4_DMA       { MDMA_DMA2, 3, 5, MDMA_DMA2, 4, 5 }
+
+/* Priority of the streams, MDMA_Priority_e. Reception above transmission
+ * so the data register is always read before the next frame lands in it. */
+#define MSPI_RX_DMA_PRIORITY    MDMA_PRIORITY_VERY_HIGH
+#define MSPI_TX_DMA_PRIORITY    MDMA_PRIORITY_HIGH
+
+/* Frame sent by receive-only transactions */
+#define MSPI_FILL_FRAME         0xFFFF
+
+#endif /* MSPI_CONFIG_H_ */
@@ -0,0 +1,146 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSPI_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MSPI_INTERFACE_H_
+#define MSPI_INTERFACE_H_
+
+/*
+ * SPI master over DMA. Every transaction runs both streams: the receive
+ * stream stores the frames read (or drains them into a scratch word for a
+ * transmit-only transaction) and its completion means the last frame has left
+ * the wire, so the chip select is released right then, without polling BSY.
+ *
+ * Transactions of several devices share one queue per SPI. The receive stream
+ * interrupt releases the chip select, applies the next device's clock, mode
+ * and frame size, asserts its chip select and restarts both streams before it
+ * runs the completion callback.
+ *
+ * Pins: SCK, MISO and MOSI with MGPIO_voidSetPinAltFunc (AF5 for SPI1, SPI2
+ * and SPI4, AF6 for SPI3), very high speed. Chip selects are plain outputs
+ * set up by MSPI_u8InitDevice, active low, driven with single BSRR stores.
+ */
+
+typedef enum {
+    MSPI_1 = 0,
+    MSPI_2,
+    MSPI_3,
+    MSPI_4
+} MSPI_Instance_e;
+
+typedef enum {
+    MSPI_MODE_0 = 0,    // CPOL 0, CPHA 0
+    MSPI_MODE_1,        // CPOL 0, CPHA 1
+    MSPI_MODE_2,        // CPOL 1, CPHA 0
+    MSPI_MODE_3         // CPOL 1, CPHA 1
+} MSPI_Mode_e;
+
+typedef enum {
+    MSPI_FRAME_8 = 0,
+    MSPI_FRAME_16
+} MSPI_Frame_e;
+
+typedef enum {
+    MSPI_IDLE = 0,      // never submitted
+    MSPI_QUEUED,        // waiting or on the bus
+    MSPI_DONE,
+    MSPI_FAILED         // DMA bus error, the transfer is cut short
+} MSPI_Status_e;
+
+/* Flags of a transaction */
+#define MSPI_KEEP_CS        (1U << 0)   // leave the chip select asserted for the next transaction of the device
+
+/**
+ * @brief Device on a bus, built by MSPI_u8InitDevice.
+ */
+typedef struct
+{
+    u8  Instance;       /**< MSPI_Instance_e */
+    u8  CsPort;         /**< EN_GpioPortNo_t of the chip select */
+    u16 CsMask;         /**< Chip select pin, as a mask */
+    u16 CR1;            /**< Clock, mode and frame of the device */
+    u8  Frame;          /**< MSPI_Frame_e */
+} MSPI_Device_t;
+
+/**
+ * @brief Transaction object, allocated by the user and only handled through
+ *        the MSPI APIs. Zero-initialize it before its first use, and keep it
+ *        and its buffers alive until it is done.
+ */
+typedef struct MSPI_Transaction_s
+{
+    struct MSPI_Transaction_s *Next;    /**< Next transaction in the queue */
+    const MSPI_Device_t *Device;        /**< Target device */
+    const void  *TxData;                /**< Frames to send, NULL to send MSPI_FILL_FRAME */
+    void        *RxData;                /**< Frames read, NULL for a transmit-only transaction */
+    u16          Count;                 /**< Frames (bytes or half-words) */
+    u8           Flags;                 /**< MSPI_KEEP_CS */
+    volatile u8  Status;                /**< MSPI_Status_e */
+    CallBackFn_t pfHandler;             /**< Completion callback (CALLBACK.h), NULL for none */
+    void        *pvContext;             /**< Context passed to the callback */
+} MSPI_Transaction_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Clocks the SPI as a master with software chip selects and prepares
+ *        its DMA streams.
+ * @param Copy_u8Instance MSPI_Instance_e.
+ * @param Copy_u8IrqGroup NVIC group priority of the receive stream interrupt.
+ * @param Copy_u8IrqSubGroup NVIC subgroup priority.
+ * @return STD_OK, or STD_NOK for an invalid instance or a stream held by
+ *         another driver (see MSPIx_DMA).
+ */
+u8 MSPI_u8Init(u8 Copy_u8Instance, u8 Copy_u8IrqGroup, u8 Copy_u8IrqSubGroup);
+
+/**
+ * @brief Describes a device and drives its chip select high.
+ * @param Copy_pDevice Device object.
+ * @param Copy_u8Instance MSPI_Instance_e of its bus.
+ * @param Copy_u32MaxClock Highest clock of the device in Hz; the clock used is
+ *        the fastest PCLK / 2 to PCLK / 256 not above it (live PCLK).
+ * @param Copy_u8Mode MSPI_Mode_e.
+ * @param Copy_u8Frame MSPI_Frame_e.
+ * @param Copy_u8LsbFirst TRUE to send the least significant bit first.
+ * @param Copy_u8CsPort EN_GpioPortNo_t of the chip select.
+ * @param Copy_u8CsPin EN_GpioPinNo_t of the chip select.
+ * @return STD_OK, or STD_NOK for an invalid instance.
+ */
+u8 MSPI_u8InitDevice(MSPI_Device_t *Copy_pDevice, u8 Copy_u8Instance, u32 Copy_u32MaxClock, u8 Copy_u8Mode,
+                     u8 Copy_u8Frame, u8 Copy_u8LsbFirst, u8 Copy_u8CsPort, u8 Copy_u8CsPin);
+
+/**
+ * @brief Queues a transaction on the bus of its device.
+ * @param Copy_pTransaction Transaction object, not queued.
+ * @param Copy_pDevice Target device.
+ * @param Copy_pvTx Frames to send, NULL to send MSPI_FILL_FRAME.
+ * @param Copy_pvRx Frames read, NULL to drop them.
+ * @param Copy_u16Count Frames, 1 to 65535.
+ * @param Copy_u8Flags MSPI_KEEP_CS or 0.
+ * @param pfHandler Callback run from the DMA interrupt once the chip select
+ *        is released (or kept), NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK for a count of 0 or a transaction already queued.
+ */
+u8 MSPI_u8Submit(MSPI_Transaction_t *Copy_pTransaction, const MSPI_Device_t *Copy_pDevice,
+                 const void *Copy_pvTx, void *Copy_pvRx, u16 Copy_u16Count, u8 Copy_u8Flags,
+                 CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Gets the state of a transaction.
+ * @param Copy_pTransaction Transaction object.
+ * @return MSPI_Status_e.
+ */
+u8 MSPI_u8GetStatus(const MSPI_Transaction_t *Copy_pTransaction);
+
+/**
+ * @brief Checks whether the queue of an SPI is empty.
+ * @param Copy_u8Instance MSPI_Instance_e.
+ * @return TRUE if no transaction is queued, FALSE otherwise.
+ */
+u8 MSPI_u8IsIdle(u8 Copy_u8Instance);
+
+#endif /* MSPI_INTERFACE_H_ */
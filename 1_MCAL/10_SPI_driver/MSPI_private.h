@@ -0,0 +1,65 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSPI_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MSPI_PRIVATE_H_
+#define MSPI_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* CR1 Bit Definitions */
+#define CR1_CPHA            0   // Clock phase
+#define CR1_CPOL            1   // Clock polarity
+#define CR1_MSTR            2   // Master selection
+#define CR1_BR              3   // Baud rate control, 3 bits: PCLK / 2^(BR+1)
+#define CR1_SPE             6   // SPI enable
+#define CR1_LSBFIRST        7   // Frame format
+#define CR1_SSI             8   // Internal slave select
+#define CR1_SSM             9   // Software slave management
+#define CR1_DFF             11  // Data frame format, 1 for 16 bits
+
+#define CR1_BR_MAX          7
+
+/* CR2 Bit Definitions */
+#define CR2_RXDMAEN         0   // Rx buffer DMA enable
+#define CR2_TXDMAEN         1   // Tx buffer DMA enable
+
+/* SR Bit Definitions */
+#define SR_RXNE             0   // Receive buffer not empty
+#define SR_TXE              1   // Transmit buffer empty
+#define SR_OVR              6   // Overrun flag
+#define SR_BSY              7   // Busy flag
+
+#define SPI_INSTANCES       4
+
+/**
+ * @brief DMA requests of one SPI.
+ */
+typedef struct
+{
+    u8 RxController;
+    u8 RxStream;
+    u8 RxChannel;
+    u8 TxController;
+    u8 TxStream;
+    u8 TxChannel;
+} MSPI_DmaRequest_t;
+
+/**
+ * @brief Queue of one SPI.
+ */
+typedef struct
+{
+    MSPI_Transaction_t *Head;       /**< Transaction on the bus (or next to run), oldest first */
+    MSPI_Transaction_t *Tail;       /**< Last queued transaction */
+    u8                  Busy;       /**< TRUE while a transaction is on the bus */
+    u8                  Primed;     /**< TRUE once both streams point to the data register */
+    u8                  Instance;   /**< MSPI_Instance_e */
+    u16                 CR1;        /**< CR1 of the last device, without SPE */
+} MSPI_Queue_t;
+
+#endif /* MSPI_PRIVATE_H_ */
@@ -0,0 +1,372 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSPI_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MRCC_interface.h"
+#include "MGPIO_interface.h"
+#include "NVIC_interface.h"
+#include "MDMA_interface.h"
+
+/****************************************************/
+/* SPI Directives                                   */
+/****************************************************/
+#include "MSPI_interface.h"
+#include "MSPI_config.h"
+#include "MSPI_private.h"
+#include "MSPI_register.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static volatile SPI_t *const Global_pSPI[SPI_INSTANCES] = {SPI1, SPI2, SPI3, SPI4};
+static const MSPI_DmaRequest_t Global_Dma[SPI_INSTANCES] = {MSPI1_DMA, MSPI2_DMA, MSPI3_DMA, MSPI4_DMA};
+
+static MSPI_Queue_t Global_Queues[SPI_INSTANCES];
+
+static const u16 Global_u16Fill = MSPI_FILL_FRAME;  // Source of receive-only transactions
+static u16 Global_u16Sink;                          // Destination of transmit-only transactions
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Get the live clock frequency of the bus of an SPI.
+ */
+static u32 MSPI_u32GetBusClock(u8 Copy_u8Instance)
+{
+    return ((Copy_u8Instance == MSPI_2) || (Copy_u8Instance == MSPI_3)) ? MRCC_u32GetAPB1ClockFreq() : MRCC_u32GetAPB2ClockFreq();
+}
+
+/**
+ * @brief Put the head transaction on the bus.
+ *
+ * The receive stream is enabled before the transmit one, so no frame can be
+ * clocked in before it is ready to be read.
+ */
+static void MSPI_voidStart(MSPI_Queue_t *Copy_pQueue)
+{
+    MSPI_Transaction_t *Local_pTransaction = Copy_pQueue->Head;
+    const MSPI_Device_t *Local_pDevice = Local_pTransaction->Device;
+    volatile SPI_t *Local_pSPI = Global_pSPI[Copy_pQueue->Instance];
+    const MSPI_DmaRequest_t *Local_pDma = &Global_Dma[Copy_pQueue->Instance];
+    u32 Local_u32Rx = (Local_pTransaction->RxData != NULL) ? (u32)Local_pTransaction->RxData : (u32)&Global_u16Sink;
+    u32 Local_u32Tx = (Local_pTransaction->TxData != NULL) ? (u32)Local_pTransaction->TxData : (u32)&Global_u16Fill;
+
+    if (Local_pDevice->CR1 != Copy_pQueue->CR1)
+    {
+        // Clock, mode and frame only change with the SPI disabled
+        Local_pSPI->CR1 = Local_pDevice->CR1;
+        Local_pSPI->CR1 = (u32)Local_pDevice->CR1 | (1UL << CR1_SPE);
+        Copy_pQueue->CR1 = Local_pDevice->CR1;
+    }
+
+    // Drop a stale frame and overrun flag (DR then SR)
+    (void)Local_pSPI->DR;
+    (void)Local_pSPI->SR;
+
+    MDMA_voidSetItemFormat(Local_pDma->RxController, Local_pDma->RxStream, Local_pDevice->Frame,
+                           (Local_pTransaction->RxData != NULL) ? TRUE : FALSE);
+    MDMA_voidSetItemFormat(Local_pDma->TxController, Local_pDma->TxStream, Local_pDevice->Frame,
+                           (Local_pTransaction->TxData != NULL) ? TRUE : FALSE);
+
+    MGPIO_voidSetResetPins((EN_GpioPortNo_t)Local_pDevice->CsPort, 0, Local_pDevice->CsMask);
+    if (Copy_pQueue->Primed == TRUE)
+    {
+        MDMA_voidRestart(Local_pDma->RxController, Local_pDma->RxStream, Local_u32Rx, Local_pTransaction->Count);
+        MDMA_voidRestart(Local_pDma->TxController, Local_pDma->TxStream, Local_u32Tx, Local_pTransaction->Count);
+    }
+    else
+    {
+        MDMA_u8Start(Local_pDma->RxController, Local_pDma->RxStream, (u32)&Local_pSPI->DR, Local_u32Rx, 0, Local_pTransaction->Count);
+        MDMA_u8Start(Local_pDma->TxController, Local_pDma->TxStream, (u32)&Local_pSPI->DR, Local_u32Tx, 0, Local_pTransaction->Count);
+        Copy_pQueue->Primed = TRUE;
+    }
+    Local_pSPI->CR2 = (1UL << CR2_RXDMAEN) | (1UL << CR2_TXDMAEN);
+}
+
+/**
+ * @brief End the head transaction on the bus and remove it from the queue.
+ */
+static MSPI_Transaction_t *MSPI_pEnd(MSPI_Queue_t *Copy_pQueue, u8 Copy_u8KeepCs)
+{
+    MSPI_Transaction_t *Local_pTransaction = Copy_pQueue->Head;
+    const MSPI_Device_t *Local_pDevice = Local_pTransaction->Device;
+
+    Global_pSPI[Copy_pQueue->Instance]->CR2 = 0;
+    if (Copy_u8KeepCs == FALSE)
+    {
+        MGPIO_voidSetResetPins((EN_GpioPortNo_t)Local_pDevice->CsPort, Local_pDevice->CsMask, 0);
+    }
+    Copy_pQueue->Busy = FALSE;
+    Copy_pQueue->Head = Local_pTransaction->Next;
+    if (Copy_pQueue->Head == NULL)
+    {
+        Copy_pQueue->Tail = NULL;
+    }
+    return Local_pTransaction;
+}
+
+/**
+ * @brief Report the result of a transaction removed from the queue.
+ */
+static void MSPI_voidFinish(MSPI_Transaction_t *Copy_pTransaction, u8 Copy_u8Status)
+{
+    Copy_pTransaction->Status = Copy_u8Status;
+    if (Copy_pTransaction->pfHandler != NULL)
+    {
+        Copy_pTransaction->pfHandler(Copy_pTransaction->pvContext);
+    }
+}
+
+/**
+ * @brief Start the head transaction if the bus is free.
+ *        Interrupts must be disabled or the caller must be the stream interrupt.
+ */
+static void MSPI_voidRunQueue(MSPI_Queue_t *Copy_pQueue)
+{
+    if ((Copy_pQueue->Head != NULL) && (Copy_pQueue->Busy == FALSE))
+    {
+        Copy_pQueue->Busy = TRUE;
+        MSPI_voidStart(Copy_pQueue);
+    }
+}
+
+/**
+ * @brief Receive stream complete: the last frame is in, chain the next transaction.
+ */
+static void MSPI_voidOnRxFull(void *pvContext)
+{
+    MSPI_Queue_t *Local_pQueue = (MSPI_Queue_t *)pvContext;
+    MSPI_Transaction_t *Local_pTransaction;
+
+    Local_pTransaction = MSPI_pEnd(Local_pQueue, ((Local_pQueue->Head->Flags & MSPI_KEEP_CS) != 0) ? TRUE : FALSE);
+    MSPI_voidRunQueue(Local_pQueue);
+    MSPI_voidFinish(Local_pTransaction, MSPI_DONE);
+}
+
+/**
+ * @brief Bus error on either stream: stop the transfer, go on with the next.
+ */
+static void MSPI_voidOnError(void *pvContext)
+{
+    MSPI_Queue_t *Local_pQueue = (MSPI_Queue_t *)pvContext;
+    const MSPI_DmaRequest_t *Local_pDma = &Global_Dma[Local_pQueue->Instance];
+    MSPI_Transaction_t *Local_pTransaction;
+
+    if (Local_pQueue->Busy == FALSE)
+    {
+        return;     // the other stream already reported it
+    }
+    MDMA_voidStop(Local_pDma->RxController, Local_pDma->RxStream);
+    MDMA_voidStop(Local_pDma->TxController, Local_pDma->TxStream);
+    Local_pTransaction = MSPI_pEnd(Local_pQueue, FALSE);
+    MSPI_voidRunQueue(Local_pQueue);
+    MSPI_voidFinish(Local_pTransaction, MSPI_FAILED);
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Clock the SPI as a master and prepare its DMA streams.
+ *
+ * @return u8: STD_OK, or STD_NOK for an invalid instance or a stream held by another driver.
+ */
+u8 MSPI_u8Init(u8 Copy_u8Instance, u8 Copy_u8IrqGroup, u8 Copy_u8IrqSubGroup)
+{
+    const MSPI_DmaRequest_t *Local_pDma;
+    MSPI_Queue_t *Local_pQueue;
+    MDMA_StreamConfig_t Local_RxConfig = {
+        .Direction = MDMA_PERIPH_TO_MEM, .Priority = MSPI_RX_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_BYTE, .MemSize = MDMA_SIZE_BYTE, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_DIRECT,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_FULL | MDMA_IT_ERROR
+    };
+    MDMA_StreamConfig_t Local_TxConfig = {
+        .Direction = MDMA_MEM_TO_PERIPH, .Priority = MSPI_TX_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_BYTE, .MemSize = MDMA_SIZE_BYTE, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_DIRECT,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_ERROR
+    };
+
+    if (Copy_u8Instance >= SPI_INSTANCES)
+    {
+        return STD_NOK;
+    }
+    Local_pDma = &Global_Dma[Copy_u8Instance];
+    Local_pQueue = &Global_Queues[Copy_u8Instance];
+
+    switch (Copy_u8Instance)
+    {
+    case MSPI_1:
+        MRCC_voidEnableVendorPerphiral(APB2, APB2_SPI1EN);
+        break;
+    case MSPI_2:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_SPI2EN);
+        break;
+    case MSPI_3:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_SPI3EN);
+        break;
+    default:
+        MRCC_voidEnableVendorPerphiral(APB2, APB2_SPI4EN);
+        break;
+    }
+
+    // Master, chip selects in software: SSI holds the internal NSS high
+    Global_pSPI[Copy_u8Instance]->CR2 = 0;
+    Global_pSPI[Copy_u8Instance]->CR1 = (1UL << CR1_MSTR) | (1UL << CR1_SSM) | (1UL << CR1_SSI);
+
+    Local_pQueue->Head = NULL;
+    Local_pQueue->Tail = NULL;
+    Local_pQueue->Busy = FALSE;
+    Local_pQueue->Instance = Copy_u8Instance;
+    Local_pQueue->CR1 = 0;
+    Local_pQueue->Primed = FALSE;
+
+    Local_RxConfig.Channel = Local_pDma->RxChannel;
+    Local_RxConfig.IrqGroup = Copy_u8IrqGroup;
+    Local_RxConfig.IrqSubGroup = Copy_u8IrqSubGroup;
+    Local_TxConfig.Channel = Local_pDma->TxChannel;
+    Local_TxConfig.IrqGroup = Copy_u8IrqGroup;
+    Local_TxConfig.IrqSubGroup = Copy_u8IrqSubGroup;
+    Local_RxConfig.Owner = Local_pQueue;
+    Local_TxConfig.Owner = Local_pQueue;
+    if (MDMA_u8Init(Local_pDma->RxController, Local_pDma->RxStream, &Local_RxConfig) == STD_NOK)
+    {
+        return STD_NOK;
+    }
+    if (MDMA_u8Init(Local_pDma->TxController, Local_pDma->TxStream, &Local_TxConfig) == STD_NOK)
+    {
+        MDMA_voidRelease(Local_pDma->RxController, Local_pDma->RxStream);
+        return STD_NOK;
+    }
+    MDMA_voidSetCallback(Local_pDma->RxController, Local_pDma->RxStream, MDMA_EVENT_FULL, MSPI_voidOnRxFull, Local_pQueue);
+    MDMA_voidSetCallback(Local_pDma->RxController, Local_pDma->RxStream, MDMA_EVENT_ERROR, MSPI_voidOnError, Local_pQueue);
+    MDMA_voidSetCallback(Local_pDma->TxController, Local_pDma->TxStream, MDMA_EVENT_ERROR, MSPI_voidOnError, Local_pQueue);
+    return STD_OK;
+}
+
+/**
+ * @brief Describe a device and drive its chip select high.
+ *
+ * @return u8: STD_OK, or STD_NOK for an invalid instance.
+ */
+u8 MSPI_u8InitDevice(MSPI_Device_t *Copy_pDevice, u8 Copy_u8Instance, u32 Copy_u32MaxClock, u8 Copy_u8Mode,
+                     u8 Copy_u8Frame, u8 Copy_u8LsbFirst, u8 Copy_u8CsPort, u8 Copy_u8CsPin)
+{
+    u32 Local_u32Clock;
+    u32 Local_u32CR1 = (1UL << CR1_MSTR) | (1UL << CR1_SSM) | (1UL << CR1_SSI);
+    u8 Local_u8BR = 0;
+
+    if (Copy_u8Instance >= SPI_INSTANCES)
+    {
+        return STD_NOK;
+    }
+
+    // Fastest divider, from PCLK / 2, that keeps the clock within the device limit
+    Local_u32Clock = MSPI_u32GetBusClock(Copy_u8Instance);
+    while ((Local_u8BR < CR1_BR_MAX) && ((Local_u32Clock >> (Local_u8BR + 1)) > Copy_u32MaxClock))
+    {
+        Local_u8BR++;
+    }
+    Local_u32CR1 |= ((u32)Local_u8BR << CR1_BR) | ((u32)Copy_u8Mode & 3UL);
+    if (Copy_u8Frame == MSPI_FRAME_16)
+    {
+        SET_BIT(Local_u32CR1, CR1_DFF);
+    }
+    if (Copy_u8LsbFirst == TRUE)
+    {
+        SET_BIT(Local_u32CR1, CR1_LSBFIRST);
+    }
+
+    Copy_pDevice->Instance = Copy_u8Instance;
+    Copy_pDevice->CsPort = Copy_u8CsPort;
+    Copy_pDevice->CsMask = (u16)(1U << Copy_u8CsPin);
+    Copy_pDevice->CR1 = (u16)Local_u32CR1;
+    Copy_pDevice->Frame = Copy_u8Frame;
+
+    MGPIO_voidSetResetPins((EN_GpioPortNo_t)Copy_u8CsPort, Copy_pDevice->CsMask, 0);
+    MGPIO_voidSetPinOutput((EN_GpioPortNo_t)Copy_u8CsPort, (EN_GpioPinNo_t)Copy_u8CsPin, GPIO_OTYPE_PUSH_PULL, GPIO_OSPEED_VERY_HIGH);
+    return STD_OK;
+}
+
+/**
+ * @brief Queue a transaction on the bus of its device.
+ *
+ * @return u8: STD_OK, or STD_NOK for a count of 0 or a transaction already queued.
+ */
+u8 MSPI_u8Submit(MSPI_Transaction_t *Copy_pTransaction, const MSPI_Device_t *Copy_pDevice,
+                 const void *Copy_pvTx, void *Copy_pvRx, u16 Copy_u16Count, u8 Copy_u8Flags,
+                 CallBackFn_t pfHandler, void *pvContext)
+{
+    MSPI_Queue_t *Local_pQueue;
+    u32 Local_u32State;
+
+    if (Copy_u16Count == 0)
+    {
+        return STD_NOK;
+    }
+    Local_pQueue = &Global_Queues[Copy_pDevice->Instance];
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Copy_pTransaction->Status == MSPI_QUEUED)
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Copy_pTransaction->Next = NULL;
+    Copy_pTransaction->Device = Copy_pDevice;
+    Copy_pTransaction->TxData = Copy_pvTx;
+    Copy_pTransaction->RxData = Copy_pvRx;
+    Copy_pTransaction->Count = Copy_u16Count;
+    Copy_pTransaction->Flags = Copy_u8Flags;
+    Copy_pTransaction->Status = MSPI_QUEUED;
+    Copy_pTransaction->pfHandler = pfHandler;
+    Copy_pTransaction->pvContext = pvContext;
+
+    if (Local_pQueue->Tail != NULL)
+    {
+        Local_pQueue->Tail->Next = Copy_pTransaction;
+    }
+    else
+    {
+        Local_pQueue->Head = Copy_pTransaction;
+    }
+    Local_pQueue->Tail = Copy_pTransaction;
+    MSPI_voidRunQueue(Local_pQueue);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return STD_OK;
+}
+
+/**
+ * @brief Get the state of a transaction.
+ */
+u8 MSPI_u8GetStatus(const MSPI_Transaction_t *Copy_pTransaction)
+{
+    return Copy_pTransaction->Status;
+}
+
+/**
+ * @brief Check whether the queue of an SPI is empty.
+ */
+u8 MSPI_u8IsIdle(u8 Copy_u8Instance)
+{
+    return (Global_Queues[Copy_u8Instance].Head == NULL) ? TRUE : FALSE;
+}
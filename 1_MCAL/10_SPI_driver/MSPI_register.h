@@ -0,0 +1,38 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSPI_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MSPI_REGISTER_H_
+#define MSPI_REGISTER_H_
+
+/* Base addresses of the SPIs (SPI1 and SPI4 on APB2, SPI2 and SPI3 on APB1) */
+#define SPI1_BASE_ADDRESS       0x40013000
+#define SPI2_BASE_ADDRESS       0x40003800
+#define SPI3_BASE_ADDRESS       0x40003C00
+#define SPI4_BASE_ADDRESS       0x40013400
+
+/**
+ * @brief Structure representing the SPI registers.
+ */
+typedef struct
+{
+    u32 CR1;        /**< Control Register 1 */
+    u32 CR2;        /**< Control Register 2 */
+    u32 SR;         /**< Status Register */
+    u32 DR;         /**< Data Register */
+    u32 CRCPR;      /**< CRC Polynomial Register */
+    u32 RXCRCR;     /**< RX CRC Register */
+    u32 TXCRCR;     /**< TX CRC Register */
+    u32 I2SCFGR;    /**< I2S Configuration Register */
+    u32 I2SPR;      /**< I2S Prescaler Register */
+} SPI_t;
+
+#define SPI1        ((volatile SPI_t*)SPI1_BASE_ADDRESS)
+#define SPI2        ((volatile SPI_t*)SPI2_BASE_ADDRESS)
+#define SPI3        ((volatile SPI_t*)SPI3_BASE_ADDRESS)
+#define SPI4        ((volatile SPI_t*)SPI4_BASE_ADDRESS)
+
+#endif /* MSPI_REGISTER_H_ */
@@ -0,0 +1,48 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MI2C_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MI2C_CONFIG_H_
+#define MI2C_CONFIG_H_
+
+/* Interrupt handlers (event and error) defined by the driver, per I2C.
+ * Disable an I2C whose handlers are written elsewhere.
+ * Options: ENABLE or DISABLE */
+#define MI2C1_HANDLER           ENABLE
+#define MI2C2_HANDLER           ENABLE
+#define MI2C3_HANDLER           ENABLE
+
+/* Reads of MI2C_DMA_THRESHOLD bytes or more go through a DMA stream, shorter
+ * ones byte by byte from the event interrupt.
+ * Options: ENABLE or DISABLE */
+#define MI2C_RX_DMA             ENABLE
+#define MI2C_DMA_THRESHOLD      8
+
+/* Receive DMA request of each I2C: { controller, stream, channel }
+ * Options (reference manual request tables):
+ *  I2C1: DMA1 stream 0 or 5, channel 1
+ *  I2C2: DMA1 stream 2 or 3, channel 7
+ *  I2C3: DMA1 stream 1, channel 1 or stream 2, channel 3
+ * I2C2 on stream 3 would exclude SPI2 reception, whose only stream it is.
+ * I2C1 on stream 0 excludes SPI3 reception, on stream 5 USART2 reception:
+ * MI2C_u8Init fails while the other driver holds the stream. */
+#define MI2C1_RX_DMA            { MDMA_DMA1, 0, 1 }
+#define MI2C2_RX_DMA            { MDMA_DMA1, 2, 7 }
+#define MI2C3_RX_DMA            { MDMA_DMA1, 1, 1 }
+
+/* Priority of the reception streams, MDMA_Priority_e */
+#define MI2C_RX_DMA_PRIORITY    MDMA_PRIORITY_HIGH
+
+/* A transaction still on the bus after this many calls of MI2C_voidTick is
+ * aborted and the bus recovered. Keep it above the longest transaction
+ * (e.g. 10 ticks of 1 ms: a 400 byte read at 400 kHz). */
+#define MI2C_TIMEOUT_TICKS      10
+
+/* Half period of the clock pulses of the bus recovery, in microseconds
+ * (5: 100 kHz, within reach of every device). */
+#define MI2C_RECOVERY_HALF_PERIOD_US    5
+
+#endif /* MI2C_CONFIG_H_ */
@@ -0,0 +1,165 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MI2C_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MI2C_INTERFACE_H_
+#define MI2C_INTERFACE_H_
+
+/*
+ * I2C master run by its event and error interrupts. A transaction writes
+ * bytes, reads bytes, or writes then reads after a repeated start (register
+ * reads); the CPU only runs for the start, address and byte events, and long
+ * reads go through a DMA stream (MI2C_RX_DMA).
+ *
+ * Transactions share one queue per bus: the interrupt that ends one starts
+ * the next before running the completion callback, so a round of sensor
+ * reads runs unattended and the callbacks can queue the next round.
+ *
+ * A device holding the data line low (reset in the middle of a read) is
+ * freed by the bus recovery: up to 9 clock pulses by hand, a stop condition,
+ * then a software reset of the I2C. It runs at initialization, after a bus
+ * error or a lost arbitration, and when MI2C_voidTick finds a transaction
+ * stuck. It uses MDWT_voidDelayUs: call MDWT_voidInit first.
+ *
+ * Pins are given in MI2C_Config_t and set by MI2C_u8Init (open drain, external
+ * pull-ups): SCL on AF4, SDA on AF4 or AF9 depending on the pin.
+ */
+
+typedef enum {
+    MI2C_1 = 0,
+    MI2C_2,
+    MI2C_3
+} MI2C_Instance_e;
+
+typedef enum {
+    MI2C_IDLE = 0,      // never submitted
+    MI2C_QUEUED,        // waiting or on the bus
+    MI2C_DONE,
+    MI2C_NACK,          // the device did not acknowledge its address or a byte
+    MI2C_FAILED         // bus error, lost arbitration or timeout, the bus was recovered
+} MI2C_Status_e;
+
+/**
+ * @brief Bus configuration.
+ */
+typedef struct
+{
+    u32 Speed;          /**< SCL frequency in Hz, up to 100000 (standard) or 400000 (fast) */
+    u8  SclPort;        /**< EN_GpioPortNo_t of SCL */
+    u8  SclPin;         /**< EN_GpioPinNo_t of SCL, alternate function 4 */
+    u8  SdaPort;        /**< EN_GpioPortNo_t of SDA */
+    u8  SdaPin;         /**< EN_GpioPinNo_t of SDA */
+    u8  SdaAltFunc;     /**< EN_GpioAltFunc_t of SDA: GPIO_AF04, or GPIO_AF09 (I2C2 on PB3, I2C3 on PB4 and PB8) */
+    u8  IrqGroup;       /**< NVIC group priority of the I2C and DMA interrupts */
+    u8  IrqSubGroup;    /**< NVIC subgroup priority */
+} MI2C_Config_t;
+
+/**
+ * @brief Transaction object, allocated by the user and only handled through
+ *        the MI2C APIs. Zero-initialize it before its first use, and keep it
+ *        and its buffers alive until it is done.
+ */
+typedef struct MI2C_Transaction_s
+{
+    struct MI2C_Transaction_s *Next;    /**< Next transaction in the queue */
+    const u8    *TxData;                /**< Bytes to write */
+    u8          *RxData;                /**< Bytes read */
+    u16          TxLength;              /**< Bytes to write, 0 for a plain read */
+    u16          RxLength;              /**< Bytes to read, 0 for a plain write */
+    u8           Address;               /**< 7-bit device address */
+    u8           Register;              /**< Register written by MI2C_u8ReadRegister */
+    volatile u8  Status;                /**< MI2C_Status_e */
+    CallBackFn_t pfHandler;             /**< Completion callback (CALLBACK.h), NULL for none */
+    void        *pvContext;             /**< Context passed to the callback */
+} MI2C_Transaction_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Clocks the I2C, sets its pins, recovers the bus if a device holds
+ *        it and programs the timing from the live PCLK1 (read back from RCC).
+ *        Call it again after changing the bus clock.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ * @param Copy_pConfig Bus configuration, copied.
+ * @return STD_OK, or STD_NOK for an invalid instance, a speed out of reach of
+ *         PCLK1 (2 MHz at least, 4 MHz for fast mode), a reception stream held
+ *         by another driver (see MI2Cx_RX_DMA) or a bus still held low.
+ */
+u8 MI2C_u8Init(u8 Copy_u8Instance, const MI2C_Config_t *Copy_pConfig);
+
+/**
+ * @brief Queues a transaction: writes the Tx bytes, then reads the Rx bytes
+ *        after a repeated start. A transaction without bytes only checks that
+ *        the device acknowledges its address.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ * @param Copy_pTransaction Transaction object, not queued.
+ * @param Copy_u8Address 7-bit device address.
+ * @param Copy_pu8Tx Bytes to write.
+ * @param Copy_u16TxLength Bytes to write, 0 to only read.
+ * @param Copy_pu8Rx Bytes read.
+ * @param Copy_u16RxLength Bytes to read, 0 to only write.
+ * @param pfHandler Callback run from the interrupt once the stop condition is
+ *        requested, NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK for an invalid instance, address or buffer, or a
+ *         transaction already queued.
+ */
+u8 MI2C_u8Submit(u8 Copy_u8Instance, MI2C_Transaction_t *Copy_pTransaction, u8 Copy_u8Address,
+                 const u8 *Copy_pu8Tx, u16 Copy_u16TxLength, u8 *Copy_pu8Rx, u16 Copy_u16RxLength,
+                 CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Queues a register read: writes the register number, then reads
+ *        after a repeated start. The register number is kept in the transaction.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ * @param Copy_pTransaction Transaction object, not queued.
+ * @param Copy_u8Address 7-bit device address.
+ * @param Copy_u8Register First register to read.
+ * @param Copy_pu8Rx Bytes read.
+ * @param Copy_u16RxLength Bytes to read, at least 1.
+ * @param pfHandler Completion callback, NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK as MI2C_u8Submit.
+ */
+u8 MI2C_u8ReadRegister(u8 Copy_u8Instance, MI2C_Transaction_t *Copy_pTransaction, u8 Copy_u8Address,
+                       u8 Copy_u8Register, u8 *Copy_pu8Rx, u16 Copy_u16RxLength,
+                       CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Gets the state of a transaction.
+ * @param Copy_pTransaction Transaction object.
+ * @return MI2C_Status_e.
+ */
+u8 MI2C_u8GetStatus(const MI2C_Transaction_t *Copy_pTransaction);
+
+/**
+ * @brief Checks whether the queue of an I2C is empty.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ * @return TRUE if no transaction is queued, FALSE otherwise.
+ */
+u8 MI2C_u8IsIdle(u8 Copy_u8Instance);
+
+/**
+ * @brief Counts the age of the transaction on the bus and aborts it after
+ *        MI2C_TIMEOUT_TICKS, recovering the bus. It also recovers the bus
+ *        after a bus error or a lost arbitration: the interrupt only masks
+ *        the bus and the transaction ends FAILED from the next tick. Call it
+ *        periodically, for example every millisecond from a SysTick callback.
+ *        The recovery runs with only this bus's interrupts masked.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ */
+void MI2C_voidTick(u8 Copy_u8Instance);
+
+/**
+ * @brief Recovers the bus by hand (see above), when no transaction runs.
+ *        Transactions submitted meanwhile wait for it.
+ * @param Copy_u8Instance MI2C_Instance_e.
+ * @return STD_OK if the data line is released, STD_NOK if it is still held
+ *         low or a transaction runs.
+ */
+u8 MI2C_u8RecoverBus(u8 Copy_u8Instance);
+
+#endif /* MI2C_INTERFACE_H_ */
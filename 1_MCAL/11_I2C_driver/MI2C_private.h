@@ -0,0 +1,110 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MI2C_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MI2C_PRIVATE_H_
+#define MI2C_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* CR1 Bit Definitions */
+#define CR1_PE              0   // Peripheral enable
+#define CR1_START           8   // Start generation
+#define CR1_STOP            9   // Stop generation
+#define CR1_ACK             10  // Acknowledge the next byte received
+#define CR1_POS             11  // Acknowledge applies to the byte after the next one
+#define CR1_SWRST           15  // Software reset
+
+/* CR2 Bit Definitions */
+#define CR2_FREQ            0   // Peripheral clock in MHz, 6 bits
+#define CR2_ITERREN         8   // Error interrupt enable
+#define CR2_ITEVTEN         9   // Event interrupt enable
+#define CR2_ITBUFEN         10  // Buffer (TXE, RXNE) interrupt enable
+#define CR2_DMAEN           11  // DMA requests enable
+#define CR2_LAST            12  // Next DMA end of transfer is the last transfer (NACK)
+
+/* SR1 Bit Definitions */
+#define SR1_SB              0   // Start condition sent
+#define SR1_ADDR            1   // Address sent and acknowledged
+#define SR1_BTF             2   // Byte transfer finished
+#define SR1_RXNE            6   // Data register not empty
+#define SR1_TXE             7   // Data register empty
+#define SR1_BERR            8   // Misplaced start or stop condition
+#define SR1_ARLO            9   // Arbitration lost
+#define SR1_AF              10  // Acknowledge failure
+#define SR1_OVR             11  // Overrun or underrun
+#define SR1_TIMEOUT         14  // SCL held low too long (SMBus)
+
+#define SR1_ERRORS          ((1UL << SR1_BERR) | (1UL << SR1_ARLO) | (1UL << SR1_AF) | (1UL << SR1_OVR) | (1UL << SR1_TIMEOUT))
+
+/* CCR Bit Definitions */
+#define CCR_FS              15  // Fast mode
+#define CCR_MAX             0xFFFUL
+#define CCR_MIN_STANDARD    4UL
+
+/* CR2 FREQ limits, in MHz */
+#define FREQ_MIN_STANDARD   2UL
+#define FREQ_MIN_FAST       4UL
+#define FREQ_MAX            50UL
+
+#define MI2C_STANDARD_SPEED 100000UL
+#define MI2C_FAST_SPEED     400000UL
+
+/* Clock pulses sent at most to free a data line held low by a device */
+#define MI2C_RECOVERY_PULSES    9
+
+/* Polls of CR1 at most while the previous stop condition is generated
+ * (a few microseconds) */
+#define MI2C_STOP_WAIT      2000UL
+
+#define I2C_INSTANCES       3
+
+/* Event and error interrupt lines of I2C1, I2C2 and I2C3 */
+#define I2C_EV_IRQ_NUMBERS  {31, 33, 72}
+#define I2C_ER_IRQ_NUMBERS  {32, 34, 73}
+
+typedef enum {
+    MI2C_PHASE_WRITE = 0,   // start, address with write, bytes written
+    MI2C_PHASE_RESTART,     // repeated start requested, waiting for it
+    MI2C_PHASE_READ         // address with read, bytes read
+} MI2C_Phase_e;
+
+typedef enum {
+    MI2C_RECOVERY_NONE = 0, // transactions aged by MI2C_voidTick
+    MI2C_RECOVERY_PENDING,  // bus error seen by an interrupt, the next tick recovers
+    MI2C_RECOVERY_RUNNING   // recovery in progress, not aged
+} MI2C_Recovery_e;
+
+/**
+ * @brief DMA request of an I2C.
+ */
+typedef struct
+{
+    u8 Controller;
+    u8 Stream;
+    u8 Channel;
+} MI2C_DmaRequest_t;
+
+/**
+ * @brief State of one bus.
+ */
+typedef struct
+{
+    MI2C_Transaction_t *Head;       /**< Transaction on the bus (or next to run), oldest first */
+    MI2C_Transaction_t *Tail;       /**< Last queued transaction */
+    u16                 Index;      /**< Bytes written or read in the current phase */
+    u16                 Ticks;      /**< Ticks since the head transaction started */
+    u8                  Busy;       /**< TRUE while a transaction is on the bus */
+    u8                  Phase;      /**< MI2C_Phase_e */
+    u8                  Dma;        /**< TRUE while the DMA stream reads */
+    u8                  Primed;     /**< TRUE once the stream points to the data register */
+    u8                  Recovery;   /**< MI2C_Recovery_e */
+    u8                  Instance;   /**< MI2C_Instance_e */
+    MI2C_Config_t       Config;     /**< Speed and pins, kept for the bus recovery */
+} MI2C_Bus_t;
+
+#endif /* MI2C_PRIVATE_H_ */
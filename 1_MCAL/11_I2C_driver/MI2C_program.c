@@ -0,0 +1,839 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MI2C_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MRCC_interface.h"
+#include "MGPIO_interface.h"
+#include "NVIC_interface.h"
+#include "MDMA_interface.h"
+#include "MDWT_interface.h"
+
+/****************************************************/
+/* I2C Directives                                   */
+/****************************************************/
+#include "MI2C_interface.h"
+#include "MI2C_config.h"
+#include "MI2C_private.h"
+#include "MI2C_register.h"
+
+#if (MI2C_RX_DMA == ENABLE) && (MI2C_DMA_THRESHOLD < 2)
+#error "MI2C_DMA_THRESHOLD must be 2 or more: the DMA cannot NACK a single byte"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static volatile I2C_t *const Global_pI2C[I2C_INSTANCES] = {I2C1, I2C2, I2C3};
+static const u8 Global_u8EvIrqNumbers[I2C_INSTANCES] = I2C_EV_IRQ_NUMBERS;
+static const u8 Global_u8ErIrqNumbers[I2C_INSTANCES] = I2C_ER_IRQ_NUMBERS;
+static const MI2C_DmaRequest_t Global_RxDma[I2C_INSTANCES] = {MI2C1_RX_DMA, MI2C2_RX_DMA, MI2C3_RX_DMA};
+
+static MI2C_Bus_t Global_Buses[I2C_INSTANCES];
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Program the timing from the live PCLK1 and enable the I2C.
+ *
+ * Standard mode: SCL high and low both last CCR periods of PCLK1.
+ * Fast mode: low is twice high, CCR = PCLK1 / (3 * speed), rounded up so the
+ * clock never exceeds the speed asked. TRISE holds the largest rise time in
+ * PCLK1 periods plus one: 1000 ns in standard mode, 300 ns in fast mode.
+ *
+ * @return u8: STD_OK, or STD_NOK if the speed is out of reach of PCLK1.
+ */
+static u8 MI2C_u8Configure(MI2C_Bus_t *Copy_pBus)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    u32 Local_u32Clock = MRCC_u32GetAPB1ClockFreq();
+    u32 Local_u32Speed = Copy_pBus->Config.Speed;
+    u32 Local_u32Freq = Local_u32Clock / 1000000UL;
+    u32 Local_u32CCR;
+    u32 Local_u32Trise;
+
+    Local_pI2C->CR1 = 0;
+    if ((Local_u32Speed == 0) || (Local_u32Speed > MI2C_FAST_SPEED) || (Local_u32Freq > FREQ_MAX)
+        || (Local_u32Freq < ((Local_u32Speed > MI2C_STANDARD_SPEED) ? FREQ_MIN_FAST : FREQ_MIN_STANDARD)))
+    {
+        return STD_NOK;
+    }
+
+    if (Local_u32Speed <= MI2C_STANDARD_SPEED)
+    {
+        Local_u32CCR = (Local_u32Clock + (2 * Local_u32Speed) - 1) / (2 * Local_u32Speed);
+        if (Local_u32CCR < CCR_MIN_STANDARD)
+        {
+            Local_u32CCR = CCR_MIN_STANDARD;
+        }
+        Local_u32Trise = Local_u32Freq + 1;
+    }
+    else
+    {
+        Local_u32CCR = (Local_u32Clock + (3 * Local_u32Speed) - 1) / (3 * Local_u32Speed);
+        Local_u32Trise = ((Local_u32Freq * 300UL) / 1000UL) + 1;
+    }
+    if (Local_u32CCR > CCR_MAX)
+    {
+        return STD_NOK;
+    }
+    if (Local_u32Speed > MI2C_STANDARD_SPEED)
+    {
+        SET_BIT(Local_u32CCR, CCR_FS);
+    }
+
+    Local_pI2C->CR2 = (Local_u32Freq << CR2_FREQ) | (1UL << CR2_ITEVTEN) | (1UL << CR2_ITERREN);
+    Local_pI2C->CCR = Local_u32CCR;
+    Local_pI2C->TRISE = Local_u32Trise;
+    Local_pI2C->CR1 = (1UL << CR1_PE);
+    return STD_OK;
+}
+
+/**
+ * @brief Free the bus by hand, then reset and reconfigure the I2C.
+ *
+ * A device interrupted in the middle of a read keeps driving SDA low until
+ * it has shifted its byte out: clock it out (up to 9 pulses), then send a
+ * stop condition so every device returns to idle. The I2C itself may still
+ * believe the bus busy, hence the software reset.
+ *
+ * @return u8: STD_OK, or STD_NOK if SDA is still low or the timing is out of reach.
+ */
+static u8 MI2C_u8Recover(MI2C_Bus_t *Copy_pBus)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    const MI2C_Config_t *Local_pConfig = &Copy_pBus->Config;
+    EN_GpioPortNo_t Local_SclPort = (EN_GpioPortNo_t)Local_pConfig->SclPort;
+    EN_GpioPinNo_t Local_SclPin = (EN_GpioPinNo_t)Local_pConfig->SclPin;
+    EN_GpioPortNo_t Local_SdaPort = (EN_GpioPortNo_t)Local_pConfig->SdaPort;
+    EN_GpioPinNo_t Local_SdaPin = (EN_GpioPinNo_t)Local_pConfig->SdaPin;
+    EN_GpioVoltLevel_t Local_Level;
+    u8 Local_u8Pulse;
+    u8 Local_u8Result;
+
+    // Take the pins back from the I2C, both released (open drain high)
+    Local_pI2C->CR1 = 0;
+    MGPIO_voidSetPinValue(Local_SclPort, Local_SclPin, GPIO_VOLT_LEVEL_HIGH);
+    MGPIO_voidSetPinValue(Local_SdaPort, Local_SdaPin, GPIO_VOLT_LEVEL_HIGH);
+    MGPIO_voidSetPinMode(Local_SclPort, Local_SclPin, GPIO_MODE_OUTPUT);
+    MGPIO_voidSetPinMode(Local_SdaPort, Local_SdaPin, GPIO_MODE_OUTPUT);
+    MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+
+    MGPIO_voidGetPinValue(Local_SdaPort, Local_SdaPin, &Local_Level);
+    for (Local_u8Pulse = 0; (Local_u8Pulse < MI2C_RECOVERY_PULSES) && (Local_Level == GPIO_VOLT_LEVEL_LOW); Local_u8Pulse++)
+    {
+        MGPIO_voidSetPinValue(Local_SclPort, Local_SclPin, GPIO_VOLT_LEVEL_LOW);
+        MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+        MGPIO_voidSetPinValue(Local_SclPort, Local_SclPin, GPIO_VOLT_LEVEL_HIGH);
+        MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+        MGPIO_voidGetPinValue(Local_SdaPort, Local_SdaPin, &Local_Level);
+    }
+
+    // Stop condition: SDA rises while SCL is high
+    MGPIO_voidSetPinValue(Local_SclPort, Local_SclPin, GPIO_VOLT_LEVEL_LOW);
+    MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+    MGPIO_voidSetPinValue(Local_SdaPort, Local_SdaPin, GPIO_VOLT_LEVEL_LOW);
+    MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+    MGPIO_voidSetPinValue(Local_SclPort, Local_SclPin, GPIO_VOLT_LEVEL_HIGH);
+    MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+    MGPIO_voidSetPinValue(Local_SdaPort, Local_SdaPin, GPIO_VOLT_LEVEL_HIGH);
+    MDWT_voidDelayUs(MI2C_RECOVERY_HALF_PERIOD_US);
+    MGPIO_voidGetPinValue(Local_SdaPort, Local_SdaPin, &Local_Level);
+
+    MGPIO_voidSetPinAltFunc(Local_SclPort, Local_SclPin, GPIO_AF04);
+    MGPIO_voidSetPinAltFunc(Local_SdaPort, Local_SdaPin, (EN_GpioAltFunc_t)Local_pConfig->SdaAltFunc);
+    Local_pI2C->CR1 = (1UL << CR1_SWRST);
+    Local_pI2C->CR1 = 0;
+    Local_u8Result = MI2C_u8Configure(Copy_pBus);
+
+    return ((Local_Level == GPIO_VOLT_LEVEL_HIGH) && (Local_u8Result == STD_OK)) ? STD_OK : STD_NOK;
+}
+
+/**
+ * @brief Put the head transaction on the bus: request the start condition.
+ *
+ * CR1 must not be written while the stop condition of the previous
+ * transaction is pending, it could be requested twice: wait for it first,
+ * a few microseconds at most.
+ */
+static void MI2C_voidStart(MI2C_Bus_t *Copy_pBus)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    MI2C_Transaction_t *Local_pTransaction = Copy_pBus->Head;
+    u32 Local_u32Wait = MI2C_STOP_WAIT;
+
+    while ((GET_BIT(Local_pI2C->CR1, CR1_STOP) != 0) && (Local_u32Wait != 0))
+    {
+        Local_u32Wait--;
+    }
+
+    Copy_pBus->Index = 0;
+    Copy_pBus->Ticks = 0;
+    Copy_pBus->Dma = FALSE;
+    if ((Local_pTransaction->TxLength != 0) || (Local_pTransaction->RxLength == 0))
+    {
+        Copy_pBus->Phase = MI2C_PHASE_WRITE;
+        SET_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+    }
+    else
+    {
+        Copy_pBus->Phase = MI2C_PHASE_READ;
+    }
+    SET_BIT(Local_pI2C->CR1, CR1_START);
+}
+
+/**
+ * @brief Start the head transaction if the bus is free.
+ *        Interrupts must be disabled or the caller must be the I2C interrupt.
+ */
+static void MI2C_voidRunQueue(MI2C_Bus_t *Copy_pBus)
+{
+    if ((Copy_pBus->Head != NULL) && (Copy_pBus->Busy == FALSE))
+    {
+        Copy_pBus->Busy = TRUE;
+        MI2C_voidStart(Copy_pBus);
+    }
+}
+
+/**
+ * @brief Remove the head transaction, start the next one and report the result.
+ *        The stop condition is already requested.
+ */
+static void MI2C_voidEnd(MI2C_Bus_t *Copy_pBus, u8 Copy_u8Status)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    MI2C_Transaction_t *Local_pTransaction = Copy_pBus->Head;
+
+    Local_pI2C->CR2 = (Local_pI2C->CR2 & ~((1UL << CR2_ITBUFEN) | (1UL << CR2_DMAEN) | (1UL << CR2_LAST)))
+                    | (1UL << CR2_ITEVTEN);
+    Copy_pBus->Dma = FALSE;
+    Copy_pBus->Busy = FALSE;
+    Copy_pBus->Head = Local_pTransaction->Next;
+    if (Copy_pBus->Head == NULL)
+    {
+        Copy_pBus->Tail = NULL;
+    }
+    MI2C_voidRunQueue(Copy_pBus);
+
+    Local_pTransaction->Status = Copy_u8Status;
+    if (Local_pTransaction->pfHandler != NULL)
+    {
+        Local_pTransaction->pfHandler(Local_pTransaction->pvContext);
+    }
+}
+
+/**
+ * @brief Mask the event and error interrupts of a bus, or clear and unmask
+ *        them. The bus is then recovered with only its own interrupts held off.
+ */
+static void MI2C_voidSetBusIrqs(const MI2C_Bus_t *Copy_pBus, u8 Copy_u8Enable)
+{
+    u8 Local_u8Ev = Global_u8EvIrqNumbers[Copy_pBus->Instance];
+    u8 Local_u8Er = Global_u8ErIrqNumbers[Copy_pBus->Instance];
+
+    if (Copy_u8Enable == TRUE)
+    {
+        MNVIC_voidClearPendingFlag(Local_u8Ev);
+        MNVIC_voidClearPendingFlag(Local_u8Er);
+        MNVIC_voidSetEnablePeripheralInterrupt(Local_u8Ev);
+        MNVIC_voidSetEnablePeripheralInterrupt(Local_u8Er);
+    }
+    else
+    {
+        MNVIC_voidSetDisablePeripheralInterrupt(Local_u8Ev);
+        MNVIC_voidSetDisablePeripheralInterrupt(Local_u8Er);
+    }
+}
+
+/**
+ * @brief Abort the head transaction from an interrupt: stop the DMA, mask the
+ *        bus interrupts and leave the recovery to the next MI2C_voidTick.
+ *
+ * The recovery takes tens of microseconds of clock pulses, too long for an
+ * interrupt. The transaction stays at the head until then, so submits only
+ * queue, and it ends FAILED once the bus is recovered.
+ */
+static void MI2C_voidAbort(MI2C_Bus_t *Copy_pBus)
+{
+    const MI2C_DmaRequest_t *Local_pDma = &Global_RxDma[Copy_pBus->Instance];
+
+    if (Copy_pBus->Dma == TRUE)
+    {
+        MDMA_voidStop(Local_pDma->Controller, Local_pDma->Stream);
+    }
+    MI2C_voidSetBusIrqs(Copy_pBus, FALSE);
+    Copy_pBus->Recovery = MI2C_RECOVERY_PENDING;
+}
+
+/**
+ * @brief Address acknowledged: prepare the reception before ADDR is cleared.
+ *
+ * The acknowledge of the last byte has to be withdrawn before it is received:
+ * - 1 byte: NACK and stop requested right when ADDR is cleared.
+ * - 2 bytes: NACK with POS (applies to the second byte), both read on BTF.
+ * - 3 bytes or more: bytes read on RXNE until 3 are left, then on BTF (see
+ *   MI2C_voidOnRead), or the whole read by DMA with LAST (automatic NACK).
+ */
+static void MI2C_voidOnAddress(MI2C_Bus_t *Copy_pBus)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    MI2C_Transaction_t *Local_pTransaction = Copy_pBus->Head;
+#if MI2C_RX_DMA == ENABLE
+    const MI2C_DmaRequest_t *Local_pDma = &Global_RxDma[Copy_pBus->Instance];
+#endif
+
+    if (Copy_pBus->Phase == MI2C_PHASE_WRITE)
+    {
+        (void)Local_pI2C->SR2;
+        if (Local_pTransaction->TxLength == 0)
+        {
+            // Address check only
+            SET_BIT(Local_pI2C->CR1, CR1_STOP);
+            MI2C_voidEnd(Copy_pBus, MI2C_DONE);
+        }
+        return;
+    }
+
+    if (Local_pTransaction->RxLength == 1)
+    {
+        CLR_BIT(Local_pI2C->CR1, CR1_ACK);
+        (void)Local_pI2C->SR2;
+        SET_BIT(Local_pI2C->CR1, CR1_STOP);
+        SET_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+    }
+    else if (Local_pTransaction->RxLength == 2)
+    {
+        Local_pI2C->CR1 = (Local_pI2C->CR1 & ~(1UL << CR1_ACK)) | (1UL << CR1_POS);
+        (void)Local_pI2C->SR2;
+    }
+#if MI2C_RX_DMA == ENABLE
+    else if (Local_pTransaction->RxLength >= MI2C_DMA_THRESHOLD)
+    {
+        SET_BIT(Local_pI2C->CR1, CR1_ACK);
+        if (Copy_pBus->Primed == TRUE)
+        {
+            MDMA_voidRestart(Local_pDma->Controller, Local_pDma->Stream, (u32)Local_pTransaction->RxData, Local_pTransaction->RxLength);
+        }
+        else
+        {
+            MDMA_u8Start(Local_pDma->Controller, Local_pDma->Stream, (u32)&Local_pI2C->DR,
+                         (u32)Local_pTransaction->RxData, 0, Local_pTransaction->RxLength);
+            Copy_pBus->Primed = TRUE;
+        }
+        Copy_pBus->Dma = TRUE;
+        // Events stay quiet until the stream ends, BTF belongs to the DMA
+        Local_pI2C->CR2 = (Local_pI2C->CR2 & ~(1UL << CR2_ITEVTEN)) | (1UL << CR2_DMAEN) | (1UL << CR2_LAST);
+        (void)Local_pI2C->SR2;
+    }
+#endif
+    else
+    {
+        SET_BIT(Local_pI2C->CR1, CR1_ACK);
+        if (Local_pTransaction->RxLength > 3)
+        {
+            SET_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+        }
+        (void)Local_pI2C->SR2;
+    }
+}
+
+/**
+ * @brief Write phase: feed the data register, then restart or stop on BTF.
+ */
+static void MI2C_voidOnWrite(MI2C_Bus_t *Copy_pBus, u32 Copy_u32Status)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    MI2C_Transaction_t *Local_pTransaction = Copy_pBus->Head;
+
+    if ((GET_BIT(Copy_u32Status, SR1_TXE) != 0) && (Copy_pBus->Index < Local_pTransaction->TxLength))
+    {
+        Local_pI2C->DR = Local_pTransaction->TxData[Copy_pBus->Index];
+        Copy_pBus->Index++;
+        if (Copy_pBus->Index == Local_pTransaction->TxLength)
+        {
+            CLR_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+        }
+    }
+    else if (GET_BIT(Copy_u32Status, SR1_BTF) != 0)
+    {
+        if (Local_pTransaction->RxLength != 0)
+        {
+            // Repeated start, BTF stays set until it is sent
+            Copy_pBus->Phase = MI2C_PHASE_RESTART;
+            Copy_pBus->Index = 0;
+            SET_BIT(Local_pI2C->CR1, CR1_START);
+        }
+        else
+        {
+            SET_BIT(Local_pI2C->CR1, CR1_STOP);
+            MI2C_voidEnd(Copy_pBus, MI2C_DONE);
+        }
+    }
+}
+
+/**
+ * @brief Read phase without DMA.
+ *
+ * While more than 3 bytes are left, each RXNE reads one. The last 3 are
+ * read on BTF, when the data register and the shift register are both full
+ * and the bus is stalled: the NACK is armed before the last byte starts,
+ * and the stop is requested before the last two are read.
+ */
+static void MI2C_voidOnRead(MI2C_Bus_t *Copy_pBus, u32 Copy_u32Status)
+{
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_pBus->Instance];
+    MI2C_Transaction_t *Local_pTransaction = Copy_pBus->Head;
+    u16 Local_u16Left = Local_pTransaction->RxLength - Copy_pBus->Index;
+
+    if ((GET_BIT(Copy_u32Status, SR1_RXNE) != 0) && (GET_BIT(Local_pI2C->CR2, CR2_ITBUFEN) != 0))
+    {
+        Local_pTransaction->RxData[Copy_pBus->Index] = (u8)Local_pI2C->DR;
+        Copy_pBus->Index++;
+        if (Local_u16Left == 1)
+        {
+            MI2C_voidEnd(Copy_pBus, MI2C_DONE);
+        }
+        else if (Local_u16Left == 4)
+        {
+            CLR_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+        }
+    }
+    else if (GET_BIT(Copy_u32Status, SR1_BTF) != 0)
+    {
+        if (Local_u16Left == 3)
+        {
+            CLR_BIT(Local_pI2C->CR1, CR1_ACK);
+            Local_pTransaction->RxData[Copy_pBus->Index] = (u8)Local_pI2C->DR;
+            Copy_pBus->Index++;
+        }
+        else if (Local_u16Left == 2)
+        {
+            Local_pI2C->CR1 = (Local_pI2C->CR1 & ~(1UL << CR1_POS)) | (1UL << CR1_STOP);
+            Local_pTransaction->RxData[Copy_pBus->Index] = (u8)Local_pI2C->DR;
+            Local_pTransaction->RxData[Copy_pBus->Index + 1] = (u8)Local_pI2C->DR;
+            Copy_pBus->Index += 2;
+            MI2C_voidEnd(Copy_pBus, MI2C_DONE);
+        }
+    }
+}
+
+/**
+ * @brief Event interrupt of an I2C.
+ */
+static void MI2C_voidServeEvent(u8 Copy_u8Instance)
+{
+    MI2C_Bus_t *Local_pBus = &Global_Buses[Copy_u8Instance];
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_u8Instance];
+    u32 Local_u32Status = Local_pI2C->SR1;
+
+    if (Local_pBus->Busy == FALSE)
+    {
+        // Late event of a transaction already ended: clear it
+        CLR_BIT(Local_pI2C->CR2, CR2_ITBUFEN);
+        (void)Local_pI2C->SR2;
+        (void)Local_pI2C->DR;
+        return;
+    }
+
+    if (GET_BIT(Local_u32Status, SR1_SB) != 0)
+    {
+        if (Local_pBus->Phase == MI2C_PHASE_RESTART)
+        {
+            Local_pBus->Phase = MI2C_PHASE_READ;
+        }
+        Local_pI2C->DR = ((u32)Local_pBus->Head->Address << 1) | ((Local_pBus->Phase == MI2C_PHASE_READ) ? 1UL : 0UL);
+    }
+    else if (GET_BIT(Local_u32Status, SR1_ADDR) != 0)
+    {
+        MI2C_voidOnAddress(Local_pBus);
+    }
+    else if (Local_pBus->Phase == MI2C_PHASE_WRITE)
+    {
+        MI2C_voidOnWrite(Local_pBus, Local_u32Status);
+    }
+    else if (Local_pBus->Phase == MI2C_PHASE_READ)
+    {
+        MI2C_voidOnRead(Local_pBus, Local_u32Status);
+    }
+}
+
+/**
+ * @brief Error interrupt of an I2C.
+ *
+ * A NACK ends the transaction with a stop condition. A bus error or a lost
+ * arbitration (a glitch or a device out of step, this driver is the only
+ * master) leaves the bus in an unknown state: recover it.
+ */
+static void MI2C_voidServeError(u8 Copy_u8Instance)
+{
+    MI2C_Bus_t *Local_pBus = &Global_Buses[Copy_u8Instance];
+    volatile I2C_t *Local_pI2C = Global_pI2C[Copy_u8Instance];
+    u32 Local_u32Errors = Local_pI2C->SR1 & SR1_ERRORS;
+
+    // Error flags clear by writing 0, the other bits ignore a 1
+    Local_pI2C->SR1 = ~Local_u32Errors & 0xFFFFUL;
+    if ((Local_pBus->Busy == FALSE) || (Local_u32Errors == 0))
+    {
+        return;
+    }
+
+    if (Local_u32Errors == (1UL << SR1_AF))
+    {
+        SET_BIT(Local_pI2C->CR1, CR1_STOP);
+        MI2C_voidEnd(Local_pBus, MI2C_NACK);
+    }
+    else
+    {
+        MI2C_voidAbort(Local_pBus);
+    }
+}
+
+#if MI2C_RX_DMA == ENABLE
+/**
+ * @brief Reception stream complete: the last byte was NACKed and read.
+ */
+static void MI2C_voidOnDmaFull(void *pvContext)
+{
+    MI2C_Bus_t *Local_pBus = (MI2C_Bus_t *)pvContext;
+
+    SET_BIT(Global_pI2C[Local_pBus->Instance]->CR1, CR1_STOP);
+    MI2C_voidEnd(Local_pBus, MI2C_DONE);
+}
+
+/**
+ * @brief Reception stream bus error.
+ */
+static void MI2C_voidOnDmaError(void *pvContext)
+{
+    MI2C_Bus_t *Local_pBus = (MI2C_Bus_t *)pvContext;
+
+    if (Local_pBus->Dma == TRUE)
+    {
+        MI2C_voidAbort(Local_pBus);
+    }
+}
+#endif
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Clock the I2C, set its pins, recover the bus and program the timing.
+ *
+ * @param Copy_u8Instance: MI2C_Instance_e.
+ * @param Copy_pConfig: Bus configuration.
+ * @return u8: STD_OK, or STD_NOK for a speed out of reach, a stream held by another driver or a bus held low.
+ */
+u8 MI2C_u8Init(u8 Copy_u8Instance, const MI2C_Config_t *Copy_pConfig)
+{
+    MI2C_Bus_t *Local_pBus;
+#if MI2C_RX_DMA == ENABLE
+    const MI2C_DmaRequest_t *Local_pDma;
+    MDMA_StreamConfig_t Local_DmaConfig = {
+        .Direction = MDMA_PERIPH_TO_MEM, .Priority = MI2C_RX_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_BYTE, .MemSize = MDMA_SIZE_BYTE, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_DIRECT,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_FULL | MDMA_IT_ERROR
+    };
+#endif
+
+    if (Copy_u8Instance >= I2C_INSTANCES)
+    {
+        return STD_NOK;
+    }
+    Local_pBus = &Global_Buses[Copy_u8Instance];
+
+    switch (Copy_u8Instance)
+    {
+    case MI2C_1:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_I2C1EN);
+        break;
+    case MI2C_2:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_I2C2EN);
+        break;
+    default:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_I2C3EN);
+        break;
+    }
+
+    Local_pBus->Head = NULL;
+    Local_pBus->Tail = NULL;
+    Local_pBus->Busy = FALSE;
+    Local_pBus->Dma = FALSE;
+    Local_pBus->Primed = FALSE;
+    Local_pBus->Recovery = MI2C_RECOVERY_NONE;
+    Local_pBus->Instance = Copy_u8Instance;
+    Local_pBus->Config = *Copy_pConfig;
+
+    MGPIO_voidSetPinOType((EN_GpioPortNo_t)Copy_pConfig->SclPort, (EN_GpioPinNo_t)Copy_pConfig->SclPin, GPIO_OTYPE_OPEN_DRAIN);
+    MGPIO_voidSetPinOType((EN_GpioPortNo_t)Copy_pConfig->SdaPort, (EN_GpioPinNo_t)Copy_pConfig->SdaPin, GPIO_OTYPE_OPEN_DRAIN);
+    MGPIO_voidSetPinOSpeed((EN_GpioPortNo_t)Copy_pConfig->SclPort, (EN_GpioPinNo_t)Copy_pConfig->SclPin, GPIO_OSPEED_HIGH);
+    MGPIO_voidSetPinOSpeed((EN_GpioPortNo_t)Copy_pConfig->SdaPort, (EN_GpioPinNo_t)Copy_pConfig->SdaPin, GPIO_OSPEED_HIGH);
+
+#if MI2C_RX_DMA == ENABLE
+    Local_pDma = &Global_RxDma[Copy_u8Instance];
+    Local_DmaConfig.Channel = Local_pDma->Channel;
+    Local_DmaConfig.IrqGroup = Copy_pConfig->IrqGroup;
+    Local_DmaConfig.IrqSubGroup = Copy_pConfig->IrqSubGroup;
+    Local_DmaConfig.Owner = Local_pBus;
+    if (MDMA_u8Init(Local_pDma->Controller, Local_pDma->Stream, &Local_DmaConfig) == STD_NOK)
+    {
+        return STD_NOK;
+    }
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_FULL, MI2C_voidOnDmaFull, Local_pBus);
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_ERROR, MI2C_voidOnDmaError, Local_pBus);
+#endif
+
+    // Event and error interrupts at the same priority: they never preempt each other
+    MNVIC_voidSetInterruptPriority(Global_u8EvIrqNumbers[Copy_u8Instance], Copy_pConfig->IrqGroup, Copy_pConfig->IrqSubGroup);
+    MNVIC_voidSetInterruptPriority(Global_u8ErIrqNumbers[Copy_u8Instance], Copy_pConfig->IrqGroup, Copy_pConfig->IrqSubGroup);
+    MNVIC_voidSetEnablePeripheralInterrupt(Global_u8EvIrqNumbers[Copy_u8Instance]);
+    MNVIC_voidSetEnablePeripheralInterrupt(Global_u8ErIrqNumbers[Copy_u8Instance]);
+
+    return MI2C_u8Recover(Local_pBus);
+}
+
+/**
+ * @brief Queue a write, a read, or a write then a read.
+ *
+ * @return u8: STD_OK, or STD_NOK for invalid arguments or a transaction already queued.
+ */
+u8 MI2C_u8Submit(u8 Copy_u8Instance, MI2C_Transaction_t *Copy_pTransaction, u8 Copy_u8Address,
+                 const u8 *Copy_pu8Tx, u16 Copy_u16TxLength, u8 *Copy_pu8Rx, u16 Copy_u16RxLength,
+                 CallBackFn_t pfHandler, void *pvContext)
+{
+    MI2C_Bus_t *Local_pBus;
+    u32 Local_u32State;
+
+    if ((Copy_u8Instance >= I2C_INSTANCES) || (Copy_u8Address > 0x7F)
+        || ((Copy_pu8Tx == NULL) && (Copy_u16TxLength != 0)) || ((Copy_pu8Rx == NULL) && (Copy_u16RxLength != 0)))
+    {
+        return STD_NOK;
+    }
+    Local_pBus = &Global_Buses[Copy_u8Instance];
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Copy_pTransaction->Status == MI2C_QUEUED)
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Copy_pTransaction->Next = NULL;
+    Copy_pTransaction->Address = Copy_u8Address;
+    Copy_pTransaction->TxData = Copy_pu8Tx;
+    Copy_pTransaction->TxLength = Copy_u16TxLength;
+    Copy_pTransaction->RxData = Copy_pu8Rx;
+    Copy_pTransaction->RxLength = Copy_u16RxLength;
+    Copy_pTransaction->Status = MI2C_QUEUED;
+    Copy_pTransaction->pfHandler = pfHandler;
+    Copy_pTransaction->pvContext = pvContext;
+
+    if (Local_pBus->Tail != NULL)
+    {
+        Local_pBus->Tail->Next = Copy_pTransaction;
+    }
+    else
+    {
+        Local_pBus->Head = Copy_pTransaction;
+    }
+    Local_pBus->Tail = Copy_pTransaction;
+    MI2C_voidRunQueue(Local_pBus);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return STD_OK;
+}
+
+/**
+ * @brief Queue a register read (register number, repeated start, read).
+ *
+ * @return u8: STD_OK, or STD_NOK for invalid arguments or a transaction already queued.
+ */
+u8 MI2C_u8ReadRegister(u8 Copy_u8Instance, MI2C_Transaction_t *Copy_pTransaction, u8 Copy_u8Address,
+                       u8 Copy_u8Register, u8 *Copy_pu8Rx, u16 Copy_u16RxLength,
+                       CallBackFn_t pfHandler, void *pvContext)
+{
+    if ((Copy_u16RxLength == 0) || (Copy_pTransaction->Status == MI2C_QUEUED))
+    {
+        return STD_NOK;
+    }
+    Copy_pTransaction->Register = Copy_u8Register;
+    return MI2C_u8Submit(Copy_u8Instance, Copy_pTransaction, Copy_u8Address, &Copy_pTransaction->Register, 1,
+                         Copy_pu8Rx, Copy_u16RxLength, pfHandler, pvContext);
+}
+
+/**
+ * @brief Get the state of a transaction.
+ */
+u8 MI2C_u8GetStatus(const MI2C_Transaction_t *Copy_pTransaction)
+{
+    return Copy_pTransaction->Status;
+}
+
+/**
+ * @brief Check whether the queue of an I2C is empty.
+ */
+u8 MI2C_u8IsIdle(u8 Copy_u8Instance)
+{
+    return (Global_Buses[Copy_u8Instance].Head == NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Age the transaction on the bus, abort it once too old, and recover
+ *        the bus after an error seen by an interrupt.
+ *
+ * The timeout is detected with interrupts disabled, but the recovery takes
+ * tens of microseconds: it runs with only this bus's interrupts masked. The
+ * transaction stays at the head meanwhile, so submits only queue. A bus in
+ * recovery is not aged, so the ticks counted meanwhile cannot start a second
+ * one, nor one during MI2C_u8RecoverBus.
+ */
+void MI2C_voidTick(u8 Copy_u8Instance)
+{
+    MI2C_Bus_t *Local_pBus;
+    const MI2C_DmaRequest_t *Local_pDma;
+    u32 Local_u32State;
+    u8 Local_u8Recover = FALSE;
+
+    if (Copy_u8Instance >= I2C_INSTANCES)
+    {
+        return;
+    }
+    Local_pBus = &Global_Buses[Copy_u8Instance];
+    Local_pDma = &Global_RxDma[Copy_u8Instance];
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Local_pBus->Recovery == MI2C_RECOVERY_PENDING)
+    {
+        // Interrupts and DMA already stopped by MI2C_voidAbort
+        Local_pBus->Recovery = MI2C_RECOVERY_RUNNING;
+        Local_u8Recover = TRUE;
+    }
+    else if ((Local_pBus->Recovery == MI2C_RECOVERY_NONE) && (Local_pBus->Busy == TRUE) &&
+             (++Local_pBus->Ticks == MI2C_TIMEOUT_TICKS))
+    {
+        MI2C_voidSetBusIrqs(Local_pBus, FALSE);
+        if (Local_pBus->Dma == TRUE)
+        {
+            MDMA_voidStop(Local_pDma->Controller, Local_pDma->Stream);
+        }
+        Local_pBus->Recovery = MI2C_RECOVERY_RUNNING;
+        Local_u8Recover = TRUE;
+    }
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+
+    if (Local_u8Recover == TRUE)
+    {
+        (void)MI2C_u8Recover(Local_pBus);
+        Local_u32State = MNVIC_u32DisableInterrupts();
+        MI2C_voidSetBusIrqs(Local_pBus, TRUE);
+        Local_pBus->Recovery = MI2C_RECOVERY_NONE;
+        if (Local_pBus->Head != NULL)
+        {
+            MI2C_voidEnd(Local_pBus, MI2C_FAILED);
+        }
+        else
+        {
+            Local_pBus->Busy = FALSE;
+            MI2C_voidRunQueue(Local_pBus);
+        }
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+    }
+}
+
+/**
+ * @brief Recover the bus on request, refused while a transaction runs or a
+ *        recovery is pending.
+ *
+ * The bus is marked busy so a transaction submitted meanwhile only queues,
+ * and in recovery so MI2C_voidTick does not age it. The recovery runs with
+ * only this bus's interrupts masked.
+ */
+u8 MI2C_u8RecoverBus(u8 Copy_u8Instance)
+{
+    MI2C_Bus_t *Local_pBus;
+    u8 Local_u8Result;
+    u32 Local_u32State;
+
+    if (Copy_u8Instance >= I2C_INSTANCES)
+    {
+        return STD_NOK;
+    }
+    Local_pBus = &Global_Buses[Copy_u8Instance];
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if ((Local_pBus->Busy == TRUE) || (Local_pBus->Recovery != MI2C_RECOVERY_NONE))
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Local_pBus->Busy = TRUE;
+    Local_pBus->Ticks = 0;
+    Local_pBus->Recovery = MI2C_RECOVERY_RUNNING;
+    MI2C_voidSetBusIrqs(Local_pBus, FALSE);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+
+    Local_u8Result = MI2C_u8Recover(Local_pBus);
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    MI2C_voidSetBusIrqs(Local_pBus, TRUE);
+    Local_pBus->Recovery = MI2C_RECOVERY_NONE;
+    Local_pBus->Busy = FALSE;
+    MI2C_voidRunQueue(Local_pBus);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return Local_u8Result;
+}
+
+/****************************************************/
+/* INTERRUPT HANDLERS                               */
+/****************************************************/
+
+#if MI2C1_HANDLER == ENABLE
+void I2C1_EV_IRQHandler(void)
+{
+    MI2C_voidServeEvent(MI2C_1);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+    MI2C_voidServeError(MI2C_1);
+}
+#endif
+
+#if MI2C2_HANDLER == ENABLE
+void I2C2_EV_IRQHandler(void)
+{
+    MI2C_voidServeEvent(MI2C_2);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+    MI2C_voidServeError(MI2C_2);
+}
+#endif
+
+#if MI2C3_HANDLER == ENABLE
+void I2C3_EV_IRQHandler(void)
+{
+    MI2C_voidServeEvent(MI2C_3);
+}
+
+void I2C3_ER_IRQHandler(void)
+{
+    MI2C_voidServeError(MI2C_3);
+}
+#endif
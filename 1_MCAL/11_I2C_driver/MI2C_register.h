@@ -0,0 +1,37 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MI2C_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MI2C_REGISTER_H_
+#define MI2C_REGISTER_H_
+
+/* Base addresses of the I2Cs (all on APB1) */
+#define I2C1_BASE_ADDRESS       0x40005400
+#define I2C2_BASE_ADDRESS       0x40005800
+#define I2C3_BASE_ADDRESS       0x40005C00
+
+/**
+ * @brief Structure representing the I2C registers.
+ */
+typedef struct
+{
+    u32 CR1;        /**< Control Register 1 */
+    u32 CR2;        /**< Control Register 2 */
+    u32 OAR1;       /**< Own Address Register 1 */
+    u32 OAR2;       /**< Own Address Register 2 */
+    u32 DR;         /**< Data Register */
+    u32 SR1;        /**< Status Register 1 */
+    u32 SR2;        /**< Status Register 2 */
+    u32 CCR;        /**< Clock Control Register */
+    u32 TRISE;      /**< Rise Time Register */
+    u32 FLTR;       /**< Filter Register */
+} I2C_t;
+
+#define I2C1        ((volatile I2C_t*)I2C1_BASE_ADDRESS)
+#define I2C2        ((volatile I2C_t*)I2C2_BASE_ADDRESS)
+#define I2C3        ((volatile I2C_t*)I2C3_BASE_ADDRESS)
+
+#endif /* MI2C_REGISTER_H_ */
@@ -0,0 +1,28 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MADC_CONFIG_H_
+#define MADC_CONFIG_H_
+
+/* Interrupt handler (overrun) defined by the driver.
+ * Options: ENABLE or DISABLE */
+#define MADC_HANDLER            ENABLE
+
+/* Highest ADC clock in Hz: 36 MHz with VDDA at 2.4 V or more, 18 MHz below.
+ * The prescaler (PCLK2 / 2, 4, 6 or 8) is the smallest that stays under it. */
+#define MADC_MAX_CLOCK          36000000UL
+
+/* DMA request of ADC1: { controller, stream, channel }
+ * Options: DMA2 stream 0 (default) or 4, channel 0. Stream 4 is also the
+ * SPI4 TX default: use it only if SPI4 transmits without DMA. */
+#define MADC_DMA                { MDMA_DMA2, 0, 0 }
+
+/* Priority of the stream, MDMA_Priority_e. At 2.4 MSPS a conversion lands
+ * every 417 ns: a late transfer is an overrun. */
+#define MADC_DMA_PRIORITY       MDMA_PRIORITY_VERY_HIGH
+
+#endif /* MADC_CONFIG_H_ */
@@ -0,0 +1,138 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MADC_INTERFACE_H_
+#define MADC_INTERFACE_H_
+
+/*
+ * ADC1 converts a regular sequence of up to 16 channels, free running or one
+ * sequence per timer trigger, and a double-buffered DMA stream stores the
+ * results (one half-word per conversion, right aligned) alternately in the
+ * ping and the pong buffer. The CPU only runs at the half and the end of each
+ * buffer, and the handler gets the half just completed: it may use it until
+ * the DMA comes back to it, a full buffer later.
+ *
+ * Optional oversampling sums groups of consecutive sequences in place before
+ * the handler runs, two channels per instruction (DSP.h), and shifts the sums
+ * right: 4 sequences shifted by 2 average them, shifted by 1 add a bit of
+ * resolution.
+ *
+ * Rate: a conversion takes the sampling time plus one cycle per result bit.
+ * With 3 sampling cycles at 12 bits and the ADC clock at 36 MHz (PCLK2 at
+ * 72 MHz) that is 2.4 MSPS, 300 k sequences of 8 channels per second; with
+ * PCLK2 at 84 MHz the clock is 21 MHz and the rate 1.4 MSPS.
+ *
+ * Pins: set the channel inputs to GPIO_MODE_ANALOG.
+ */
+
+typedef enum {
+    MADC_RES_12 = 0,
+    MADC_RES_10,
+    MADC_RES_8,
+    MADC_RES_6
+} MADC_Resolution_e;
+
+/* Start of the conversions: a timer event converts one sequence (rising
+ * edge), MADC_FREE_RUNNING converts back to back. */
+typedef enum {
+    MADC_TRIGGER_TIM1_CC1 = 0,
+    MADC_TRIGGER_TIM1_CC2,
+    MADC_TRIGGER_TIM1_CC3,
+    MADC_TRIGGER_TIM2_CC2,
+    MADC_TRIGGER_TIM2_CC3,
+    MADC_TRIGGER_TIM2_CC4,
+    MADC_TRIGGER_TIM2_TRGO,
+    MADC_TRIGGER_TIM3_CC1,
+    MADC_TRIGGER_TIM3_TRGO,
+    MADC_TRIGGER_TIM4_CC4,
+    MADC_TRIGGER_TIM5_CC1,
+    MADC_TRIGGER_TIM5_CC2,
+    MADC_TRIGGER_TIM5_CC3,
+    MADC_TRIGGER_EXTI11 = 15,
+    MADC_FREE_RUNNING
+} MADC_Trigger_e;
+
+/**
+ * @brief Conversion configuration.
+ */
+typedef struct
+{
+    const u8 *Channels;     /**< Sequence of channels, 0 to 18 (16: temperature, 17: VREFINT, 18: VBAT) */
+    u8  Count;              /**< Conversions in the sequence, 1 to 16 */
+    u8  Resolution;         /**< MADC_Resolution_e */
+    u8  Trigger;            /**< MADC_Trigger_e, the reserved codes 13 and 14 are refused */
+    u8  Oversample;         /**< Sequences summed into one: 1 (none), 2, 4 or 8 */
+    u8  OversampleShift;    /**< Right shift of the sums, below the sum width (resolution bits + log2 of Oversample) */
+    u8  IrqGroup;           /**< NVIC group priority of the DMA and ADC interrupts */
+    u8  IrqSubGroup;        /**< NVIC subgroup priority */
+    u32 SampleNs;           /**< Shortest sampling time the sources need, in ns (0 for the shortest) */
+} MADC_Config_t;
+
+/**
+ * @brief Receives the completed half buffers, runs in interrupt context.
+ * @param pvContext Context given to MADC_u8Start.
+ * @param Copy_pu16Block Sequences, channel after channel, oversampled if enabled.
+ * @param Copy_u16Sequences Sequences in the block.
+ */
+typedef void (*MADC_BlockHandler_t)(void *pvContext, u16 *Copy_pu16Block, u16 Copy_u16Sequences);
+
+/* Function Prototypes */
+
+/**
+ * @brief Clocks ADC1, sets its clock from the live PCLK2 (read back from RCC),
+ *        the sampling time of each channel from the ADC clock, the sequence
+ *        and the trigger, and prepares its DMA stream.
+ * @param Copy_pConfig Conversion configuration.
+ * @return STD_OK, or STD_NOK for an invalid sequence or oversampling, a
+ *         sampling time above 480 ADC cycles, or a stream held by another
+ *         driver (see MADC_DMA).
+ */
+u8 MADC_u8Init(const MADC_Config_t *Copy_pConfig);
+
+/**
+ * @brief Starts the conversions into the ping and pong buffers.
+ * @param Copy_pu16Ping First buffer, Sequences * Count half-words.
+ * @param Copy_pu16Pong Second buffer, same size.
+ * @param Copy_u16Sequences Sequences per buffer, even, each half a multiple
+ *        of the oversampling, at most 65535 conversions per buffer.
+ * @param pfHandler Block handler.
+ * @param pvContext Context passed to the handler.
+ * @return STD_OK, or STD_NOK for invalid buffers or sizes.
+ */
+u8 MADC_u8Start(u16 *Copy_pu16Ping, u16 *Copy_pu16Pong, u16 Copy_u16Sequences,
+                MADC_BlockHandler_t pfHandler, void *pvContext);
+
+/**
+ * @brief Stops the conversions and the DMA stream.
+ */
+void MADC_voidStop(void);
+
+/**
+ * @brief Gets the free-running conversion rate of the configuration.
+ * @return Conversions per second (divide by Count for sequences).
+ */
+u32 MADC_u32GetConversionRate(void);
+
+/**
+ * @brief Gets the restarts after an overrun (a conversion lost because the DMA
+ *        was late) or a DMA error. The buffers restart from the ping one.
+ * @return Restarts since MADC_u8Init, wraps.
+ */
+u32 MADC_u32GetOverruns(void);
+
+/**
+ * @brief Sums groups of consecutive sequences of a block in place.
+ * @param Copy_pu16Block Sequences, the results are stored from its start.
+ * @param Copy_u16Sequences Sequences in the block, a multiple of the factor.
+ * @param Copy_u8Count Conversions per sequence.
+ * @param Copy_u8Factor Sequences per group, 1 to 8 (12-bit sums of 8 stay below 2^15).
+ * @param Copy_u8Shift Right shift of each sum, below 16.
+ * @return Sequences left in the block.
+ */
+u16 MADC_u16Oversample(u16 *Copy_pu16Block, u16 Copy_u16Sequences, u8 Copy_u8Count, u8 Copy_u8Factor, u8 Copy_u8Shift);
+
+#endif /* MADC_INTERFACE_H_ */
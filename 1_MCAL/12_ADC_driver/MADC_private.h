@@ -0,0 +1,94 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MADC_PRIVATE_H_
+#define MADC_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* SR Bit Definitions */
+#define SR_OVR              5   // Overrun
+
+/* CR1 Bit Definitions */
+#define CR1_SCAN            8   // Scan the regular sequence
+#define CR1_RES             24  // Resolution, 2 bits
+#define CR1_OVRIE           26  // Overrun interrupt enable
+
+/* CR2 Bit Definitions */
+#define CR2_ADON            0   // A/D converter on
+#define CR2_CONT            1   // Continuous conversion
+#define CR2_DMA             8   // DMA requests
+#define CR2_DDS             9   // DMA requests go on after the last transfer
+#define CR2_EXTSEL          24  // External trigger of the regular group, 4 bits
+#define CR2_EXTEN           28  // External trigger edge, 2 bits: 01 rising
+#define CR2_SWSTART         30  // Start the regular group
+
+#define EXTEN_RISING        1UL
+
+/* CCR Bit Definitions */
+#define CCR_ADCPRE          16  // ADC prescaler, 2 bits: PCLK2 / (2 * (ADCPRE + 1))
+#define ADCPRE_MAX          3UL
+
+/* Sequence registers: 6 conversions of 5 bits per register, length in SQR1 */
+#define SQR_CONVERSIONS     6
+#define SQR_BITS            5
+#define SQR1_L              20
+
+/* Sample time registers: 3 bits per channel, channels 10 and up in SMPR1 */
+#define SMPR_BITS           3
+#define SMPR2_CHANNELS      10
+
+#define MADC_MAX_CHANNEL    18
+#define MADC_MAX_SEQUENCE   16
+#define MADC_MAX_OVERSAMPLE 8   // 8 sums of 12 bits still fit in a q15
+
+/* Bits of a conversion at each MADC_Resolution_e */
+#define MADC_RESOLUTION_BITS(RES)   (12U - (2U * (RES)))
+
+/* EXTSEL codes 13 and 14 select no trigger */
+#define MADC_TRIGGER_RESERVED(TRIGGER)  (((TRIGGER) > MADC_TRIGGER_TIM5_CC3) && ((TRIGGER) < MADC_TRIGGER_EXTI11))
+
+/* Sampling cycles of each SMP code */
+#define MADC_SAMPLE_CYCLES  {3, 15, 28, 56, 84, 112, 144, 480}
+#define MADC_SAMPLE_CODES   8
+
+/* ADC stabilization time after ADON, in microseconds */
+#define MADC_STAB_US        3
+
+/* Global interrupt line of the ADCs */
+#define ADC_IRQ_NUMBER      18
+
+/**
+ * @brief DMA request of the ADC.
+ */
+typedef struct
+{
+    u8 Controller;
+    u8 Stream;
+    u8 Channel;
+} MADC_DmaRequest_t;
+
+/**
+ * @brief State of the conversions.
+ */
+typedef struct
+{
+    u16                *Buffers[2];     /**< Ping and pong buffers, memory 0 and memory 1 of the stream */
+    u16                 Sequences;      /**< Sequences per buffer */
+    u8                  Count;          /**< Conversions per sequence */
+    u8                  Oversample;     /**< Sequences summed into one, 1 for none */
+    u8                  Shift;          /**< Right shift of the sums */
+    u8                  Running;        /**< TRUE between MADC_u8Start and MADC_voidStop */
+    u32                 CR2;            /**< CR2 without ADON and SWSTART */
+    u32                 Rate;           /**< Conversions per second when free running */
+    u32                 Overruns;       /**< Restarts after an overrun or a DMA error */
+    MADC_BlockHandler_t pfHandler;      /**< Block handler */
+    void               *pvContext;      /**< Context passed to the handler */
+} MADC_State_t;
+
+#endif /* MADC_PRIVATE_H_ */
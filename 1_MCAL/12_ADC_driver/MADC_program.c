@@ -0,0 +1,376 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+#include "DSP.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MRCC_interface.h"
+#include "NVIC_interface.h"
+#include "MDMA_interface.h"
+#include "MDWT_interface.h"
+
+/****************************************************/
+/* ADC Directives                                   */
+/****************************************************/
+#include "MADC_interface.h"
+#include "MADC_config.h"
+#include "MADC_private.h"
+#include "MADC_register.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static const MADC_DmaRequest_t Global_Dma = MADC_DMA;
+static const u16 Global_u16SampleCycles[MADC_SAMPLE_CODES] = MADC_SAMPLE_CYCLES;
+
+static MADC_State_t Global_State;
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Oversample a completed half buffer and hand it to the application.
+ */
+static void MADC_voidHand(u16 *Copy_pu16Block)
+{
+    u16 Local_u16Sequences = Global_State.Sequences / 2;
+
+    if (Global_State.Oversample > 1)
+    {
+        Local_u16Sequences = MADC_u16Oversample(Copy_pu16Block, Local_u16Sequences, Global_State.Count,
+                                                Global_State.Oversample, Global_State.Shift);
+    }
+    Global_State.pfHandler(Global_State.pvContext, Copy_pu16Block, Local_u16Sequences);
+}
+
+/**
+ * @brief First half of the current buffer done, the stream is on its second half.
+ */
+static void MADC_voidOnHalf(void *pvContext)
+{
+    (void)pvContext;
+    MADC_voidHand(Global_State.Buffers[MDMA_u8GetCurrentBuffer(Global_Dma.Controller, Global_Dma.Stream)]);
+}
+
+/**
+ * @brief Buffer done, the stream already moved to the other one.
+ */
+static void MADC_voidOnFull(void *pvContext)
+{
+    u8 Local_u8Done = MDMA_u8GetCurrentBuffer(Global_Dma.Controller, Global_Dma.Stream) ^ 1U;
+
+    (void)pvContext;
+    MADC_voidHand(Global_State.Buffers[Local_u8Done] + ((u32)(Global_State.Sequences / 2) * Global_State.Count));
+}
+
+/**
+ * @brief Start the stream on the ping buffer and the conversions.
+ *        DMA requests are off until the stream is ready.
+ */
+static void MADC_voidLaunch(void)
+{
+    MDMA_u8Start(Global_Dma.Controller, Global_Dma.Stream, (u32)&ADC1->DR, (u32)Global_State.Buffers[0],
+                 (u32)Global_State.Buffers[1], (u16)((u32)Global_State.Sequences * Global_State.Count));
+    ADC1->CR2 = Global_State.CR2 | (1UL << CR2_ADON);
+    if (GET_BIT(Global_State.CR2, CR2_CONT) != 0)
+    {
+        SET_BIT(ADC1->CR2, CR2_SWSTART);
+    }
+}
+
+/**
+ * @brief Overrun or DMA error: the sequence order in the buffers is lost,
+ *        start over from the ping buffer.
+ */
+static void MADC_voidRecover(void)
+{
+    CLR_BIT(ADC1->CR2, CR2_DMA);
+    MDMA_voidStop(Global_Dma.Controller, Global_Dma.Stream);
+    ADC1->SR = ~(1UL << SR_OVR);
+    Global_State.Overruns++;
+    MADC_voidLaunch();
+}
+
+/**
+ * @brief DMA error callback.
+ */
+static void MADC_voidOnDmaError(void *pvContext)
+{
+    (void)pvContext;
+    if (Global_State.Running == TRUE)
+    {
+        MADC_voidRecover();
+    }
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Clock ADC1 and apply a conversion configuration.
+ *
+ * The ADC clock is PCLK2 over the smallest prescaler keeping it within
+ * MADC_MAX_CLOCK. The sampling time is the shortest code covering SampleNs
+ * at that clock.
+ *
+ * @param Copy_pConfig: Conversion configuration.
+ * @return u8: STD_OK, or STD_NOK for an invalid configuration or a stream held by another driver.
+ */
+u8 MADC_u8Init(const MADC_Config_t *Copy_pConfig)
+{
+    u32 Local_u32Pclk;
+    u32 Local_u32Prescaler = 0;
+    u32 Local_u32AdcClock;
+    u32 Local_u32Cycles;
+    u32 Local_u32SMPR1 = 0;
+    u32 Local_u32SMPR2 = 0;
+    u32 Local_u32SQR[3] = {0, 0, 0};    // SQR3, SQR2, SQR1
+    u8 Local_u8Code = 0;
+    u8 Local_u8Index;
+    u8 Local_u8Channel;
+    u8 Local_u8SumBits;
+    MDMA_StreamConfig_t Local_DmaConfig = {
+        .Channel = Global_Dma.Channel, .Direction = MDMA_PERIPH_TO_MEM, .Priority = MADC_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_HALFWORD, .MemSize = MDMA_SIZE_HALFWORD, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_DOUBLE_BUFFER, .Fifo = MDMA_FIFO_DIRECT,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_HALF | MDMA_IT_FULL | MDMA_IT_ERROR, .Owner = &Global_State
+    };
+
+    if ((Copy_pConfig->Count == 0) || (Copy_pConfig->Count > MADC_MAX_SEQUENCE)
+        || (Copy_pConfig->Resolution > MADC_RES_6) || (Copy_pConfig->Trigger > MADC_FREE_RUNNING)
+        || (Copy_pConfig->Oversample == 0) || (Copy_pConfig->Oversample > MADC_MAX_OVERSAMPLE)
+        || ((Copy_pConfig->Oversample & (Copy_pConfig->Oversample - 1)) != 0)
+        || MADC_TRIGGER_RESERVED(Copy_pConfig->Trigger))
+    {
+        return STD_NOK;
+    }
+
+    // A shift of the whole sum width or more would zero every result
+    Local_u8SumBits = MADC_RESOLUTION_BITS(Copy_pConfig->Resolution);
+    for (Local_u8Index = 1; Local_u8Index < Copy_pConfig->Oversample; Local_u8Index <<= 1)
+    {
+        Local_u8SumBits++;
+    }
+    if (Copy_pConfig->OversampleShift >= Local_u8SumBits)
+    {
+        return STD_NOK;
+    }
+
+    // Clock: PCLK2 / 2, 4, 6 or 8
+    Local_u32Pclk = MRCC_u32GetAPB2ClockFreq();
+    while ((Local_u32Prescaler < ADCPRE_MAX) && ((Local_u32Pclk / (2 * (Local_u32Prescaler + 1))) > MADC_MAX_CLOCK))
+    {
+        Local_u32Prescaler++;
+    }
+    Local_u32AdcClock = Local_u32Pclk / (2 * (Local_u32Prescaler + 1));
+
+    // Sampling cycles covering SampleNs, rounded up
+    Local_u32Cycles = (u32)((((u64)Copy_pConfig->SampleNs * Local_u32AdcClock) + 999999999ULL) / 1000000000ULL);
+    while ((Local_u8Code < MADC_SAMPLE_CODES) && (Global_u16SampleCycles[Local_u8Code] < Local_u32Cycles))
+    {
+        Local_u8Code++;
+    }
+    if (Local_u8Code == MADC_SAMPLE_CODES)
+    {
+        return STD_NOK;
+    }
+
+    for (Local_u8Index = 0; Local_u8Index < Copy_pConfig->Count; Local_u8Index++)
+    {
+        Local_u8Channel = Copy_pConfig->Channels[Local_u8Index];
+        if (Local_u8Channel > MADC_MAX_CHANNEL)
+        {
+            return STD_NOK;
+        }
+        if (Local_u8Channel < SMPR2_CHANNELS)
+        {
+            Local_u32SMPR2 |= (u32)Local_u8Code << (Local_u8Channel * SMPR_BITS);
+        }
+        else
+        {
+            Local_u32SMPR1 |= (u32)Local_u8Code << ((Local_u8Channel - SMPR2_CHANNELS) * SMPR_BITS);
+        }
+        Local_u32SQR[Local_u8Index / SQR_CONVERSIONS] |= (u32)Local_u8Channel << ((Local_u8Index % SQR_CONVERSIONS) * SQR_BITS);
+    }
+    Local_u32SQR[2] |= (u32)(Copy_pConfig->Count - 1) << SQR1_L;
+
+    MRCC_voidEnableVendorPerphiral(APB2, APB2_ADC1EN);
+    ADC1->CR2 = 0;
+    Global_State.Running = FALSE;
+
+    // Stops the stream of a previous run, unless it belongs to another driver
+    Local_DmaConfig.IrqGroup = Copy_pConfig->IrqGroup;
+    Local_DmaConfig.IrqSubGroup = Copy_pConfig->IrqSubGroup;
+    if (MDMA_u8Init(Global_Dma.Controller, Global_Dma.Stream, &Local_DmaConfig) == STD_NOK)
+    {
+        return STD_NOK;
+    }
+    MDMA_voidSetCallback(Global_Dma.Controller, Global_Dma.Stream, MDMA_EVENT_HALF, MADC_voidOnHalf, NULL);
+    MDMA_voidSetCallback(Global_Dma.Controller, Global_Dma.Stream, MDMA_EVENT_FULL, MADC_voidOnFull, NULL);
+    MDMA_voidSetCallback(Global_Dma.Controller, Global_Dma.Stream, MDMA_EVENT_ERROR, MADC_voidOnDmaError, NULL);
+
+    ADC_COMMON->CCR = (ADC_COMMON->CCR & ~(ADCPRE_MAX << CCR_ADCPRE)) | (Local_u32Prescaler << CCR_ADCPRE);
+    ADC1->CR1 = (1UL << CR1_SCAN) | ((u32)Copy_pConfig->Resolution << CR1_RES) | (1UL << CR1_OVRIE);
+    ADC1->SMPR1 = Local_u32SMPR1;
+    ADC1->SMPR2 = Local_u32SMPR2;
+    ADC1->SQR3 = Local_u32SQR[0];
+    ADC1->SQR2 = Local_u32SQR[1];
+    ADC1->SQR1 = Local_u32SQR[2];
+    ADC1->SR = 0;
+
+    // DMA requests after every conversion, the stream never ends
+    Global_State.CR2 = (1UL << CR2_DMA) | (1UL << CR2_DDS);
+    if (Copy_pConfig->Trigger == MADC_FREE_RUNNING)
+    {
+        SET_BIT(Global_State.CR2, CR2_CONT);
+    }
+    else
+    {
+        Global_State.CR2 |= (EXTEN_RISING << CR2_EXTEN) | ((u32)Copy_pConfig->Trigger << CR2_EXTSEL);
+    }
+
+    Global_State.Count = Copy_pConfig->Count;
+    Global_State.Oversample = Copy_pConfig->Oversample;
+    Global_State.Shift = Copy_pConfig->OversampleShift;
+    Global_State.Rate = Local_u32AdcClock / (Global_u16SampleCycles[Local_u8Code] + 12UL - (2UL * Copy_pConfig->Resolution));
+    Global_State.Overruns = 0;
+
+    MNVIC_voidSetInterruptPriority(ADC_IRQ_NUMBER, Copy_pConfig->IrqGroup, Copy_pConfig->IrqSubGroup);
+    MNVIC_voidSetEnablePeripheralInterrupt(ADC_IRQ_NUMBER);
+    return STD_OK;
+}
+
+/**
+ * @brief Start the conversions into the ping and pong buffers.
+ *
+ * @return u8: STD_OK, or STD_NOK for invalid buffers or sizes.
+ */
+u8 MADC_u8Start(u16 *Copy_pu16Ping, u16 *Copy_pu16Pong, u16 Copy_u16Sequences,
+                MADC_BlockHandler_t pfHandler, void *pvContext)
+{
+    if ((Copy_pu16Ping == NULL) || (Copy_pu16Pong == NULL) || (pfHandler == NULL) || (Global_State.Count == 0)
+        || (Copy_u16Sequences == 0) || ((Copy_u16Sequences % (2U * Global_State.Oversample)) != 0)
+        || (((u32)Copy_u16Sequences * Global_State.Count) > 0xFFFFUL))
+    {
+        return STD_NOK;
+    }
+
+    MADC_voidStop();
+    Global_State.Buffers[0] = Copy_pu16Ping;
+    Global_State.Buffers[1] = Copy_pu16Pong;
+    Global_State.Sequences = Copy_u16Sequences;
+    Global_State.pfHandler = pfHandler;
+    Global_State.pvContext = pvContext;
+    Global_State.Running = TRUE;
+
+    // Power up first: the ADC needs MADC_STAB_US before its first conversion
+    ADC1->CR2 = (1UL << CR2_ADON);
+    MDWT_voidDelayUs(MADC_STAB_US);
+    ADC1->SR = 0;
+    MADC_voidLaunch();
+    return STD_OK;
+}
+
+/**
+ * @brief Stop the conversions and the DMA stream.
+ */
+void MADC_voidStop(void)
+{
+    Global_State.Running = FALSE;
+    ADC1->CR2 = 0;
+    MDMA_voidStop(Global_Dma.Controller, Global_Dma.Stream);
+}
+
+/**
+ * @brief Get the free-running conversion rate.
+ */
+u32 MADC_u32GetConversionRate(void)
+{
+    return Global_State.Rate;
+}
+
+/**
+ * @brief Get the restarts after an overrun or a DMA error.
+ */
+u32 MADC_u32GetOverruns(void)
+{
+    return Global_State.Overruns;
+}
+
+/**
+ * @brief Sum groups of consecutive sequences in place.
+ *
+ * Channel pairs are summed with one saturating dual 16-bit add per sequence
+ * (QADD16 on the Cortex-M4). 8 results of 12 bits stay below 2^15, so the
+ * saturation never triggers. Each group is read before its result is
+ * written, at or before the group start, so the block can be its own output.
+ *
+ * @return u16: Sequences left in the block.
+ */
+u16 MADC_u16Oversample(u16 *Copy_pu16Block, u16 Copy_u16Sequences, u8 Copy_u8Count, u8 Copy_u8Factor, u8 Copy_u8Shift)
+{
+    const u16 *Local_pu16In = Copy_pu16Block;
+    u16 *Local_pu16Out = Copy_pu16Block;
+    u16 Local_u16Groups = Copy_u16Sequences / Copy_u8Factor;
+    u16 Local_u16Group;
+    u32 Local_u32Sum;
+    u8 Local_u8Channel;
+    u8 Local_u8Sequence;
+
+    for (Local_u16Group = 0; Local_u16Group < Local_u16Groups; Local_u16Group++)
+    {
+        for (Local_u8Channel = 0; (Local_u8Channel + 1) < Copy_u8Count; Local_u8Channel += 2)
+        {
+            Local_u32Sum = DSP_u32Read2((const q15 *)&Local_pu16In[Local_u8Channel]);
+            for (Local_u8Sequence = 1; Local_u8Sequence < Copy_u8Factor; Local_u8Sequence++)
+            {
+                Local_u32Sum = DSP_u32Qadd16(Local_u32Sum,
+                                             DSP_u32Read2((const q15 *)&Local_pu16In[((u32)Local_u8Sequence * Copy_u8Count) + Local_u8Channel]));
+            }
+            Local_pu16Out[Local_u8Channel] = (u16)((Local_u32Sum & 0xFFFFUL) >> Copy_u8Shift);
+            Local_pu16Out[Local_u8Channel + 1] = (u16)((Local_u32Sum >> 16) >> Copy_u8Shift);
+        }
+        if (Local_u8Channel < Copy_u8Count)
+        {
+            // Odd channel count: the last one alone
+            Local_u32Sum = 0;
+            for (Local_u8Sequence = 0; Local_u8Sequence < Copy_u8Factor; Local_u8Sequence++)
+            {
+                Local_u32Sum += Local_pu16In[((u32)Local_u8Sequence * Copy_u8Count) + Local_u8Channel];
+            }
+            Local_pu16Out[Local_u8Channel] = (u16)(Local_u32Sum >> Copy_u8Shift);
+        }
+        Local_pu16In += (u32)Copy_u8Factor * Copy_u8Count;
+        Local_pu16Out += Copy_u8Count;
+    }
+    return Local_u16Groups;
+}
+
+/****************************************************/
+/* INTERRUPT HANDLERS                               */
+/****************************************************/
+
+#if MADC_HANDLER == ENABLE
+void ADC_IRQHandler(void)
+{
+    if (GET_BIT(ADC1->SR, SR_OVR) != 0)
+    {
+        MADC_voidRecover();
+    }
+}
+#endif
@@ -0,0 +1,49 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MADC_REGISTER_H_
+#define MADC_REGISTER_H_
+
+/* Base addresses of ADC1 and of the registers common to the ADCs (APB2) */
+#define ADC1_BASE_ADDRESS       0x40012000
+#define ADC_COMMON_BASE_ADDRESS 0x40012300
+
+/**
+ * @brief Structure representing the ADC registers.
+ */
+typedef struct
+{
+    u32 SR;         /**< Status Register */
+    u32 CR1;        /**< Control Register 1 */
+    u32 CR2;        /**< Control Register 2 */
+    u32 SMPR1;      /**< Sample Time Register 1 (channels 10 to 18) */
+    u32 SMPR2;      /**< Sample Time Register 2 (channels 0 to 9) */
+    u32 JOFR[4];    /**< Injected Channel Data Offset Registers */
+    u32 HTR;        /**< Watchdog Higher Threshold Register */
+    u32 LTR;        /**< Watchdog Lower Threshold Register */
+    u32 SQR1;       /**< Regular Sequence Register 1 (conversions 13 to 16, length) */
+    u32 SQR2;       /**< Regular Sequence Register 2 (conversions 7 to 12) */
+    u32 SQR3;       /**< Regular Sequence Register 3 (conversions 1 to 6) */
+    u32 JSQR;       /**< Injected Sequence Register */
+    u32 JDR[4];     /**< Injected Data Registers */
+    u32 DR;         /**< Regular Data Register */
+} ADC_t;
+
+/**
+ * @brief Structure representing the registers common to the ADCs.
+ */
+typedef struct
+{
+    u32 CSR;        /**< Common Status Register */
+    u32 CCR;        /**< Common Control Register */
+    u32 CDR;        /**< Common Regular Data Register (dual and triple modes) */
+} ADC_Common_t;
+
+#define ADC1        ((volatile ADC_t*)ADC1_BASE_ADDRESS)
+#define ADC_COMMON  ((volatile ADC_Common_t*)ADC_COMMON_BASE_ADDRESS)
+
+#endif /* MADC_REGISTER_H_ */
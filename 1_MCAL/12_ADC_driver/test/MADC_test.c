@@ -0,0 +1,227 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MADC_test.c                      */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the ADC driver, built with the Makefile next to it.
+ *
+ * The driver is compiled in with the RCC, NVIC, DMA and DWT drivers stubbed;
+ * the tests only run code that leaves the registers alone. What runs on the
+ * host: MADC_u16Oversample against a plain per-channel sum, in place, for
+ * 1 to 5 channels (odd counts end on a channel summed alone), factors 1, 2,
+ * 4 and 8, every shift the sum width allows, on random 12-bit samples and
+ * on a block at full scale (0xFFF), the largest sums the dual 16-bit adds
+ * have to carry without saturating. The dual add itself is the portable one
+ * from DSP.h; the QADD16 form is only built for the target. */
+
+#include "STD_TYPES.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "MADC_program.c"
+
+/****************************************************/
+/* STUBS                                            */
+/****************************************************/
+
+void MRCC_voidEnableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t Copy_enuPerphiralID)
+{
+    (void)Copy_enuBus;
+    (void)Copy_enuPerphiralID;
+}
+
+u32 MRCC_u32GetAPB2ClockFreq(void)
+{
+    return 84000000UL;
+}
+
+void MNVIC_voidSetEnablePeripheralInterrupt(u8 Copy_u8IDX)
+{
+    (void)Copy_u8IDX;
+}
+
+void MNVIC_voidSetInterruptPriority(u8 Copy_IDX, u8 GroupNum, u8 SubGroup)
+{
+    (void)Copy_IDX;
+    (void)GroupNum;
+    (void)SubGroup;
+}
+
+void MDWT_voidDelayUs(u32 Copy_u32Us)
+{
+    (void)Copy_u32Us;
+}
+
+u8 MDMA_u8Init(u8 Copy_u8Controller, u8 Copy_u8Stream, const MDMA_StreamConfig_t *Copy_pConfig)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)Copy_pConfig;
+    return STD_OK;
+}
+
+void MDMA_voidSetCallback(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Event,
+                          CallBackFn_t pfHandler, void *pvContext)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)Copy_u8Event;
+    (void)pfHandler;
+    (void)pvContext;
+}
+
+u8 MDMA_u8Start(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32PeriphAddr,
+                u32 Copy_u32Mem0Addr, u32 Copy_u32Mem1Addr, u16 Copy_u16Count)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)Copy_u32PeriphAddr;
+    (void)Copy_u32Mem0Addr;
+    (void)Copy_u32Mem1Addr;
+    (void)Copy_u16Count;
+    return STD_OK;
+}
+
+u8 MDMA_u8GetCurrentBuffer(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    return 0;
+}
+
+void MDMA_voidStop(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+}
+
+/****************************************************/
+/* TESTS                                            */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#define TEST_SEQUENCES      64
+#define TEST_MAX_CHANNELS   5
+#define TEST_FULL_SCALE     0xFFFU
+
+/* Per-channel sum of each group of Copy_u8Factor sequences, shifted */
+static void Ref_voidOversample(const u16 *Copy_pu16In, u16 *Copy_pu16Out, u16 Copy_u16Sequences,
+                               u8 Copy_u8Count, u8 Copy_u8Factor, u8 Copy_u8Shift)
+{
+    u16 Local_u16Group;
+    u8 Local_u8Channel;
+    u8 Local_u8Sequence;
+    u32 Local_u32Sum;
+
+    for (Local_u16Group = 0; Local_u16Group < (Copy_u16Sequences / Copy_u8Factor); Local_u16Group++)
+    {
+        for (Local_u8Channel = 0; Local_u8Channel < Copy_u8Count; Local_u8Channel++)
+        {
+            Local_u32Sum = 0;
+            for (Local_u8Sequence = 0; Local_u8Sequence < Copy_u8Factor; Local_u8Sequence++)
+            {
+                Local_u32Sum += Copy_pu16In[(((u32)Local_u16Group * Copy_u8Factor) + Local_u8Sequence) * Copy_u8Count + Local_u8Channel];
+            }
+            Copy_pu16Out[((u32)Local_u16Group * Copy_u8Count) + Local_u8Channel] = (u16)(Local_u32Sum >> Copy_u8Shift);
+        }
+    }
+}
+
+/* One block through MADC_u16Oversample, checked against the reference.
+ * Copy_u8Random FALSE fills it at full scale. */
+static void Test_voidBlock(u8 Copy_u8Count, u8 Copy_u8Factor, u8 Copy_u8Shift, u8 Copy_u8Random)
+{
+    static u16 Local_u16Block[TEST_SEQUENCES * TEST_MAX_CHANNELS];
+    static u16 Local_u16Input[TEST_SEQUENCES * TEST_MAX_CHANNELS];
+    static u16 Local_u16Expected[TEST_SEQUENCES * TEST_MAX_CHANNELS];
+    u32 Local_u32Samples = (u32)TEST_SEQUENCES * Copy_u8Count;
+    u32 Local_u32Idx;
+    u16 Local_u16Groups;
+
+    for (Local_u32Idx = 0; Local_u32Idx < Local_u32Samples; Local_u32Idx++)
+    {
+        Local_u16Input[Local_u32Idx] = (Copy_u8Random == TRUE) ? (u16)(rand() & TEST_FULL_SCALE) : (u16)TEST_FULL_SCALE;
+        Local_u16Block[Local_u32Idx] = Local_u16Input[Local_u32Idx];
+    }
+    Ref_voidOversample(Local_u16Input, Local_u16Expected, TEST_SEQUENCES, Copy_u8Count, Copy_u8Factor, Copy_u8Shift);
+
+    Local_u16Groups = MADC_u16Oversample(Local_u16Block, TEST_SEQUENCES, Copy_u8Count, Copy_u8Factor, Copy_u8Shift);
+    CHECK(Local_u16Groups == (TEST_SEQUENCES / Copy_u8Factor), "%u channels x%u: %u sequences left",
+          Copy_u8Count, Copy_u8Factor, Local_u16Groups);
+
+    for (Local_u32Idx = 0; Local_u32Idx < ((u32)Local_u16Groups * Copy_u8Count); Local_u32Idx++)
+    {
+        if (Local_u16Block[Local_u32Idx] != Local_u16Expected[Local_u32Idx])
+        {
+            CHECK(0, "%u channels x%u >> %u%s: result %lu is 0x%04X, expected 0x%04X", Copy_u8Count, Copy_u8Factor,
+                  Copy_u8Shift, (Copy_u8Random == TRUE) ? "" : " (full scale)", (unsigned long)Local_u32Idx,
+                  Local_u16Block[Local_u32Idx], Local_u16Expected[Local_u32Idx]);
+            break;
+        }
+    }
+}
+
+static void Test_voidOversample(void)
+{
+    static const u8 Local_u8Factors[] = { 1, 2, 4, 8 };
+    u8 Local_u8Count, Local_u8Factor, Local_u8Log2, Local_u8Shift;
+
+    for (Local_u8Count = 1; Local_u8Count <= TEST_MAX_CHANNELS; Local_u8Count++)
+    {
+        for (Local_u8Factor = 0; Local_u8Factor < sizeof(Local_u8Factors); Local_u8Factor++)
+        {
+            // Shifts below the sum width: 12 bits plus log2 of the factor
+            Local_u8Log2 = (u8)__builtin_ctz(Local_u8Factors[Local_u8Factor]);
+            for (Local_u8Shift = 0; Local_u8Shift < (12 + Local_u8Log2); Local_u8Shift++)
+            {
+                Test_voidBlock(Local_u8Count, Local_u8Factors[Local_u8Factor], Local_u8Shift, TRUE);
+                Test_voidBlock(Local_u8Count, Local_u8Factors[Local_u8Factor], Local_u8Shift, FALSE);
+            }
+        }
+    }
+}
+
+/* Full scale summed 8 times is 32760, kept whole without shift */
+static void Test_voidFullScale(void)
+{
+    u16 Local_u16Block[8 * 3];
+    u8 Local_u8Idx;
+
+    for (Local_u8Idx = 0; Local_u8Idx < (8 * 3); Local_u8Idx++)
+    {
+        Local_u16Block[Local_u8Idx] = TEST_FULL_SCALE;
+    }
+    CHECK(MADC_u16Oversample(Local_u16Block, 8, 3, 8, 0) == 1, "full scale x8: not one sequence left");
+    CHECK((Local_u16Block[0] == (8 * TEST_FULL_SCALE)) && (Local_u16Block[1] == (8 * TEST_FULL_SCALE))
+          && (Local_u16Block[2] == (8 * TEST_FULL_SCALE)),
+          "full scale x8: %u %u %u, expected %u", Local_u16Block[0], Local_u16Block[1], Local_u16Block[2],
+          8 * TEST_FULL_SCALE);
+
+    for (Local_u8Idx = 0; Local_u8Idx < (8 * 3); Local_u8Idx++)
+    {
+        Local_u16Block[Local_u8Idx] = TEST_FULL_SCALE;
+    }
+    // x4 >> 2 gives the 12-bit full scale back
+    CHECK(MADC_u16Oversample(Local_u16Block, 8, 3, 4, 2) == 2, "full scale x4: not two sequences left");
+    for (Local_u8Idx = 0; Local_u8Idx < (2 * 3); Local_u8Idx++)
+    {
+        CHECK(Local_u16Block[Local_u8Idx] == TEST_FULL_SCALE, "full scale x4 >> 2: result %u is %u",
+              Local_u8Idx, Local_u16Block[Local_u8Idx]);
+    }
+}
+
+int main(void)
+{
+    srand(1);
+
+    Test_voidOversample();
+    Test_voidFullScale();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : RCC_clock.h                      */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+
+#ifndef MRCC_CLOCK_H
+#define MRCC_CLOCK_H
+
+
+/*** Clock tree frequencies computed at compile time from MRCC_config.h,
+ *** for drivers that need constant timing values (no register reads).
+ *** MRCC_u32Get...ClockFreq() read the live values instead. ***/
+
+#include "MRCC_private.h"
+#include "MRCC_config.h"
+
+
+/* divisors of the AHB and APB prescaler codes */
+#define MRCC_AHB_DIVISOR(CODE)	( (((CODE) & AHB_PRESCALER_DIVIDED_FLAG) == 0) ? 1UL :			\
+								  (((CODE) & 0b0100) != 0) ? (64UL << ((CODE) & 0b11)) :	\
+															 (2UL << ((CODE) & 0b11)) )
+#define MRCC_APB_DIVISOR(CODE)	( (((CODE) & APB_PRESCALER_DIVIDED_FLAG) == 0) ? 1UL : (2UL << ((CODE) & 0b11)) )
+
+
+/* PLL output: source * N / M / P, multiplied first in 64 bits like
+ * MRCC_u32GetSystemClockFreq, so both agree when the source is not a whole
+ * multiple of M (source * N reaches 2^34, beyond 32 bits) */
+#define MRCC_PLL_HZ(SOURCE_HZ)	( ((SOURCE_HZ) * 1ULL * PLL_N_MULTIPLICATION_FACTOR) / PLL_M_DIVISION_FACTOR / PLL_P_DIVISION_FACTOR )
+
+/* System clock */
+#if RCC_CLOCK_SOURCE_TYPE == HSI_CLOCK_SOURCE
+#define MRCC_SYSCLK_HZ		(HSI_CLOCK_FREQUENCY_HZ)
+#elif RCC_CLOCK_SOURCE_TYPE == HSE_CLOCK_SOURCE
+#define MRCC_SYSCLK_HZ		(HSE_CLOCK_FREQUENCY_HZ)
+#elif RCC_CLOCK_SOURCE_TYPE == PLL_HSI_CLOCK_SOURCE
+#define MRCC_SYSCLK_HZ		MRCC_PLL_HZ(HSI_CLOCK_FREQUENCY_HZ)
+#elif RCC_CLOCK_SOURCE_TYPE == PLL_HSE_CLOCK_SOURCE
+#define MRCC_SYSCLK_HZ		MRCC_PLL_HZ(HSE_CLOCK_FREQUENCY_HZ)
+#else
+#error "Wrong RCC_CLOCK_SOURCE_TYPE configuration"
+#endif
+
+#define MRCC_AHB_CLOCK_HZ	(MRCC_SYSCLK_HZ / MRCC_AHB_DIVISOR(AHB_PRESCALER))
+#define MRCC_APB1_CLOCK_HZ	(MRCC_AHB_CLOCK_HZ / MRCC_APB_DIVISOR(APB1_PRESCALER))
+#define MRCC_APB2_CLOCK_HZ	(MRCC_AHB_CLOCK_HZ / MRCC_APB_DIVISOR(APB2_PRESCALER))
+
+
+/* limits of the STM32F401 clock tree (datasheet) */
+#if MRCC_SYSCLK_HZ > 84000000UL
+#error "System clock above 84 MHz, check the PLL factors"
+#endif
+#if MRCC_APB1_CLOCK_HZ > 42000000UL
+#error "APB1 clock above 42 MHz, check APB1_PRESCALER"
+#endif
+
+
+#endif // MRCC_CLOCK_H
@@ -25,6 +25,10 @@
  * */
 #define HSE_CLOCK_SIGNAL_GENERATOR	HSE_CRYSTAL_CERAMIC_RESNATOR_CLOCK_SIGNAL
 
+/* Frequency of the crystal or the external clock connected to OSC_IN in Hz
+ * Values must be in the range 4 MHz to 26 MHz (crystal) or up to 50 MHz (external clock) */
+#define HSE_CLOCK_FREQUENCY_HZ		(25000000UL)
+
 
 /* PLL Configratutions Parameters
  * M Division Factor
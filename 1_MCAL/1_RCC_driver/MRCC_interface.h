@@ -104,4 +104,44 @@ void MRCC_voidEnableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t C
  **/
 void MRCC_voidDisableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t Copy_enuPerphiralID);
 
+
+/* @brief Get the system clock frequency
+ *
+ * This function reads the clock source in use, and the PLL factors if the PLL is
+ * selected, back from the RCC registers and computes the SYSCLK frequency
+ *
+ * @param void
+ *
+ * @return u32	the system clock frequency in Hz, 0 if the PLL is selected
+ *				with reserved M or N factors
+ **/
+u32 MRCC_u32GetSystemClockFreq(void);
+
+
+/* @brief Get the AHB clock frequency (HCLK, feeds the core and SysTick)
+ *
+ * @param void
+ *
+ * @return u32	the AHB clock frequency in Hz
+ **/
+u32 MRCC_u32GetAHBClockFreq(void);
+
+
+/* @brief Get the APB1 clock frequency (PCLK1)
+ *
+ * @param void
+ *
+ * @return u32	the APB1 clock frequency in Hz
+ **/
+u32 MRCC_u32GetAPB1ClockFreq(void);
+
+
+/* @brief Get the APB2 clock frequency (PCLK2)
+ *
+ * @param void
+ *
+ * @return u32	the APB2 clock frequency in Hz
+ **/
+u32 MRCC_u32GetAPB2ClockFreq(void);
+
 #endif // MRCC_INTERFACE_H
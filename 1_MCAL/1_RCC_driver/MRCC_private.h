@@ -43,6 +43,25 @@
 
 /* Implementation Specific */
 
+/* Frequency of the internal RC oscillator */
+#define HSI_CLOCK_FREQUENCY_HZ		(16000000UL)
+
+/* macros for reading the clock tree back from RCC_CFGR and RCC_PLLCFGR */
+#define SWS_START_BIT				(2)
+#define SWS_HSI						(0b00)
+#define SWS_HSE						(0b01)
+#define SWS_PLL						(0b10)
+#define PLL_P_FACTOR(PLLP_BITS)		( ((PLLP_BITS) + 1) * 2 )
+/* valid PLLM and PLLN ranges (RM0368), other codes are a wrong configuration */
+#define PLL_M_MIN					(2)
+#define PLL_N_MIN					(50)
+#define PLL_N_MAX					(432)
+
+/* AHB prescaler codes 0b1000 to 0b1111 divide by 2, 4, 8, 16, 64, 128, 256, 512 */
+#define AHB_PRESCALER_DIVIDED_FLAG	(0b1000)
+/* APB prescaler codes 0b100 to 0b111 divide by 2, 4, 8, 16 */
+#define APB_PRESCALER_DIVIDED_FLAG	(0b100)
+
 /* NOT_READY is used when polling on the ready flags of the clock sources */
 #define NOT_READY 	0
 
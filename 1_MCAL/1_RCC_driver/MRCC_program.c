@@ -175,18 +175,87 @@ void MRCC_voidInitSystemClock(void) {
 
 void MRCC_voidEnableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t Copy_enuPerphiralID) {
 	switch(Copy_enuBus) {
-	case AHB1: SET_BIT(RCC_AHB1ENR, Copy_enuPerphiralID);	break;
-	case AHB2: SET_BIT(RCC_AHB2ENR, Copy_enuPerphiralID);	break;
-	case APB1: SET_BIT(RCC_APB1ENR, Copy_enuPerphiralID);	break;
-	case APB2: SET_BIT(RCC_APB2ENR, Copy_enuPerphiralID);	break;
+	case AHB1: BITBAND_SET_BIT(RCC_AHB1ENR, Copy_enuPerphiralID);	break;
+	case AHB2: BITBAND_SET_BIT(RCC_AHB2ENR, Copy_enuPerphiralID);	break;
+	case APB1: BITBAND_SET_BIT(RCC_APB1ENR, Copy_enuPerphiralID);	break;
+	case APB2: BITBAND_SET_BIT(RCC_APB2ENR, Copy_enuPerphiralID);	break;
 	}
 }
 
 void MRCC_voidDisableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t Copy_enuPerphiralID) {
 	switch(Copy_enuBus) {
-	case AHB1: CLR_BIT(RCC_AHB1ENR, Copy_enuPerphiralID);	break;
-	case AHB2: CLR_BIT(RCC_AHB2ENR, Copy_enuPerphiralID);	break;
-	case APB1: CLR_BIT(RCC_APB1ENR, Copy_enuPerphiralID);	break;
-	case APB2: CLR_BIT(RCC_APB2ENR, Copy_enuPerphiralID);	break;
+	case AHB1: BITBAND_CLR_BIT(RCC_AHB1ENR, Copy_enuPerphiralID);	break;
+	case AHB2: BITBAND_CLR_BIT(RCC_AHB2ENR, Copy_enuPerphiralID);	break;
+	case APB1: BITBAND_CLR_BIT(RCC_APB1ENR, Copy_enuPerphiralID);	break;
+	case APB2: BITBAND_CLR_BIT(RCC_APB2ENR, Copy_enuPerphiralID);	break;
 	}
 }
+
+u32 MRCC_u32GetSystemClockFreq(void) {
+	u32 Local_u32Freq = HSI_CLOCK_FREQUENCY_HZ;
+	u32 Local_u32PllCfg, Local_u32PllM, Local_u32PllN;
+
+	switch((RCC_CFGR >> SWS_START_BIT) & MASKING_TWO_BITS) {
+	case SWS_HSI:
+		Local_u32Freq = HSI_CLOCK_FREQUENCY_HZ;
+		break;
+
+	case SWS_HSE:
+		Local_u32Freq = HSE_CLOCK_FREQUENCY_HZ;
+		break;
+
+	case SWS_PLL:
+		Local_u32PllCfg = RCC_PLLCFGR;
+		Local_u32Freq = (GET_BIT(Local_u32PllCfg, PLLSRC) != 0) ? HSE_CLOCK_FREQUENCY_HZ : HSI_CLOCK_FREQUENCY_HZ;
+		Local_u32PllM = (Local_u32PllCfg >> PLL_M_DIVISION_FACTOR_START_BIT) & MASKING_SIX_BITS;
+		Local_u32PllN = (Local_u32PllCfg >> PLL_N_MULTIPLICATION_FACTOR_START_BIT) & MASKING_NINE_BITS;
+
+		if((Local_u32PllM < PLL_M_MIN) || (Local_u32PllN < PLL_N_MIN) || (Local_u32PllN > PLL_N_MAX)) {
+			/* reserved PLL factors, the frequency is unknown */
+			Local_u32Freq = 0;
+		} else {
+			/* SYSCLK = source * N / M / P, multiplied first in 64 bits so an
+			 * input that is not a whole multiple of M loses no precision */
+			Local_u32Freq = (u32)(((u64)Local_u32Freq * Local_u32PllN) / Local_u32PllM
+			                      / PLL_P_FACTOR((Local_u32PllCfg >> PLL_P_DIVISION_FACTOR_START_BIT) & MASKING_TWO_BITS));
+		}
+		break;
+	}
+
+	return Local_u32Freq;
+}
+
+u32 MRCC_u32GetAHBClockFreq(void) {
+	/* shift applied for the AHB prescaler codes 0b1000 to 0b1111 (64 skips 32) */
+	static const u8 Local_au8AHBShift[8] = {1, 2, 3, 4, 6, 7, 8, 9};
+	u32 Local_u32Code = (RCC_CFGR >> AHB_PRESCALER_START_BIT) & MASKING_FOUR_BITS;
+	u32 Local_u32Freq = MRCC_u32GetSystemClockFreq();
+
+	if(Local_u32Code & AHB_PRESCALER_DIVIDED_FLAG) {
+		Local_u32Freq >>= Local_au8AHBShift[Local_u32Code & ~AHB_PRESCALER_DIVIDED_FLAG];
+	}
+
+	return Local_u32Freq;
+}
+
+u32 MRCC_u32GetAPB1ClockFreq(void) {
+	u32 Local_u32Code = (RCC_CFGR >> APB1_PRESCALER_START_BIT) & MASKING_THREE_BITS;
+	u32 Local_u32Freq = MRCC_u32GetAHBClockFreq();
+
+	if(Local_u32Code & APB_PRESCALER_DIVIDED_FLAG) {
+		Local_u32Freq >>= (Local_u32Code & ~APB_PRESCALER_DIVIDED_FLAG) + 1;
+	}
+
+	return Local_u32Freq;
+}
+
+u32 MRCC_u32GetAPB2ClockFreq(void) {
+	u32 Local_u32Code = (RCC_CFGR >> APB2_PRESCALER_START_BIT) & MASKING_THREE_BITS;
+	u32 Local_u32Freq = MRCC_u32GetAHBClockFreq();
+
+	if(Local_u32Code & APB_PRESCALER_DIVIDED_FLAG) {
+		Local_u32Freq >>= (Local_u32Code & ~APB_PRESCALER_DIVIDED_FLAG) + 1;
+	}
+
+	return Local_u32Freq;
+}
@@ -70,6 +70,26 @@ typedef enum {
 	GPIO_VOLT_LEVEL_HIGH,
 } EN_GpioVoltLevel_t;
 
+/* Mapping Gpio alternate functions into numeric values (AF0 to AF15 of the datasheet pin table) */
+typedef enum {
+	GPIO_AF00 = 0,
+	GPIO_AF01,
+	GPIO_AF02,
+	GPIO_AF03,
+	GPIO_AF04,
+	GPIO_AF05,
+	GPIO_AF06,
+	GPIO_AF07,
+	GPIO_AF08,
+	GPIO_AF09,
+	GPIO_AF10,
+	GPIO_AF11,
+	GPIO_AF12,
+	GPIO_AF13,
+	GPIO_AF14,
+	GPIO_AF15,
+} EN_GpioAltFunc_t;
+
 
 /* @brief configure the pin as general purpose output
  *
@@ -158,6 +178,21 @@ void MGPIO_voidSetPinOSpeed(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_Gpi
 void MGPIO_voidSetPinPUPD(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioPUPD_t PUPD);
 
 
+/* @brief connect the pin to a peripheral through its alternate function.
+ *
+ * This function selects the alternate function of the pin (e.g. AF7 for USART1/USART2 TX and RX)
+ * then switches the pin to alternate function mode, so the peripheral drives it from the first edge.
+ * The output type, speed and pull resistors are set with their own functions.
+ *
+ * @param EN_GpioPortNo_t	the port number for the specified pin.
+ * 		  EN_GpioPinNo_t	the specified pin number.
+ *		  EN_GpioAltFunc_t  the alternate function of the specified pin
+ *
+ * @return void
+ **/
+void MGPIO_voidSetPinAltFunc(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioAltFunc_t AltFunc);
+
+
 /* @brief sets the output pin to voltage level
  *
  * This function is used to output level low or level high to an general purpose output pin (push pull, or open drain)
@@ -198,6 +233,32 @@ void MGPIO_voidGetPinValue(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_Gpio
  **/
 void MGPIO_voidTogglePinValue(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo);
 
+
+/* @brief gets the input levels of all the pins of a port.
+ *
+ * This function reads the input data register of a port once, so the levels
+ * of several pins are sampled at the same instant.
+ *
+ * @param EN_GpioPortNo_t		 the port number.
+ *
+ * @return u16	the levels of the 16 pins (bit n <=> pin n).
+ **/
+u16 MGPIO_u16GetPortValue(EN_GpioPortNo_t PortNo);
+
+/* @brief sets and resets pins of a port in one store.
+ *
+ * This function writes the bit set/reset register of the port, so the pins change together in a
+ * single bus access that an interrupt cannot split, and the other pins of the port are never written
+ * (e.g. chip selects driven from interrupt context). A pin in both masks is set.
+ *
+ * @param EN_GpioPortNo_t		 the port number.
+ * 		  u16					 the pins to drive high (bit n <=> pin n).
+ * 		  u16					 the pins to drive low (bit n <=> pin n).
+ *
+ * @return void
+ **/
+void MGPIO_voidSetResetPins(EN_GpioPortNo_t PortNo, u16 SetMask, u16 ResetMask);
+
 /*********************************************************************/
 /******************* Extend The Functionality ************************/
 /*********************************************************************/
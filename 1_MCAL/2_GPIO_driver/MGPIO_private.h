@@ -12,6 +12,13 @@
 
 #define MASKING_ONE_BITS	(0b1)
 
+/* Used in the SetPinAltFunc API: 4 bits per pin, pins 0-7 in AFRL, pins 8-15 in AFRH */
+#define MASKING_FOUR_BITS				(0b1111)
+#define AFR_START_BIT(PIN)				( ((PIN) & 7) * 4 )
+
+/* Used in the SetResetPins API: BSRR bits 16-31 reset pins 0-15 */
+#define BSRR_RESET_START_BIT			(16)
+
 /* Used in the Set8PinsValue API */
 #define MASKING_EIGHT_BITS				(0xFF)
 #define PORT_LEVEL_PINS_START_BIT(X)	( (X) * 8 )
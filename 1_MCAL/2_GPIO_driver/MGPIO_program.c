@@ -45,17 +45,17 @@ void MGPIO_voidSetPinOType(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_Gpio
 	/* Set OType to Pin */
 	switch(PortNo) {
 	case GPIO_PORTA:
-		WRT_GROUP_OF_BITS(GPIOA_OTYPER, PinNo, OType, MASKING_ONE_BITS);
+		BITBAND(&GPIOA_OTYPER, PinNo) = OType;
 		break;
 
 
 	case GPIO_PORTB:
-		WRT_GROUP_OF_BITS(GPIOB_OTYPER, PinNo, OType, MASKING_ONE_BITS);
+		BITBAND(&GPIOB_OTYPER, PinNo) = OType;
 		break;
 
 
 	case GPIO_PORTC:
-		WRT_GROUP_OF_BITS(GPIOC_OTYPER, PinNo, OType, MASKING_ONE_BITS);
+		BITBAND(&GPIOC_OTYPER, PinNo) = OType;
 		break;
 	}
 
@@ -99,38 +99,90 @@ void MGPIO_voidSetPinPUPD(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioP
 	}
 }
 
+void MGPIO_voidSetPinAltFunc(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioAltFunc_t AltFunc) {
+	/* Set AltFunc to Pin, then hand the pin to the peripheral */
+	switch(PortNo) {
+	case GPIO_PORTA:
+		if (PinNo < GPIO_PIN08) {
+			WRT_GROUP_OF_BITS(GPIOA_AFRL, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		} else {
+			WRT_GROUP_OF_BITS(GPIOA_AFRH, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		}
+		break;
+
+
+	case GPIO_PORTB:
+		if (PinNo < GPIO_PIN08) {
+			WRT_GROUP_OF_BITS(GPIOB_AFRL, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		} else {
+			WRT_GROUP_OF_BITS(GPIOB_AFRH, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		}
+		break;
+
+
+	case GPIO_PORTC:
+		if (PinNo < GPIO_PIN08) {
+			WRT_GROUP_OF_BITS(GPIOC_AFRL, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		} else {
+			WRT_GROUP_OF_BITS(GPIOC_AFRH, AFR_START_BIT(PinNo), AltFunc, MASKING_FOUR_BITS);
+		}
+		break;
+	}
+	MGPIO_voidSetPinMode(PortNo, PinNo, GPIO_MODE_ALTERNATE_FUNCTION);
+}
+
 void MGPIO_voidGetPinValue(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioVoltLevel_t * P_enuVoltLevel) {
 	switch(PortNo) {
 	case GPIO_PORTA:
-		*P_enuVoltLevel = GET_BIT(GPIOA_IDR, PinNo);
+		*P_enuVoltLevel = BITBAND_GET_BIT(GPIOA_IDR, PinNo);
 		break;
 
 	case GPIO_PORTB:
-		*P_enuVoltLevel = GET_BIT(GPIOB_IDR, PinNo);
+		*P_enuVoltLevel = BITBAND_GET_BIT(GPIOB_IDR, PinNo);
 		break;
 
 	case GPIO_PORTC:
-		*P_enuVoltLevel = GET_BIT(GPIOC_IDR, PinNo);
+		*P_enuVoltLevel = BITBAND_GET_BIT(GPIOC_IDR, PinNo);
+		break;
+
+	}
+}
+
+u16 MGPIO_u16GetPortValue(EN_GpioPortNo_t PortNo) {
+	u16 Local_u16Value = 0;
+
+	switch(PortNo) {
+	case GPIO_PORTA:
+		Local_u16Value = (u16)GPIOA_IDR;
+		break;
+
+	case GPIO_PORTB:
+		Local_u16Value = (u16)GPIOB_IDR;
 		break;
 
+	case GPIO_PORTC:
+		Local_u16Value = (u16)GPIOC_IDR;
+		break;
 	}
+
+	return Local_u16Value;
 }
 
 void MGPIO_voidSetPinValue(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioVoltLevel_t VoltLevel) {
 	/* Set VoltLevel to Pin */
 	switch(PortNo) {
 	case GPIO_PORTA:
-		WRT_GROUP_OF_BITS(GPIOA_ODR, PinNo, VoltLevel, MASKING_ONE_BITS);
+		BITBAND(&GPIOA_ODR, PinNo) = VoltLevel;
 		break;
 
 
 	case GPIO_PORTB:
-		WRT_GROUP_OF_BITS(GPIOB_ODR, PinNo, VoltLevel, MASKING_ONE_BITS);
+		BITBAND(&GPIOB_ODR, PinNo) = VoltLevel;
 		break;
 
 
 	case GPIO_PORTC:
-		WRT_GROUP_OF_BITS(GPIOC_ODR, PinNo, VoltLevel, MASKING_ONE_BITS);
+		BITBAND(&GPIOC_ODR, PinNo) = VoltLevel;
 		break;
 	}
 }
@@ -149,15 +201,32 @@ void MGPIO_voidSetPinInput(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_Gpio
 void MGPIO_voidTogglePinValue(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo) {
 	switch(PortNo) {
 	case GPIO_PORTA:
-		TOG_BIT(GPIOA_ODR, PinNo);
+		BITBAND_TOGGLE_BIT(GPIOA_ODR, PinNo);
+		break;
+
+	case GPIO_PORTB:
+		BITBAND_TOGGLE_BIT(GPIOB_ODR, PinNo);
+		break;
+
+	case GPIO_PORTC:
+		BITBAND_TOGGLE_BIT(GPIOC_ODR, PinNo);
+		break;
+	}
+}
+
+void MGPIO_voidSetResetPins(EN_GpioPortNo_t PortNo, u16 SetMask, u16 ResetMask) {
+	/* BSRR: the low half sets, the high half resets, set wins */
+	switch(PortNo) {
+	case GPIO_PORTA:
+		GPIOA_BSRR = ((u32)ResetMask << BSRR_RESET_START_BIT) | SetMask;
 		break;
 
 	case GPIO_PORTB:
-		TOG_BIT(GPIOB_ODR, PinNo);
+		GPIOB_BSRR = ((u32)ResetMask << BSRR_RESET_START_BIT) | SetMask;
 		break;
 
 	case GPIO_PORTC:
-		TOG_BIT(GPIOC_ODR, PinNo);
+		GPIOC_BSRR = ((u32)ResetMask << BSRR_RESET_START_BIT) | SetMask;
 		break;
 	}
 }
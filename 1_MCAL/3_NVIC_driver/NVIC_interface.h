@@ -79,4 +79,21 @@ void MNVIC_voidSetGroupMode(MNVIC_GROUP_MODE_e Copy_Mode);
  */
 void MNVIC_voidSetInterruptPriority(u8 Copy_IDX, u8 GroupNum, u8 SubGroup);
 
+
+
+/**
+ * @brief Disable all maskable interrupts (PRIMASK) for a short critical section.
+ * @return The previous PRIMASK value, to be given to MNVIC_voidRestoreInterrupts.
+ */
+u32 MNVIC_u32DisableInterrupts(void);
+
+
+
+/**
+ * @brief End a critical section started by MNVIC_u32DisableInterrupts.
+ *        Critical sections nest, interrupts are enabled again only by the outermost one.
+ * @param Copy_u32State: Value returned by MNVIC_u32DisableInterrupts.
+ */
+void MNVIC_voidRestoreInterrupts(u32 Copy_u32State);
+
 #endif /* NVIC_INTERFACE_H_ */
\ No newline at end of file
@@ -10,6 +10,7 @@
 /****************************************************/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "ATOMIC.h"
 
 /****************************************************/
 /* NVIC Directives                                  */
@@ -22,7 +23,7 @@
 /****************************************************/
 /* GLOBAL VARIABLES                                 */
 /****************************************************/
-static u8 Glopal_u8IPR = 0; // Stores the current priority grouping mode (Group/Subgroup)
+static volatile u32 Glopal_u32IPR = 0; // Stores the current priority grouping mode (Group/Subgroup)
 
 /****************************************************/
 /* FUNCTION DEFINITIONS                             */
@@ -64,7 +65,7 @@ u8 MNVIC_u8GetActiveState(u8 Copy_u8IDX)
 // Set interrupt priority based on the configured grouping mode (Group/Subgroup)
 void MNVIC_voidSetInterruptPriority(u8 Copy_IDX, u8 GroupNum, u8 SubGroup)
 {
-    switch (Glopal_u8IPR) // Use the stored grouping mode
+    switch (ATOMIC_u32Load(&Glopal_u32IPR)) // Use the stored grouping mode
     {
     case GROUP16_SUB0: // 16 priority groups, 0 subgroups
         NVIC->IPR[Copy_IDX] = GroupNum << 4; // Priority bits [7:4]
@@ -87,7 +88,22 @@ void MNVIC_voidSetInterruptPriority(u8 Copy_IDX, u8 GroupNum, u8 SubGroup)
 // Configure priority grouping mode via SCB_AIRCR register
 void MNVIC_voidSetGroupMode(MNVIC_GROUP_MODE_e Copy_Mode)
 {
-    Glopal_u8IPR = Copy_Mode; // Save grouping mode globally
+    ATOMIC_voidStore(&Glopal_u32IPR, Copy_Mode); // Save grouping mode globally
     // VECT_KEY (0x5FA) must be written to modify SCB_AIRCR
     SCB_AIRCR = VECT_KEY | (Copy_Mode << 8); // Combine key and mode
-}
\ No newline at end of file
+}
+
+// Save PRIMASK then set it, so nested critical sections restore the right state
+u32 MNVIC_u32DisableInterrupts(void)
+{
+    u32 Local_u32State;
+    __asm__ volatile ("mrs %0, primask\n\t"
+                      "cpsid i" : "=r" (Local_u32State) : : "memory");
+    return Local_u32State;
+}
+
+// Write back the PRIMASK value saved by MNVIC_u32DisableInterrupts
+void MNVIC_voidRestoreInterrupts(u32 Copy_u32State)
+{
+    __asm__ volatile ("msr primask, %0" : : "r" (Copy_u32State) : "memory");
+}
@@ -10,8 +10,51 @@
 #ifndef EXTI_CONFIG_H_
 #define EXTI_CONFIG_H_
 
-
-
-
+/* Lines configured by MEXTI_voidInit
+ * Each entry is { Line, Port, Edge, Interrupt, Event, CallBack }:-
+ * Line      ==> line0 ... line15
+ * Port      ==> PORTA, PORTB or PORTC
+ * Edge      ==> RISING, FALLING or ON_CHANGE
+ * Interrupt ==> ENABLED or DISABLED
+ * Event     ==> ENABLED or DISABLED
+ * CallBack  ==> callback function or NULL
+ * A line must not be listed twice. The table ends with EXTI_CONFIG_END,
+ * alone when no line is configured at init, e.g.:
+ *    { line0, PORTA, FALLING, ENABLED, DISABLED, NULL },
+ *    EXTI_CONFIG_END */
+#define EXTI_CONFIG_TABLE                                   \
+{                                                           \
+    EXTI_CONFIG_END                                         \
+}
+
+
+
+
+/* Maximum number of callbacks chained on one line, from 1 to 255 */
+#define EXTI_MAX_SUBSCRIBERS        2
+
+/* Interrupt storm protection
+ * Options: ENABLE or DISABLE
+ * When enabled, a line receiving more than EXTI_STORM_MAX_EDGES edges within
+ * one window is masked in IMR for EXTI_STORM_HOLDOFF_WINDOWS windows.
+ * A window is the period between two calls of MEXTI_voidStormWindowTick,
+ * see EXTI_STORM_WINDOW_TICKS. */
+#define EXTI_STORM_PROTECTION       DISABLE
+
+/* SysTick interrupts per window, from 0 to 65535
+ * From 1, MEXTI_voidInit subscribes the window tick to SysTick with
+ * SysTick_u8Subscribe (one of SYSTICK_MAX_SUBSCRIBERS slots): MEXTI_voidInit
+ * must then be called, even with an empty EXTI_CONFIG_TABLE, and SysTick
+ * must run a periodic interval, e.g. 1 ms gives 1 ms windows at 1.
+ * 0 leaves the windows to the application, which must call
+ * MEXTI_voidStormWindowTick periodically itself.
+ * Either way, without the tick a throttled line stays masked for good. */
+#define EXTI_STORM_WINDOW_TICKS     1
+
+/* Edges accepted per line and per window, from 1 to 65535 */
+#define EXTI_STORM_MAX_EDGES        64
+
+/* Number of windows a throttled line stays masked, from 1 to 255 */
+#define EXTI_STORM_HOLDOFF_WINDOWS  2
 
 #endif /* EXTI_CONFIG_H_ */
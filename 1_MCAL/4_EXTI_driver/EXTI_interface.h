@@ -8,6 +8,13 @@
 #ifndef EXTI_INTERFACE_H_
 #define EXTI_INTERFACE_H_
 
+/* Build options deciding which APIs exist (EXTI_STORM_PROTECTION) */
+#include "EXTI_config.h"
+#ifndef ENABLE
+#define ENABLE                      1
+#define DISABLE                     2
+#endif
+
 /**
  * @brief Enumeration for available GPIO ports.
  */
@@ -61,6 +68,37 @@ typedef enum
     ON_CHANGE /**< Both rising and falling edges trigger */
 } Trigger_t;
 
+/**
+ * @brief Configuration of one EXTI line, used by the configuration table
+ *        in EXTI_config.h and by MEXTI_voidInit.
+ */
+typedef struct
+{
+    Line_e    Line;          /**< EXTI line number */
+    PORT_e    Port;          /**< GPIO port routed to the line */
+    Trigger_t Edge;          /**< Trigger edge */
+    Mode_t    Interrupt;     /**< Interrupt request (IMR) ENABLED or DISABLED */
+    Mode_t    Event;         /**< Event request (EMR) ENABLED or DISABLED */
+    void (*CallBack)(void);  /**< Callback function, NULL if not used */
+} EXTI_LineConfig_t;
+
+/**
+ * @brief Last entry of the configuration table (EXTI_config.h).
+ */
+#define EXTI_NO_LINE            ((Line_e)16)
+#define EXTI_CONFIG_END         { EXTI_NO_LINE, PORTA, RISING, DISABLED, DISABLED, NULL }
+
+/**
+ * @brief Builds the line mask used by the mask APIs (bit n <=> line n).
+ */
+#define EXTI_LINE_MASK(LINE)    ((u16)(1U << (LINE)))
+
+/**
+ * @brief NVIC interrupt number serving a given EXTI line
+ *        (lines 5-9 and 10-15 share one vector each).
+ */
+#define EXTI_LINE_IRQ_NUMBER(LINE)  ( ((LINE) <= 4) ? (6 + (LINE)) : (((LINE) <= 9) ? 23 : 40) )
+
 /* Function Prototypes */
 
 /**
@@ -86,9 +124,104 @@ void MEXTI_voidSetEdge(Line_e Copy_line, Trigger_t Copy_edge);
 
 /**
  * @brief Registers a callback function for a specific EXTI line.
+ *        Replaces the callback of the previous call, the ones chained with
+ *        MEXTI_u8Subscribe stay. NULL removes it.
  * @param INT_NUM EXTI line number from Line_e enum.
  * @param ptr Pointer to the callback function.
  */
 void EXTI_voidCallBack(Line_e INT_NUM, void (*ptr)(void));
 
+/**
+ * @brief Chains a callback with a context on an EXTI line (CALLBACK.h).
+ *        Up to EXTI_MAX_SUBSCRIBERS callbacks run in order on each edge,
+ *        subscribing the same callback and context twice has no effect.
+ * @param Copy_line EXTI line number from Line_e enum.
+ * @param pfHandler Callback function, receives pvContext.
+ * @param pvContext Context passed to the callback (e.g. the driver instance).
+ * @return STD_OK, or STD_NOK if the chain of the line is full.
+ */
+u8 MEXTI_u8Subscribe(Line_e Copy_line, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Removes a callback chained by MEXTI_u8Subscribe.
+ * @param Copy_line EXTI line number from Line_e enum.
+ * @param pfHandler Callback function.
+ * @param pvContext Context given at subscription.
+ * @return STD_OK, or STD_NOK if the callback was not found.
+ */
+u8 MEXTI_u8Unsubscribe(Line_e Copy_line, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Configures all the lines listed in EXTI_CONFIG_TABLE (EXTI_config.h).
+ *        The final values of EXTICR[0..3], IMR, EMR, RTSR and FTSR are computed
+ *        first and each register is written once, stale pending bits are
+ *        cleared before the lines are unmasked.
+ */
+void MEXTI_voidInit(void);
+
+/**
+ * @brief Configures a group of lines with the same port and trigger edge.
+ *        Each register is written once whatever the number of lines.
+ * @param Copy_u16LinesMask Lines to configure (bit n <=> line n).
+ * @param Copy_port GPIO port routed to the lines.
+ * @param Copy_edge Trigger edge of the lines.
+ * @param Copy_interrupt Interrupt request (IMR) ENABLED or DISABLED.
+ * @param Copy_event Event request (EMR) ENABLED or DISABLED.
+ */
+void MEXTI_voidConfigLinesMask(u16 Copy_u16LinesMask, PORT_e Copy_port, Trigger_t Copy_edge,
+                               Mode_t Copy_interrupt, Mode_t Copy_event);
+
+/**
+ * @brief Unmasks the interrupt of a group of lines with one write to IMR.
+ * @param Copy_u16LinesMask Lines to enable (bit n <=> line n).
+ */
+void MEXTI_voidEnableInterruptMask(u16 Copy_u16LinesMask);
+
+/**
+ * @brief Masks the interrupt of a group of lines with one write to IMR.
+ * @param Copy_u16LinesMask Lines to disable (bit n <=> line n).
+ */
+void MEXTI_voidDisableInterruptMask(u16 Copy_u16LinesMask);
+
+/**
+ * @brief Gets the lines whose interrupt is unmasked in IMR, e.g. to mask a
+ *        group for a while and restore it as it was (lines masked by the
+ *        storm protection stay masked).
+ * @return Unmasked lines (bit n <=> line n).
+ */
+u16 MEXTI_u16GetInterruptMask(void);
+
+/**
+ * @brief Clears the pending flag of a group of lines with one write to PR.
+ * @param Copy_u16LinesMask Lines to clear (bit n <=> line n).
+ */
+void MEXTI_voidClearPendingMask(u16 Copy_u16LinesMask);
+
+#if EXTI_STORM_PROTECTION == ENABLE
+/**
+ * @brief Closes the current storm protection window: lines whose holdoff is
+ *        over get their stale pending flag cleared and are unmasked again, and
+ *        the edge counters of all the lines restart from zero.
+ *        Called from SysTick every EXTI_STORM_WINDOW_TICKS interrupts once
+ *        MEXTI_voidInit ran; with EXTI_STORM_WINDOW_TICKS at 0 the
+ *        application must call it periodically itself.
+ */
+void MEXTI_voidStormWindowTick(void);
+
+/**
+ * @brief Gets the number of edges dropped by the storm protection on a line.
+ *        Edges hitting a masked line are sampled once per window, so the
+ *        count is a lower bound.
+ * @param Copy_line EXTI line number from Line_e enum.
+ * @return Throttled edges since init.
+ */
+u32 MEXTI_u32GetThrottledEdges(Line_e Copy_line);
+
+/**
+ * @brief Gets the lines currently masked by the storm protection.
+ * @return Throttled lines (bit n <=> line n).
+ */
+u16 MEXTI_u16GetThrottledLines(void);
+#endif
+
 #endif /* EXTI_INTERFACE_H_ */
@@ -9,6 +9,24 @@
 #ifndef EXTI_PRIVATE_H_
 #define EXTI_PRIVATE_H_
 
+/* Generic Enable/Disable macros */
+#define ENABLE                      1
+#define DISABLE                     2
+
+/* Number of EXTI lines connected to the GPIO ports */
+#define EXTI_LINES_NUMBER           16
+
+/* Each EXTICR register holds 4 lines of 4 bits */
+#define EXTICR_LINES_PER_REG        4
+#define EXTICR_BITS_PER_LINE        4
+#define MASKING_FOUR_BITS           (0xF)
+
+/* Mask of all the GPIO lines in IMR, EMR, RTSR, FTSR and PR */
+#define EXTI_ALL_LINES_MASK         (0xFFFF)
+
+/* Lines sharing the EXTI9_5 and EXTI15_10 vectors */
+#define EXTI_LINES_5_TO_9_MASK      (0x03E0)
+#define EXTI_LINES_10_TO_15_MASK    (0xFC00)
 
 
 
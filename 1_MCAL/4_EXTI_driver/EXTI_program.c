@@ -10,6 +10,8 @@
 /****************************************************/
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "CALLBACK.h"
+#include "ATOMIC.h"
 
 /****************************************************/
 /* EXTI Directives                                  */
@@ -19,10 +21,96 @@
 #include "EXTI_private.h"
 #include "EXTI_register.h"
 
+#if (EXTI_STORM_PROTECTION == ENABLE) && (EXTI_STORM_WINDOW_TICKS != 0)
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MSYSTICK_interface.h"
+#endif
+
 /****************************************************/
 /* GLOBAL VARIABLES                                 */
 /****************************************************/
-static void (*Global_EXTIPtr[16])(void); // Array to store callback functions for EXTI lines 0-15
+static ST_CallBack_t Global_EXTISubscribers[EXTI_LINES_NUMBER][EXTI_MAX_SUBSCRIBERS]; // Dense table of the callbacks of each line
+static volatile u8 Global_u8SubscribersCount[EXTI_LINES_NUMBER];                        // Valid entries of each line
+static ST_BareCallBack_t Global_EXTIBare[EXTI_LINES_NUMBER];                            // Callback set by EXTI_voidCallBack on each line
+
+#if EXTI_STORM_PROTECTION == ENABLE
+static volatile u32 Global_u32EdgesInWindow[EXTI_LINES_NUMBER];  // Edges received in the current window
+static volatile u32 Global_u32ThrottledEdges[EXTI_LINES_NUMBER]; // Edges dropped while throttled
+static volatile u32 Global_u32Holdoff[EXTI_LINES_NUMBER];        // Windows left before unmasking
+static volatile u32 Global_u32ThrottledLines = 0;                // Lines masked by the protection
+#if EXTI_STORM_WINDOW_TICKS != 0
+static u16 Global_u16WindowTicks = 0;                            // SysTick interrupts in the current window
+#endif
+#endif
+
+/* Configuration table of the lines set up by MEXTI_voidInit (EXTI_config.h) */
+static const EXTI_LineConfig_t Global_EXTIConfig[] = EXTI_CONFIG_TABLE;
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Writes one value to a group of bits of a register through their
+ *        bit-band aliases: one store per bit, the other bits are never
+ *        written, so an ISR changing them in between is not undone.
+ * @param Copy_pu32Reg: Register (peripheral region).
+ * @param Copy_u32Mask: Bits to write.
+ * @param Copy_u32Value: 0 or 1.
+ */
+static void EXTI_voidWriteBits(volatile u32 *Copy_pu32Reg, u32 Copy_u32Mask, u32 Copy_u32Value) {
+    u8 Local_u8Bit;
+
+    while (Copy_u32Mask != 0) {
+        Local_u8Bit = (u8)__builtin_ctz(Copy_u32Mask);
+        Copy_u32Mask &= Copy_u32Mask - 1;
+        BITBAND(Copy_pu32Reg, Local_u8Bit) = Copy_u32Value;
+    }
+}
+
+/**
+ * @brief Writes the final configuration of a group of lines.
+ *        Lines of the group that are currently unmasked are masked first so no
+ *        interrupt is taken while port and edges change, then every register
+ *        is written once and the stale pending flags are cleared before the
+ *        lines are unmasked again. IMR and EMR, which ISRs change too, are
+ *        only written bit by bit through their bit-band aliases.
+ * @param Copy_u16Mask: Lines of the group (bit n <=> line n).
+ * @param Copy_pu32EXTICR: Final port selection of the lines, 4 bits per line.
+ * @param Copy_pu32EXTICRMask: Bits of EXTICR (4 per line) owned by the group.
+ * @param Copy_u16Rising, Copy_u16Falling: Edge selection of the lines.
+ * @param Copy_u16Interrupt, Copy_u16Event: Lines to unmask in IMR and EMR.
+ */
+static void EXTI_voidWriteLines(u16 Copy_u16Mask, const u32 *Copy_pu32EXTICR, const u32 *Copy_pu32EXTICRMask,
+                                u16 Copy_u16Rising, u16 Copy_u16Falling,
+                                u16 Copy_u16Interrupt, u16 Copy_u16Event) {
+    u8 Local_u8Reg;
+
+    // Mask the lines that are being reconfigured while they are live
+    EXTI_voidWriteBits(&EXTI->IMR, EXTI->IMR & Copy_u16Mask, 0);
+    EXTI_voidWriteBits(&EXTI->EMR, EXTI->EMR & Copy_u16Mask, 0);
+
+    // Port selection, only the EXTICR registers owning lines of the group are touched
+    for (Local_u8Reg = 0; Local_u8Reg < 4; Local_u8Reg++) {
+        if (Copy_pu32EXTICRMask[Local_u8Reg] != 0) {
+            SYS_CFG->EXTICR[Local_u8Reg] = (SYS_CFG->EXTICR[Local_u8Reg] & ~Copy_pu32EXTICRMask[Local_u8Reg])
+                                         | Copy_pu32EXTICR[Local_u8Reg];
+        }
+    }
+
+    // Edge selection
+    EXTI->RTSR = (EXTI->RTSR & ~(u32)Copy_u16Mask) | Copy_u16Rising;
+    EXTI->FTSR = (EXTI->FTSR & ~(u32)Copy_u16Mask) | Copy_u16Falling;
+
+    // Drop the flags latched before or during the reconfiguration (write 1 to clear)
+    EXTI->PR = Copy_u16Mask;
+
+    // Unmask the requested lines
+    EXTI_voidWriteBits(&EXTI->IMR, Copy_u16Interrupt, 1);
+    EXTI_voidWriteBits(&EXTI->EMR, Copy_u16Event, 1);
+}
 
 /****************************************************/
 /* FUNCTION DEFINITIONS                             */
@@ -53,10 +141,10 @@ void MEXTI_voidSetPort(PORT_e Copy_port, Line_e Copy_line) {
 void MEXTI_voidEnableAndDisableInterrupt(Line_e Copy_line, Mode_t Copy_mode) {
     switch (Copy_mode) {
     case ENABLED:
-        SET_BIT(EXTI->IMR, Copy_line); // Enable interrupt via IMR (Interrupt Mask Register)
+        BITBAND_SET_BIT(EXTI->IMR, Copy_line); // Enable interrupt via IMR (Interrupt Mask Register)
         break;
     case DISABLED:
-        CLR_BIT(EXTI->IMR, Copy_line); // Disable interrupt
+        BITBAND_CLR_BIT(EXTI->IMR, Copy_line); // Disable interrupt
         break;
     }
 }
@@ -69,16 +157,16 @@ void MEXTI_voidEnableAndDisableInterrupt(Line_e Copy_line, Mode_t Copy_mode) {
 void MEXTI_voidSetEdge(Line_e Copy_line, Trigger_t Copy_edge) {
     switch (Copy_edge) {
     case RISING:
-        SET_BIT(EXTI->RTSR, Copy_line);   // Enable rising edge trigger
-        CLR_BIT(EXTI->FTSR, Copy_line);     // Disable falling edge trigger
+        BITBAND_SET_BIT(EXTI->RTSR, Copy_line);   // Enable rising edge trigger
+        BITBAND_CLR_BIT(EXTI->FTSR, Copy_line);   // Disable falling edge trigger
         break;
     case FALLING:
-        SET_BIT(EXTI->FTSR, Copy_line);     // Enable falling edge trigger
-        CLR_BIT(EXTI->RTSR, Copy_line);       // Disable rising edge trigger
+        BITBAND_SET_BIT(EXTI->FTSR, Copy_line);   // Enable falling edge trigger
+        BITBAND_CLR_BIT(EXTI->RTSR, Copy_line);   // Disable rising edge trigger
         break;
     case ON_CHANGE:
-        SET_BIT(EXTI->RTSR, Copy_line);     // Enable both edges
-        SET_BIT(EXTI->FTSR, Copy_line);
+        BITBAND_SET_BIT(EXTI->RTSR, Copy_line);   // Enable both edges
+        BITBAND_SET_BIT(EXTI->FTSR, Copy_line);
         break;
     }
 }
@@ -88,7 +176,7 @@ void MEXTI_voidSetEdge(Line_e Copy_line, Trigger_t Copy_edge) {
  * @param ptr: Pointer to the callback function.
  */
 void EXTI0_voidCallBack(void (*ptr)(void)) {
-    Global_EXTIPtr[0] = ptr;
+    EXTI_voidCallBack(line0, ptr);
 }
 
 /**
@@ -96,41 +184,365 @@ void EXTI0_voidCallBack(void (*ptr)(void)) {
  * @param ptr: Pointer to the callback function.
  */
 void EXTI1_voidCallBack(void (*ptr)(void)) {
-    Global_EXTIPtr[1] = ptr;
+    EXTI_voidCallBack(line1, ptr);
+}
+
+#if EXTI_STORM_PROTECTION == ENABLE
+/**
+ * @brief Count an edge of a line against its window budget.
+ *        Over budget, the line is masked in IMR and its pending flag cleared
+ *        so the CPU is not entered again until MEXTI_voidStormWindowTick
+ *        releases it.
+ * @param Copy_u8Line: EXTI line number (0-15).
+ * @return TRUE if the callback may run, FALSE if the line got throttled.
+ */
+static inline u8 EXTI_u8StormAdmit(u8 Copy_u8Line) {
+    u8 Local_u8Admit = TRUE;
+
+    // Lines of different priorities and the window tick share the counters
+    if ((ATOMIC_u32FetchAdd(&Global_u32EdgesInWindow[Copy_u8Line], 1) + 1) > EXTI_STORM_MAX_EDGES) {
+        BITBAND_CLR_BIT(EXTI->IMR, Copy_u8Line);
+        EXTI->PR = EXTI_LINE_MASK(Copy_u8Line);
+        ATOMIC_voidStore(&Global_u32Holdoff[Copy_u8Line], EXTI_STORM_HOLDOFF_WINDOWS);
+        (void)ATOMIC_u32FetchOr(&Global_u32ThrottledLines, EXTI_LINE_MASK(Copy_u8Line));
+        (void)ATOMIC_u32FetchAdd(&Global_u32ThrottledEdges[Copy_u8Line], 1);
+        Local_u8Admit = FALSE;
+    }
+    return Local_u8Admit;
+}
+
+#if EXTI_STORM_WINDOW_TICKS != 0
+/**
+ * @brief Subscribed to SysTick by MEXTI_voidInit: closes the storm
+ *        protection window every EXTI_STORM_WINDOW_TICKS interrupts.
+ * @param pvContext: Unused.
+ */
+static void EXTI_voidStormSysTick(void *pvContext) {
+    (void)pvContext;
+    if (++Global_u16WindowTicks >= EXTI_STORM_WINDOW_TICKS) {
+        Global_u16WindowTicks = 0;
+        MEXTI_voidStormWindowTick();
+    }
+}
+#endif
+#endif
+
+/**
+ * @brief Run the callbacks of a line whose pending flag was just cleared.
+ * @param Copy_u8Line: EXTI line number (0-15).
+ */
+static inline void EXTI_voidServeLine(u8 Copy_u8Line) {
+#if EXTI_STORM_PROTECTION == ENABLE
+    if (EXTI_u8StormAdmit(Copy_u8Line) == FALSE) {
+        return;
+    }
+#endif
+    CALLBACK_voidInvokeAll(Global_EXTISubscribers[Copy_u8Line], Global_u8SubscribersCount[Copy_u8Line]);
+}
+
+/**
+ * @brief Serve the pending lines of a shared EXTI vector.
+ *        The pending flags are cleared before the callbacks run, so an edge
+ *        arriving while a callback executes re-triggers the interrupt
+ *        instead of being lost.
+ * @param Copy_u32Lines: Lines served by the vector (bit n <=> line n).
+ */
+static void EXTI_voidDispatch(u32 Copy_u32Lines) {
+    u32 Local_u32Pending = EXTI->PR & Copy_u32Lines;
+
+    EXTI->PR = Local_u32Pending; // Write 1 to clear, the other lines are not affected
+    while (Local_u32Pending != 0) {
+        u8 Local_u8Line = (u8)__builtin_ctz(Local_u32Pending);
+        Local_u32Pending &= Local_u32Pending - 1;
+        EXTI_voidServeLine(Local_u8Line);
+    }
 }
 
 /**
  * @brief EXTI line 0 interrupt handler.
- *        Invokes the registered callback and clears the pending flag.
+ *        Clears the pending flag and invokes the registered callback.
  */
 void EXTI0_IRQHandler(void) {
-    if (Global_EXTIPtr[0] != NULL) {
-        Global_EXTIPtr[0](); // Execute callback
-    }
-    SET_BIT(EXTI->PR, 0);    // Clear pending flag for line 0
+    EXTI->PR = EXTI_LINE_MASK(0); // Clear pending flag for line 0
+    EXTI_voidServeLine(0);
 }
 
 /**
  * @brief EXTI line 1 interrupt handler.
- *        Invokes the registered callback and clears the pending flag.
+ *        Clears the pending flag and invokes the registered callback.
  */
 void EXTI1_IRQHandler(void) {
-    if (Global_EXTIPtr[1] != NULL) {
-        Global_EXTIPtr[1](); // Execute callback
-    }
-    SET_BIT(EXTI->PR, 1);    // Clear pending flag for line 1
+    EXTI->PR = EXTI_LINE_MASK(1); // Clear pending flag for line 1
+    EXTI_voidServeLine(1);
+}
+
+/**
+ * @brief EXTI line 2 interrupt handler.
+ */
+void EXTI2_IRQHandler(void) {
+    EXTI->PR = EXTI_LINE_MASK(2);
+    EXTI_voidServeLine(2);
+}
+
+/**
+ * @brief EXTI line 3 interrupt handler.
+ */
+void EXTI3_IRQHandler(void) {
+    EXTI->PR = EXTI_LINE_MASK(3);
+    EXTI_voidServeLine(3);
+}
+
+/**
+ * @brief EXTI line 4 interrupt handler.
+ */
+void EXTI4_IRQHandler(void) {
+    EXTI->PR = EXTI_LINE_MASK(4);
+    EXTI_voidServeLine(4);
+}
+
+/**
+ * @brief EXTI lines 5 to 9 interrupt handler.
+ */
+void EXTI9_5_IRQHandler(void) {
+    EXTI_voidDispatch(EXTI_LINES_5_TO_9_MASK);
+}
+
+/**
+ * @brief EXTI lines 10 to 15 interrupt handler.
+ */
+void EXTI15_10_IRQHandler(void) {
+    EXTI_voidDispatch(EXTI_LINES_10_TO_15_MASK);
 }
 
 
 /**
  * @brief Register a callback function for a specific EXTI line.
+ *        Replaces the callback set by the previous call only, the callbacks
+ *        chained with MEXTI_u8Subscribe stay. NULL removes it.
  * @param INT_NUM: EXTI line number (0-15) from Line_e enum.
  * @param ptr: Pointer to the callback function to be invoked when the EXTI line triggers.
  */
 void EXTI_voidCallBack(Line_e INT_NUM, void (*ptr)(void)) {
     // Validate that the EXTI line number is within range
-    if (INT_NUM < 16) {
-        // Store the callback function in the global array for the given EXTI line
-        Global_EXTIPtr[INT_NUM] = ptr;
+    if (INT_NUM < EXTI_LINES_NUMBER) {
+        if (ptr != NULL) {
+            // One pointer store: a live entry runs the old or the new function
+            Global_EXTIBare[INT_NUM].pfBare = ptr;
+            (void)CALLBACK_u8Add(Global_EXTISubscribers[INT_NUM], &Global_u8SubscribersCount[INT_NUM],
+                                 EXTI_MAX_SUBSCRIBERS, CALLBACK_voidBare, &Global_EXTIBare[INT_NUM]);
+        } else {
+            (void)MEXTI_u8Unsubscribe(INT_NUM, CALLBACK_voidBare, &Global_EXTIBare[INT_NUM]);
+        }
+    }
+}
+
+/**
+ * @brief Add a callback with a context to the chain of an EXTI line.
+ * @param Copy_line: EXTI line number (0-15).
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ * @return STD_OK, or STD_NOK if the line already has EXTI_MAX_SUBSCRIBERS callbacks.
+ */
+u8 MEXTI_u8Subscribe(Line_e Copy_line, CallBackFn_t pfHandler, void *pvContext) {
+    u8 Local_u8Status = STD_NOK;
+
+    if (Copy_line < EXTI_LINES_NUMBER) {
+        Local_u8Status = CALLBACK_u8Add(Global_EXTISubscribers[Copy_line], &Global_u8SubscribersCount[Copy_line],
+                                        EXTI_MAX_SUBSCRIBERS, pfHandler, pvContext);
+    }
+    return Local_u8Status;
+}
+
+/**
+ * @brief Remove a callback from the chain of an EXTI line.
+ *        The line interrupt is masked while the chain is compacted.
+ * @param Copy_line: EXTI line number (0-15).
+ * @param pfHandler: Callback function given to MEXTI_u8Subscribe.
+ * @param pvContext: Context given to MEXTI_u8Subscribe.
+ * @return STD_OK, or STD_NOK if the callback was not subscribed.
+ */
+u8 MEXTI_u8Unsubscribe(Line_e Copy_line, CallBackFn_t pfHandler, void *pvContext) {
+    u8 Local_u8Status = STD_NOK;
+
+    if (Copy_line < EXTI_LINES_NUMBER) {
+        u32 Local_u32Unmasked = BITBAND_GET_BIT(EXTI->IMR, Copy_line);
+
+        BITBAND_CLR_BIT(EXTI->IMR, Copy_line);
+        Local_u8Status = CALLBACK_u8Remove(Global_EXTISubscribers[Copy_line], &Global_u8SubscribersCount[Copy_line],
+                                           pfHandler, pvContext);
+        BITBAND(&EXTI->IMR, Copy_line) = Local_u32Unmasked;
+    }
+    return Local_u8Status;
+}
+
+/**
+ * @brief Configure all the lines of EXTI_CONFIG_TABLE, up to EXTI_CONFIG_END.
+ *        The register values are accumulated from the table first,
+ *        then each register is written once.
+ */
+void MEXTI_voidInit(void) {
+    u32 Local_au32EXTICR[4] = {0};
+    u32 Local_au32EXTICRMask[4] = {0};
+    u16 Local_u16Mask = 0, Local_u16Rising = 0, Local_u16Falling = 0;
+    u16 Local_u16Interrupt = 0, Local_u16Event = 0;
+    u8 Local_u8Idx;
+
+    for (Local_u8Idx = 0; Global_EXTIConfig[Local_u8Idx].Line != EXTI_NO_LINE; Local_u8Idx++) {
+        const EXTI_LineConfig_t *Local_pLine = &Global_EXTIConfig[Local_u8Idx];
+        u16 Local_u16Line = EXTI_LINE_MASK(Local_pLine->Line);
+        u8 Local_u8Reg = Local_pLine->Line / EXTICR_LINES_PER_REG;
+        u8 Local_u8Shift = EXTICR_BITS_PER_LINE * (Local_pLine->Line % EXTICR_LINES_PER_REG);
+
+        Local_u16Mask |= Local_u16Line;
+        Local_au32EXTICRMask[Local_u8Reg] |= (u32)MASKING_FOUR_BITS << Local_u8Shift;
+        Local_au32EXTICR[Local_u8Reg] |= (u32)Local_pLine->Port << Local_u8Shift;
+
+        if (Local_pLine->Edge != FALLING) {
+            Local_u16Rising |= Local_u16Line;
+        }
+        if (Local_pLine->Edge != RISING) {
+            Local_u16Falling |= Local_u16Line;
+        }
+        if (Local_pLine->Interrupt == ENABLED) {
+            Local_u16Interrupt |= Local_u16Line;
+        }
+        if (Local_pLine->Event == ENABLED) {
+            Local_u16Event |= Local_u16Line;
+        }
+
+        // Callbacks are in place before any line is unmasked
+        EXTI_voidCallBack(Local_pLine->Line, Local_pLine->CallBack);
+    }
+
+    EXTI_voidWriteLines(Local_u16Mask, Local_au32EXTICR, Local_au32EXTICRMask,
+                        Local_u16Rising, Local_u16Falling, Local_u16Interrupt, Local_u16Event);
+
+#if (EXTI_STORM_PROTECTION == ENABLE) && (EXTI_STORM_WINDOW_TICKS != 0)
+    // Once only, whatever the number of calls
+    (void)SysTick_u8Unsubscribe(EXTI_voidStormSysTick, NULL);
+    (void)SysTick_u8Subscribe(EXTI_voidStormSysTick, NULL);
+#endif
+}
+
+/**
+ * @brief Configure a group of lines sharing the same port and edge.
+ * @param Copy_u16LinesMask: Lines to configure (bit n <=> line n).
+ * @param Copy_port: GPIO port routed to the lines.
+ * @param Copy_edge: Trigger edge (RISING, FALLING, ON_CHANGE).
+ * @param Copy_interrupt: IMR setting of the lines (ENABLED/DISABLED).
+ * @param Copy_event: EMR setting of the lines (ENABLED/DISABLED).
+ */
+void MEXTI_voidConfigLinesMask(u16 Copy_u16LinesMask, PORT_e Copy_port, Trigger_t Copy_edge,
+                               Mode_t Copy_interrupt, Mode_t Copy_event) {
+    u32 Local_au32EXTICR[4] = {0};
+    u32 Local_au32EXTICRMask[4] = {0};
+    u8 Local_u8Line;
+
+    for (Local_u8Line = 0; Local_u8Line < EXTI_LINES_NUMBER; Local_u8Line++) {
+        if (GET_BIT(Copy_u16LinesMask, Local_u8Line) != 0) {
+            u8 Local_u8Reg = Local_u8Line / EXTICR_LINES_PER_REG;
+            u8 Local_u8Shift = EXTICR_BITS_PER_LINE * (Local_u8Line % EXTICR_LINES_PER_REG);
+
+            Local_au32EXTICRMask[Local_u8Reg] |= (u32)MASKING_FOUR_BITS << Local_u8Shift;
+            Local_au32EXTICR[Local_u8Reg] |= (u32)Copy_port << Local_u8Shift;
+        }
+    }
+
+    EXTI_voidWriteLines(Copy_u16LinesMask, Local_au32EXTICR, Local_au32EXTICRMask,
+                        (Copy_edge != FALLING) ? Copy_u16LinesMask : 0,
+                        (Copy_edge != RISING) ? Copy_u16LinesMask : 0,
+                        (Copy_interrupt == ENABLED) ? Copy_u16LinesMask : 0,
+                        (Copy_event == ENABLED) ? Copy_u16LinesMask : 0);
+}
+
+/**
+ * @brief Unmask the interrupt of a group of lines.
+ * @param Copy_u16LinesMask: Lines to enable (bit n <=> line n).
+ */
+void MEXTI_voidEnableInterruptMask(u16 Copy_u16LinesMask) {
+    EXTI_voidWriteBits(&EXTI->IMR, Copy_u16LinesMask & EXTI_ALL_LINES_MASK, 1);
+}
+
+/**
+ * @brief Mask the interrupt of a group of lines.
+ * @param Copy_u16LinesMask: Lines to disable (bit n <=> line n).
+ */
+void MEXTI_voidDisableInterruptMask(u16 Copy_u16LinesMask) {
+    EXTI_voidWriteBits(&EXTI->IMR, Copy_u16LinesMask & EXTI_ALL_LINES_MASK, 0);
+}
+
+/**
+ * @brief Get the lines whose interrupt is unmasked.
+ * @return u16: Unmasked lines (bit n <=> line n).
+ */
+u16 MEXTI_u16GetInterruptMask(void) {
+    return (u16)(EXTI->IMR & EXTI_ALL_LINES_MASK);
+}
+
+/**
+ * @brief Clear the pending flag of a group of lines.
+ *        PR is write-1-to-clear, a plain write leaves the other lines untouched.
+ * @param Copy_u16LinesMask: Lines to clear (bit n <=> line n).
+ */
+void MEXTI_voidClearPendingMask(u16 Copy_u16LinesMask) {
+    EXTI->PR = Copy_u16LinesMask & EXTI_ALL_LINES_MASK;
+}
+
+#if EXTI_STORM_PROTECTION == ENABLE
+/**
+ * @brief Close the current storm protection window.
+ *        A pending flag found on a throttled line means edges kept coming
+ *        while it was masked, it is counted as one more dropped edge.
+ */
+void MEXTI_voidStormWindowTick(void) {
+    u32 Local_u32Throttled = ATOMIC_u32Load(&Global_u32ThrottledLines);
+    u32 Local_u32Pending = EXTI->PR & Local_u32Throttled;
+    u32 Local_u32Release = 0;
+    u8 Local_u8Line;
+
+    while (Local_u32Throttled != 0) {
+        Local_u8Line = (u8)__builtin_ctz(Local_u32Throttled);
+        Local_u32Throttled &= Local_u32Throttled - 1;
+
+        if (GET_BIT(Local_u32Pending, Local_u8Line) != 0) {
+            (void)ATOMIC_u32FetchAdd(&Global_u32ThrottledEdges[Local_u8Line], 1);
+        }
+        if (ATOMIC_u32FetchSub(&Global_u32Holdoff[Local_u8Line], 1) == 1) {
+            Local_u32Release |= EXTI_LINE_MASK(Local_u8Line);
+        }
     }
+
+    for (Local_u8Line = 0; Local_u8Line < EXTI_LINES_NUMBER; Local_u8Line++) {
+        ATOMIC_voidStore(&Global_u32EdgesInWindow[Local_u8Line], 0);
+    }
+
+    if (Local_u32Release != 0) {
+        // Drop what latched while masked, then let the lines in again
+        EXTI->PR = Local_u32Release;
+        (void)ATOMIC_u32FetchAnd(&Global_u32ThrottledLines, ~Local_u32Release);
+        EXTI_voidWriteBits(&EXTI->IMR, Local_u32Release, 1);
+    }
+}
+
+/**
+ * @brief Get the number of edges dropped by the storm protection on a line.
+ * @param Copy_line: EXTI line number (0-15).
+ * @return Throttled edges since init (lower bound).
+ */
+u32 MEXTI_u32GetThrottledEdges(Line_e Copy_line) {
+    u32 Local_u32Edges = 0;
+
+    if (Copy_line < EXTI_LINES_NUMBER) {
+        Local_u32Edges = ATOMIC_u32Load(&Global_u32ThrottledEdges[Copy_line]);
+    }
+    return Local_u32Edges;
+}
+
+/**
+ * @brief Get the lines currently masked by the storm protection.
+ * @return Throttled lines (bit n <=> line n).
+ */
+u16 MEXTI_u16GetThrottledLines(void) {
+    return (u16)ATOMIC_u32Load(&Global_u32ThrottledLines);
 }
+#endif
@@ -23,5 +23,27 @@
  /* Options: AHB_DIV_8 or AHB */
  #define SYSTICK_CLOCKSOURCE    AHB_DIV_8
  
+ /* Maximum number of callbacks subscribed to every SysTick interrupt */
+ #define SYSTICK_MAX_SUBSCRIBERS    4
+ 
+ /* Tickless idle: below this number of idle periods the core just sleeps until the next tick */
+ #define SYSTICK_TICKLESS_MIN_PERIODS       2
+ 
+ /* Tickless idle: core cycles the counter stands stopped to be reprogrammed in
+  * one sleep, added back to the time base in SysTick ticks (rounded) on every
+  * tickless wakeup. 16 cycles is an estimate, not a measurement: it keeps the
+  * former 2 ticks at AHB/8. To calibrate, build with SYSTICK_INSTRUMENTATION,
+  * call MDWT_voidInit, let the idle loop sleep and read
+  * SysTick_u32GetTicklessStoppedCycles, which is the longest stop measured */
+ #define SYSTICK_TICKLESS_STOPPED_CYCLES    16
+ 
+ /* Timing of the interval callback with the DWT cycle counter (MDWT_voidInit
+  * must be called first): intervals, run times, jitter histogram, overruns.
+  * Options: ENABLE or DISABLE */
+ #define SYSTICK_INSTRUMENTATION            DISABLE
+ 
+ /* Width of a jitter histogram bin in core cycles */
+ #define SYSTICK_JITTER_BIN_CYCLES          32
+ 
  #endif /* MSYSTICK_CONFIG_H_ */
  
\ No newline at end of file
@@ -15,6 +15,42 @@
 
  #ifndef MSYSTICK_INTERFACE_H_
  #define MSYSTICK_INTERFACE_H_
+
+ /* Build options deciding which APIs exist (SYSTICK_INSTRUMENTATION) */
+ #include "MSYSTICK_config.h"
+ #ifndef ENABLE
+ #define ENABLE              1
+ #define DISABLE             2
+ #endif
+ 
+ /* Bins of the jitter histogram: bin SYSTICK_JITTER_BINS / 2 starts at zero
+  * jitter, each bin is SYSTICK_JITTER_BIN_CYCLES wide and the first and last
+  * bins also collect everything beyond them */
+ #define SYSTICK_JITTER_BINS    16
+ 
+ /**
+  * @brief Timing of the interval callback, in core cycles (SYSTICK_INSTRUMENTATION).
+  *        Jitter is the measured interval minus the programmed one.
+  */
+ typedef struct
+ {
+     u32 Invocations;                        /**< Callback runs */
+     u32 Overruns;                           /**< Runs longer than the interval */
+     u32 ExpectedCycles;                     /**< Programmed interval */
+     u32 IntervalCount;                      /**< Intervals measured (runs after the first) */
+     u32 IntervalLast;                       /**< Time between the last two runs */
+     u32 IntervalMin;
+     u32 IntervalMax;
+     u32 IntervalMean;
+     s32 JitterMin;
+     s32 JitterMax;
+     s32 JitterMean;
+     u32 RunLast;                            /**< Run time of the last callback */
+     u32 RunMin;
+     u32 RunMax;
+     u32 RunMean;
+     u32 Histogram[SYSTICK_JITTER_BINS];     /**< Jitter distribution */
+ } SysTick_JitterStats_t;
  
  /**
   * @brief Initialize the SysTick timer.
@@ -22,8 +58,10 @@
  void SysTick_voidInit(void);
  
  /**
-  * @brief Create a busy-wait delay using SysTick.
-  * @param Copy_u32DelayTime: The delay time (tick count) to wait.
+  * @brief Create a busy-wait delay using SysTick. The free-running time base
+  *        keeps running; an armed interval is paused and resumes after the
+  *        wait, later by its length.
+  * @param Copy_u32DelayTime: The delay time (tick count) to wait, waited in chunks above 2^24.
   */
  void SysTick_voidBusyWait(u32 Copy_u32DelayTime);
  
@@ -53,10 +91,137 @@
   */
  void SysTick_voidSetTimeIntervalPeriodic(u32 Copy_u32DelayTime, void (*pf)(void));
  
+ /**
+  * @brief Set a single-shot time interval with a callback context (CALLBACK.h).
+  * @param Copy_u32DelayTime: The tick count for the interval.
+  * @param pfHandler: Callback function to execute when the interval expires.
+  * @param pvContext: Context passed to the callback.
+  */
+ void SysTick_voidSetTimeIntervalSingleCtx(u32 Copy_u32DelayTime, CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Set a periodic time interval with a callback context (CALLBACK.h).
+  * @param Copy_u32DelayTime: The tick count for the interval.
+  * @param pfHandler: Callback function to execute at each interval.
+  * @param pvContext: Context passed to the callback.
+  */
+ void SysTick_voidSetTimeIntervalPeriodicCtx(u32 Copy_u32DelayTime, CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Set a single-shot interval of an exact number of ticks (MSYSTICK_time.h builds it from ms/us).
+  * @param Copy_u32Ticks: Ticks in the interval (2 to 2^32 - 1), chained over several reloads above 2^24.
+  * @param pfHandler: Callback function to execute when the interval expires.
+  * @param pvContext: Context passed to the callback.
+  */
+ void SysTick_voidSetIntervalSingleTicks(u32 Copy_u32Ticks, CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Set a periodic interval of an exact number of ticks (MSYSTICK_time.h builds it from ms/us).
+  * @param Copy_u32Ticks: Ticks in the interval (2 to 2^32 - 1), chained over several reloads above 2^24.
+  * @param pfHandler: Callback function to execute at each interval.
+  * @param pvContext: Context passed to the callback.
+  */
+ void SysTick_voidSetIntervalPeriodicTicks(u32 Copy_u32Ticks, CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Add a callback executed on every SysTick interrupt, after the interval callback.
+  * @param pfHandler: Callback function.
+  * @param pvContext: Context passed to the callback.
+  * @return u8: STD_OK, or STD_NOK if SYSTICK_MAX_SUBSCRIBERS callbacks are already added.
+  */
+ u8 SysTick_u8Subscribe(CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Remove a callback added by SysTick_u8Subscribe.
+  * @param pfHandler: Callback function.
+  * @param pvContext: Context given at subscription.
+  * @return u8: STD_OK, or STD_NOK if the callback was not found.
+  */
+ u8 SysTick_u8Unsubscribe(CallBackFn_t pfHandler, void *pvContext);
+ 
+ /**
+  * @brief Start the free-running time base: the counter wraps every
+  *        Copy_u32TickPeriod ticks and the ISR extends a 64-bit tick count.
+  *        Setting a time interval afterwards stops the time base.
+  * @param Copy_u32TickPeriod: Ticks between two SysTick interrupts (2 to 2^24).
+  */
+ void SysTick_voidStartFreeRunning(u32 Copy_u32TickPeriod);
+ 
+ /**
+  * @brief Get the ticks counted since the time base started (monotonic).
+  *        Safe from any context, interrupts are never disabled.
+  * @return u64: The tick count.
+  */
+ u64 SysTick_u64GetTicks(void);
+ 
+ /**
+  * @brief Get the time since the time base started in microseconds.
+  * @return u64: The elapsed microseconds.
+  */
+ u64 SysTick_u64GetMicros(void);
+ 
+ /**
+  * @brief Get the time since the time base started in milliseconds.
+  * @return u64: The elapsed milliseconds.
+  */
+ u64 SysTick_u64GetMillis(void);
+ 
+ /**
+  * @brief Get the periods accounted by the SysTick interrupt being handled, for
+  *        the tick subscribers: 1, or more on the first interrupt after
+  *        tickless idle, in which case a subscriber advances its time by all
+  *        of them in one step.
+  * @return u32: Elapsed periods.
+  */
+ u32 SysTick_u32GetElapsedPeriods(void);
+
+ /**
+  * @brief Get the frequency of the SysTick counter, from the live AHB clock.
+  * @return u32: Ticks per second, 0 before the time base started.
+  */
+ u32 SysTick_u32GetTickFreq(void);
+ 
+ /**
+  * @brief Tickless idle: sleep in WFI until the next software deadline without
+  *        taking the periodic tick, then correct the time base for the ticks
+  *        slept through. The skipped periods are delivered to the tick
+  *        subscribers in one call by the next SysTick interrupt, see
+  *        SysTick_u32GetElapsedPeriods. Needs the free-running mode.
+  * @param pfGetIdlePeriods: Returns the whole periods until the next deadline
+  *                          (0xFFFFFFFF if none), called with interrupts disabled.
+  */
+ void SysTick_voidTicklessIdle(u32 (*pfGetIdlePeriods)(void));
+ 
+ /**
+  * @brief Get the number of wakeups from idle during the last complete second.
+  * @return u32: Wakeups per second.
+  */
+ u32 SysTick_u32GetWakeupsPerSecond(void);
+ 
  /**
   * @brief Stop the SysTick timer.
   */
  void SysTick_voidStopTimer(void);
  
+ #if SYSTICK_INSTRUMENTATION == ENABLE
+ /**
+  * @brief Take a consistent snapshot of the callback timing (SYSTICK_INSTRUMENTATION == ENABLE).
+  * @param Copy_pStats: Receives the statistics.
+  */
+ void SysTick_voidGetJitterStats(SysTick_JitterStats_t *Copy_pStats);
+ 
+ /**
+  * @brief Clear the callback timing statistics (SYSTICK_INSTRUMENTATION == ENABLE).
+  */
+ void SysTick_voidResetJitterStats(void);
+ 
+ /**
+  * @brief Longest stop of the counter in one tickless sleep, the value of
+  *        SYSTICK_TICKLESS_STOPPED_CYCLES (SYSTICK_INSTRUMENTATION == ENABLE).
+  * @return u32: Core cycles, 0 before the first tickless sleep.
+  */
+ u32 SysTick_u32GetTicklessStoppedCycles(void);
+ #endif
+ 
  #endif /* MSYSTICK_INTERFACE_H_ */
  
\ No newline at end of file
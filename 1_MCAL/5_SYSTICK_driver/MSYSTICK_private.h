@@ -30,5 +30,34 @@
  #define CSR_CLOCKSOURCE     2   // Clock source selection bit
  #define CSR_COUNT_FLAG      16  // Count flag (read-only) indicating timer has reached zero
  
+ /* SCB ICSR Bit Definitions */
+ #define ICSR_PENDSTCLR      25  // Write 1 to clear the SysTick pending state
+ #define ICSR_PENDSTSET      26  // SysTick exception pending
+ #define ICSR_ISRPENDING     22  // An external interrupt is pending
+ 
+ /* Mode flag values */
+ #define MODE_SINGLE         1   // Single-shot interval
+ #define MODE_PERIODIC       2   // Periodic interval
+ #define MODE_FREE_RUNNING   3   // Free-running time base
+ 
+ /* Largest value of the 24-bit reload register */
+ #define SYSTICK_MAX_RELOAD  0x00FFFFFF
+ 
+ /* SysTick counter prescaler from the AHB clock for each clock source option */
+ #define SYSTICK_DIVIDER(SOURCE)    ( ((SOURCE) == AHB_DIV_8) ? 8 : 1 )
+ 
+ /* SysTick ticks added back per tickless sleep for the cycles the counter stood stopped */
+ #define SYSTICK_TICKLESS_COMPENSATION \
+     ( (SYSTICK_TICKLESS_STOPPED_CYCLES + (SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE) / 2)) / SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE) )
+ 
+ /* Sleep until an interrupt is pending, the host test replaces it to simulate the counter */
+ #ifndef SYSTICK_WAIT_FOR_INTERRUPT
+ #define SYSTICK_WAIT_FOR_INTERRUPT()    __asm__ volatile ("dsb\n\twfi\n\tisb" : : : "memory")
+ #endif
+ 
+ /* Time units */
+ #define MICROS_PER_SECOND   1000000UL
+ #define MILLIS_PER_SECOND   1000UL
+ 
  #endif /* MSYSTICK_PRIVATE_H_ */
  
\ No newline at end of file
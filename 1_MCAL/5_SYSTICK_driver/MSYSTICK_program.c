@@ -10,6 +10,8 @@
 /****************************************************/
 #include "STD_TYPES.h"         // Standard data types definitions
 #include "BIT_MATH.h"          // Bit manipulation macros
+#include "CALLBACK.h"          // Callbacks with context
+#include "ATOMIC.h"            // Lock-free access to the shared state
 
 /****************************************************/
 /* SysTick Directives                               */
@@ -19,11 +21,300 @@
 #include "MSYSTICK_private.h"    // Private macros for SysTick
 #include "MSYSTICK_config.h"     // Configuration settings for SysTick
 
+/****************************************************/
+/* RCC Directives                                   */
+/****************************************************/
+#include "MRCC_interface.h"      // AHB clock frequency
+
+/****************************************************/
+/* NVIC Directives                                  */
+/****************************************************/
+#include "NVIC_interface.h"      // Critical sections
+
+#if SYSTICK_INSTRUMENTATION == ENABLE
+/****************************************************/
+/* DWT Directives                                   */
+/****************************************************/
+#include "MDWT_interface.h"      // Cycle counter for the callback timing
+#endif
+
 /****************************************************/
 /* GLOBAL VARIABLES                                 */
 /****************************************************/
-void (*Globalpf)(void) = NULL; // Global pointer to store the callback function
-u8 Flag = 0;                   // Mode flag: 1 for single-shot, 2 for periodic
+/* Interval callback: the handler is withdrawn before the context and mode
+ * change and published after them, so the ISR reads it first and never pairs
+ * it with the context or mode of another interval */
+static ST_CallBack_t Globalpf = {NULL, NULL};          // Interval callback and its context
+static volatile u32 Global_u32Mode = 0;                // 1 for single-shot, 2 for periodic, 3 for free-running
+static ST_BareCallBack_t Global_BareInterval = {NULL}; // Bare callback of the legacy interval APIs
+
+/* Free-running time base
+ * The ISR writes the next value into the slot that readers are not using and
+ * then publishes it by incrementing the sequence, so a reader never spins even
+ * when it preempts the ISR, and retries only if the ISR ran during its read. */
+static volatile u64 Global_u64TickBase[2] = {0, 0}; // Ticks counted at the last wrap, indexed by sequence parity
+static volatile u32 Global_u32TickSeq = 0;          // Number of wraps accounted
+static u32 Global_u32TickPeriod = 0;                // Ticks per wrap (reload + 1)
+static u32 Global_u32TickFreq = 0;                  // Counter frequency in Hz
+static volatile u32 Global_u32SkippedPeriods = 0;   // Periods slept through, delivered with the next interrupt
+static u32 Global_u32ElapsedPeriods = 1;            // Periods accounted by the interrupt being handled
+
+/* Tickless idle statistics */
+static u32 Global_u32Wakeups = 0;                   // Wakeups in the current one-second window
+static u64 Global_u64WakeupWindowStart = 0;         // Start of the current window in ticks
+static u32 Global_u32WakeupsPerSecond = 0;          // Wakeups counted in the last complete window
+
+static ST_CallBack_t Global_TickSubscribers[SYSTICK_MAX_SUBSCRIBERS]; // Callbacks run on every SysTick interrupt
+static volatile u8 Global_u8TickSubscribersCount = 0;
+
+/* Intervals longer than the reload register: a first segment of
+ * Global_u32ChainFirst ticks followed by segments of Global_u32ChainLength */
+static u32 Global_u32ChainSegments = 1;             // Reloads per interval
+static volatile u32 Global_u32ChainIndex = 0;       // Segment being counted
+static u32 Global_u32ChainFirst = 0;                // Ticks of the first segment
+static u32 Global_u32ChainLength = 0;               // Ticks of the other segments
+
+#if SYSTICK_INSTRUMENTATION == ENABLE
+/* Callback timing, the sums are kept apart to compute the means in the snapshot */
+static SysTick_JitterStats_t Global_JitterStats = {
+    .IntervalMin = 0xFFFFFFFFUL, .JitterMin = (s32)0x7FFFFFFFL, .JitterMax = -(s32)0x7FFFFFFFL - 1, .RunMin = 0xFFFFFFFFUL
+};
+static u64 Global_u64IntervalSum = 0;
+static s64 Global_s64JitterSum = 0;
+static u64 Global_u64RunSum = 0;
+static u32 Global_u32LastRunStart = 0;              // Cycles at the start of the previous run
+static u8 Global_u8JitterPrimed = FALSE;            // Global_u32LastRunStart belongs to the current interval setting
+static u32 Global_u32TicklessStopped = 0;           // Longest stop of the counter in one tickless sleep, in cycles
+#endif
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Publish the interval handler.
+ *
+ * ISO C does not convert a function pointer to void *, so the pointer
+ * helpers of ATOMIC.h do not apply: the store is a volatile one between
+ * two barriers.
+ *
+ * @param pfHandler: Interval callback, NULL to withdraw it.
+ */
+static inline void SysTick_voidStoreHandler(CallBackFn_t pfHandler)
+{
+    ATOMIC_FENCE();
+    *(CallBackFn_t volatile *)&Globalpf.pfHandler = pfHandler;
+    ATOMIC_FENCE();
+}
+
+/**
+ * @brief Read the interval handler published by SysTick_voidStoreHandler.
+ * @return CallBackFn_t: The handler, NULL if none.
+ */
+static inline CallBackFn_t SysTick_pfLoadHandler(void)
+{
+    CallBackFn_t Local_pfHandler;
+
+    ATOMIC_FENCE();
+    Local_pfHandler = *(CallBackFn_t const volatile *)&Globalpf.pfHandler;
+    ATOMIC_FENCE();
+    return Local_pfHandler;
+}
+
+/**
+ * @brief Start counting a segment, then reload a different one after it.
+ *
+ * The counter loads the first reload value on its first clock after the
+ * start (up to 8 core cycles at AHB/8): the next value is written once the
+ * current value register shows the load, or the segment already ended
+ * (COUNTFLAG). The clock source is never changed.
+ *
+ * @param Copy_u32First: Ticks of the segment counted now (2 to 2^24).
+ * @param Copy_u32Next: Ticks of the following segments (2 to 2^24).
+ */
+static void SysTick_voidLoadChained(u32 Copy_u32First, u32 Copy_u32Next)
+{
+    SYSTICK->SYST_RVR = Copy_u32First - 1;
+    SYSTICK->SYST_CVR = 0; // Also clears COUNTFLAG
+    SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    while ((SYSTICK->SYST_CVR == 0) && (GET_BIT(SYSTICK->SYST_CSR, CSR_COUNT_FLAG) == 0));
+    SYSTICK->SYST_RVR = Copy_u32Next - 1;
+}
+
+/**
+ * @brief Start an interval, split into reloads of at most 2^24 ticks.
+ *
+ * The segments are as equal as possible, the first one takes the shortfall.
+ *
+ * @param Copy_u32Ticks: Ticks in the interval (2 to 2^32 - 1).
+ * @param Copy_u8Mode: MODE_SINGLE or MODE_PERIODIC.
+ * @param pfHandler: Callback function run at the end of the interval.
+ * @param pvContext: Context passed to the callback.
+ */
+static void SysTick_voidStartInterval(u32 Copy_u32Ticks, u8 Copy_u8Mode, CallBackFn_t pfHandler, void *pvContext)
+{
+    u32 Local_u32Segments;
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        u64 Local_u64Cycles;
+    #endif
+
+    if (Copy_u32Ticks < 2)
+    {
+        Copy_u32Ticks = 2; // A reload value of 0 would stop the counter
+    }
+    Local_u32Segments = (u32)(((u64)Copy_u32Ticks + SYSTICK_MAX_RELOAD) / (SYSTICK_MAX_RELOAD + 1UL));
+
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    SysTick_voidStoreHandler(NULL);
+    ATOMIC_voidStorePtr(&Globalpf.pvContext, pvContext);
+    ATOMIC_voidStore(&Global_u32Mode, Copy_u8Mode);
+
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        /* Core cycles per interval, the core runs on the AHB clock.
+         * Saturated: an interval longer than 2^32 cycles is beyond the cycle counter anyway */
+        Local_u64Cycles = (u64)Copy_u32Ticks * SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE);
+        Global_JitterStats.ExpectedCycles = (Local_u64Cycles > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (u32)Local_u64Cycles;
+        Global_u8JitterPrimed = FALSE;
+    #endif
+
+    Global_u32ChainSegments = Local_u32Segments;
+    Global_u32ChainIndex = 0;
+    Global_u32ChainLength = (u32)(((u64)Copy_u32Ticks + Local_u32Segments - 1) / Local_u32Segments);
+    Global_u32ChainFirst = Copy_u32Ticks - ((Local_u32Segments - 1) * Global_u32ChainLength);
+    SysTick_voidStoreHandler(pfHandler);
+
+    if (Local_u32Segments == 1)
+    {
+        SYSTICK->SYST_RVR = Copy_u32Ticks - 1;
+        SYSTICK->SYST_CVR = 0;
+        SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    }
+    else
+    {
+        SysTick_voidLoadChained(Global_u32ChainFirst, Global_u32ChainLength);
+    }
+}
+
+/**
+ * @brief Account for one wrap of a chained interval.
+ *
+ * The counter has already reloaded the segment it counts now, so the reload
+ * register is set for the segment after it.
+ *
+ * @return u8: TRUE when the wrap ends the interval.
+ */
+static u8 SysTick_u8ChainWrap(void)
+{
+    u32 Local_u32Index;
+
+    if (Global_u32ChainSegments == 1)
+    {
+        return TRUE;
+    }
+
+    Local_u32Index = Global_u32ChainIndex + 1;
+    if (Local_u32Index == Global_u32ChainSegments)
+    {
+        Local_u32Index = 0;
+    }
+    Global_u32ChainIndex = Local_u32Index;
+
+    SYSTICK->SYST_RVR = (((Local_u32Index + 1) == Global_u32ChainSegments) ? Global_u32ChainFirst : Global_u32ChainLength) - 1;
+
+    return (Local_u32Index == 0) ? TRUE : FALSE;
+}
+
+#if SYSTICK_INSTRUMENTATION == ENABLE
+/**
+ * @brief Account for one run of the interval callback.
+ *
+ * @param Copy_u32Start: Cycles when the callback was called.
+ * @param Copy_u32End: Cycles when it returned.
+ */
+static void SysTick_voidRecordRun(u32 Copy_u32Start, u32 Copy_u32End)
+{
+    SysTick_JitterStats_t *Local_pStats = &Global_JitterStats;
+    u32 Local_u32Run = Copy_u32End - Copy_u32Start;
+    u32 Local_u32Interval;
+    s32 Local_s32Jitter, Local_s32Bin;
+
+    Local_pStats->Invocations++;
+    Local_pStats->RunLast = Local_u32Run;
+    Global_u64RunSum += Local_u32Run;
+    if (Local_u32Run < Local_pStats->RunMin)
+    {
+        Local_pStats->RunMin = Local_u32Run;
+    }
+    if (Local_u32Run > Local_pStats->RunMax)
+    {
+        Local_pStats->RunMax = Local_u32Run;
+    }
+    if (Local_u32Run > Local_pStats->ExpectedCycles)
+    {
+        Local_pStats->Overruns++;
+    }
+
+    if (Global_u8JitterPrimed == TRUE)
+    {
+        Local_u32Interval = Copy_u32Start - Global_u32LastRunStart;
+        Local_pStats->IntervalCount++;
+        Local_pStats->IntervalLast = Local_u32Interval;
+        Global_u64IntervalSum += Local_u32Interval;
+        if (Local_u32Interval < Local_pStats->IntervalMin)
+        {
+            Local_pStats->IntervalMin = Local_u32Interval;
+        }
+        if (Local_u32Interval > Local_pStats->IntervalMax)
+        {
+            Local_pStats->IntervalMax = Local_u32Interval;
+        }
+
+        Local_s32Jitter = (s32)(Local_u32Interval - Local_pStats->ExpectedCycles);
+        Global_s64JitterSum += Local_s32Jitter;
+        if (Local_s32Jitter < Local_pStats->JitterMin)
+        {
+            Local_pStats->JitterMin = Local_s32Jitter;
+        }
+        if (Local_s32Jitter > Local_pStats->JitterMax)
+        {
+            Local_pStats->JitterMax = Local_s32Jitter;
+        }
+
+        /* Floor division so bin SYSTICK_JITTER_BINS / 2 - 1 holds the small negative values */
+        Local_s32Bin = (Local_s32Jitter >= 0) ? (Local_s32Jitter / SYSTICK_JITTER_BIN_CYCLES)
+                                              : -(((-Local_s32Jitter) + SYSTICK_JITTER_BIN_CYCLES - 1) / SYSTICK_JITTER_BIN_CYCLES);
+        Local_s32Bin += SYSTICK_JITTER_BINS / 2;
+        if (Local_s32Bin < 0)
+        {
+            Local_s32Bin = 0;
+        }
+        else if (Local_s32Bin >= SYSTICK_JITTER_BINS)
+        {
+            Local_s32Bin = SYSTICK_JITTER_BINS - 1;
+        }
+        Local_pStats->Histogram[Local_s32Bin]++;
+    }
+
+    Global_u32LastRunStart = Copy_u32Start;
+    Global_u8JitterPrimed = TRUE;
+}
+#endif
+
+/**
+ * @brief Run the interval callback, timed when SYSTICK_INSTRUMENTATION is enabled.
+ *
+ * @param Copy_pCallback: Callback read by the ISR.
+ */
+static void SysTick_voidRunIntervalCallback(const ST_CallBack_t *Copy_pCallback)
+{
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        u32 Local_u32Start = MDWT_u32GetCycles();
+        Copy_pCallback->pfHandler(Copy_pCallback->pvContext);
+        SysTick_voidRecordRun(Local_u32Start, MDWT_u32GetCycles());
+    #else
+        Copy_pCallback->pfHandler(Copy_pCallback->pvContext);
+    #endif
+}
 
 /****************************************************/
 /* FUNCTION DEFINITIONS                             */
@@ -57,18 +348,68 @@ void SysTick_voidInit(void)
  *
  * Loads the delay time into the reload register, clears the current value,
  * and starts the timer. Waits until the COUNT FLAG is set, then stops the timer.
+ * Delays longer than the reload register are waited in chunks of 2^24 ticks.
+ *
+ * An armed interval is paused, not lost: the counter is stopped and its
+ * interrupt masked, a wrap pending at that point is withdrawn, then the
+ * interval resumes at the position and with the reload it had, the wrap
+ * pended again for the ISR and the chain untouched. It ends later by the
+ * length of the wait.
  *
  * @param Copy_u32DelayTime: The delay time (tick count).
  */
 void SysTick_voidBusyWait(u32 Copy_u32DelayTime)
 {
-    SYSTICK->SYST_RVR = Copy_u32DelayTime; // Load delay time
-    SYSTICK->SYST_CVR = 0;                 // Reset current value
-    SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE); // Start the timer
-    while (GET_BIT(SYSTICK->SYST_CSR, CSR_COUNT_FLAG) == 0); // Wait for flag
-    SYSTICK->SYST_RVR = 0;                 // Reset reload register
-    SYSTICK->SYST_CVR = 0;                 // Reset current value
-    CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE); // Stop the timer
+    u32 Local_u32State, Local_u32Control, Local_u32Reload, Local_u32Current, Local_u32Pending;
+
+    if (ATOMIC_u32Load(&Global_u32Mode) == MODE_FREE_RUNNING)
+    {
+        /* Keep the time base running, wait on it instead of the reload register */
+        u64 Local_u64Start = SysTick_u64GetTicks();
+        while ((SysTick_u64GetTicks() - Local_u64Start) < Copy_u32DelayTime);
+        return;
+    }
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    Local_u32Control = SYSTICK->SYST_CSR;
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_TICKINT); // The wraps of the wait must not reach the ISR
+    Local_u32Pending = GET_BIT(SCB_ICSR, ICSR_PENDSTSET);
+    SCB_ICSR = (1UL << ICSR_PENDSTCLR);
+    Local_u32Reload = SYSTICK->SYST_RVR;
+    Local_u32Current = SYSTICK->SYST_CVR;
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+
+    while (Copy_u32DelayTime >= 2)
+    {
+        u32 Local_u32Chunk = (Copy_u32DelayTime > (SYSTICK_MAX_RELOAD + 1UL)) ? (SYSTICK_MAX_RELOAD + 1UL) : Copy_u32DelayTime;
+
+        SYSTICK->SYST_RVR = Local_u32Chunk - 1; // Load delay time
+        SYSTICK->SYST_CVR = 0;                 // Reset current value
+        SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE); // Start the timer
+        while (GET_BIT(SYSTICK->SYST_CSR, CSR_COUNT_FLAG) == 0); // Wait for flag
+        CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+        Copy_u32DelayTime -= Local_u32Chunk;
+    }
+
+    if (GET_BIT(Local_u32Control, CSR_ENABLE) != 0)
+    {
+        /* Resume the interval where it was */
+        SysTick_voidLoadChained((Local_u32Current < 2) ? 2 : Local_u32Current, Local_u32Reload + 1);
+    }
+    else
+    {
+        SYSTICK->SYST_RVR = 0;                 // Reset reload register
+        SYSTICK->SYST_CVR = 0;                 // Reset current value
+    }
+    if (GET_BIT(Local_u32Control, CSR_TICKINT) != 0)
+    {
+        SET_BIT(SYSTICK->SYST_CSR, CSR_TICKINT);
+    }
+    if (Local_u32Pending != 0)
+    {
+        SCB_ICSR = (1UL << ICSR_PENDSTSET);
+    }
 }
 
 /**
@@ -102,11 +443,10 @@ u32 SysTick_u32RemainingTime(void)
  */
 void SysTick_voidSetTimeIntervalSingle(u32 Copy_u32DelayTime, void (*pf)(void))
 {
-    SYSTICK->SYST_RVR = Copy_u32DelayTime;
-    SYSTICK->SYST_CVR = 0;
-    Globalpf = pf;
-    Flag = 1; // Single interval mode
-    SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    // The holder changes only once the previous handler is withdrawn
+    SysTick_voidStoreHandler(NULL);
+    Global_BareInterval.pfBare = pf;
+    SysTick_voidSetTimeIntervalSingleCtx(Copy_u32DelayTime, (pf != NULL) ? CALLBACK_voidBare : NULL, &Global_BareInterval);
 }
 
 /**
@@ -120,13 +460,407 @@ void SysTick_voidSetTimeIntervalSingle(u32 Copy_u32DelayTime, void (*pf)(void))
  */
 void SysTick_voidSetTimeIntervalPeriodic(u32 Copy_u32DelayTime, void (*pf)(void))
 {
-    SYSTICK->SYST_RVR = Copy_u32DelayTime;
+    // The holder changes only once the previous handler is withdrawn
+    SysTick_voidStoreHandler(NULL);
+    Global_BareInterval.pfBare = pf;
+    SysTick_voidSetTimeIntervalPeriodicCtx(Copy_u32DelayTime, (pf != NULL) ? CALLBACK_voidBare : NULL, &Global_BareInterval);
+}
+
+/**
+ * @brief Set a single-shot time interval with a callback context.
+ *
+ * @param Copy_u32DelayTime: The tick count for the interval.
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ */
+void SysTick_voidSetTimeIntervalSingleCtx(u32 Copy_u32DelayTime, CallBackFn_t pfHandler, void *pvContext)
+{
+    /* The reload value is the delay time: the interval is one tick longer */
+    SysTick_voidStartInterval((Copy_u32DelayTime < 0xFFFFFFFFUL) ? (Copy_u32DelayTime + 1) : Copy_u32DelayTime,
+                              MODE_SINGLE, pfHandler, pvContext);
+}
+
+/**
+ * @brief Set a periodic time interval with a callback context.
+ *
+ * @param Copy_u32DelayTime: The tick count for the interval.
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ */
+void SysTick_voidSetTimeIntervalPeriodicCtx(u32 Copy_u32DelayTime, CallBackFn_t pfHandler, void *pvContext)
+{
+    SysTick_voidStartInterval((Copy_u32DelayTime < 0xFFFFFFFFUL) ? (Copy_u32DelayTime + 1) : Copy_u32DelayTime,
+                              MODE_PERIODIC, pfHandler, pvContext);
+}
+
+/**
+ * @brief Set a single-shot interval of an exact number of ticks.
+ *
+ * @param Copy_u32Ticks: Ticks in the interval (2 to 2^32 - 1).
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ */
+void SysTick_voidSetIntervalSingleTicks(u32 Copy_u32Ticks, CallBackFn_t pfHandler, void *pvContext)
+{
+    SysTick_voidStartInterval(Copy_u32Ticks, MODE_SINGLE, pfHandler, pvContext);
+}
+
+/**
+ * @brief Set a periodic interval of an exact number of ticks.
+ *
+ * @param Copy_u32Ticks: Ticks in the interval (2 to 2^32 - 1).
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ */
+void SysTick_voidSetIntervalPeriodicTicks(u32 Copy_u32Ticks, CallBackFn_t pfHandler, void *pvContext)
+{
+    SysTick_voidStartInterval(Copy_u32Ticks, MODE_PERIODIC, pfHandler, pvContext);
+}
+
+/**
+ * @brief Add a callback run on every SysTick interrupt.
+ *
+ * @param pfHandler: Callback function, receives pvContext.
+ * @param pvContext: Context passed to the callback.
+ * @return u8: STD_OK, or STD_NOK if SYSTICK_MAX_SUBSCRIBERS callbacks are already added.
+ */
+u8 SysTick_u8Subscribe(CallBackFn_t pfHandler, void *pvContext)
+{
+    return CALLBACK_u8Add(Global_TickSubscribers, &Global_u8TickSubscribersCount, SYSTICK_MAX_SUBSCRIBERS,
+                          pfHandler, pvContext);
+}
+
+/**
+ * @brief Remove a callback added by SysTick_u8Subscribe.
+ *
+ * The SysTick interrupt is disabled while the table is compacted.
+ *
+ * @param pfHandler: Callback function.
+ * @param pvContext: Context given at subscription.
+ * @return u8: STD_OK, or STD_NOK if the callback was not found.
+ */
+u8 SysTick_u8Unsubscribe(CallBackFn_t pfHandler, void *pvContext)
+{
+    u8 Local_u8TickInt = GET_BIT(SYSTICK->SYST_CSR, CSR_TICKINT);
+    u8 Local_u8Status;
+
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_TICKINT);
+    Local_u8Status = CALLBACK_u8Remove(Global_TickSubscribers, &Global_u8TickSubscribersCount, pfHandler, pvContext);
+    if (Local_u8TickInt != 0)
+    {
+        SET_BIT(SYSTICK->SYST_CSR, CSR_TICKINT);
+    }
+    return Local_u8Status;
+}
+
+/**
+ * @brief Start the free-running time base.
+ *
+ * The counter wraps every Copy_u32TickPeriod ticks and the ISR extends a
+ * 64-bit tick count at each wrap. The interval callback is dropped; tick
+ * subscribers keep running on every wrap. Setting an interval afterwards
+ * takes the counter over and freezes the time base.
+ *
+ * @param Copy_u32TickPeriod: Ticks between two interrupts (2 to 2^24).
+ */
+void SysTick_voidStartFreeRunning(u32 Copy_u32TickPeriod)
+{
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+
+    Global_u32TickFreq = MRCC_u32GetAHBClockFreq() / SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE);
+    Global_u32TickPeriod = Copy_u32TickPeriod;
+    Global_u64TickBase[0] = 0;
+    Global_u64TickBase[1] = 0;
+    Global_u32TickSeq = 0;
+    SysTick_voidStoreHandler(NULL);
+    ATOMIC_voidStore(&Global_u32Mode, MODE_FREE_RUNNING);
+
+    SYSTICK->SYST_RVR = Copy_u32TickPeriod - 1;
     SYSTICK->SYST_CVR = 0;
-    Globalpf = pf;
-    Flag = 2; // Periodic interval mode
+    SCB_ICSR = (1UL << ICSR_PENDSTCLR); // Drop a wrap left pending by a previous mode
+    SET_BIT(SYSTICK->SYST_CSR, CSR_TICKINT);
     SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
 }
 
+/**
+ * @brief Get the ticks counted since SysTick_voidStartFreeRunning.
+ *
+ * Combines the 64-bit base with the current value register. A wrap that
+ * happened before the ISR could account for it is seen as the pending bit of
+ * SysTick in ICSR; the current value is then read again so it belongs to the
+ * new period. Safe from any context without disabling interrupts, as long as
+ * the SysTick interrupt is not held off for more than one period.
+ *
+ * @return u64: The tick count.
+ */
+u64 SysTick_u64GetTicks(void)
+{
+    u32 Local_u32Seq, Local_u32Current, Local_u32Extra;
+    u64 Local_u64Base;
+
+    do
+    {
+        Local_u32Seq = Global_u32TickSeq;
+        Local_u64Base = Global_u64TickBase[Local_u32Seq & 1];
+        Local_u32Current = SYSTICK->SYST_CVR;
+        Local_u32Extra = 0;
+        if (GET_BIT(SCB_ICSR, ICSR_PENDSTSET) != 0)
+        {
+            Local_u32Current = SYSTICK->SYST_CVR; // After the wrap for sure
+            Local_u32Extra = Global_u32TickPeriod;
+        }
+    } while (Local_u32Seq != Global_u32TickSeq);
+
+    return Local_u64Base + Local_u32Extra + (Global_u32TickPeriod - 1 - Local_u32Current);
+}
+
+/**
+ * @brief Get the time since SysTick_voidStartFreeRunning in microseconds.
+ *
+ * @return u64: The elapsed microseconds.
+ */
+u64 SysTick_u64GetMicros(void)
+{
+    u64 Local_u64Ticks = SysTick_u64GetTicks();
+
+    if (Global_u32TickFreq == 0)
+    {
+        return 0;
+    }
+    /* Whole seconds and remainder separately, the product cannot overflow */
+    return ((Local_u64Ticks / Global_u32TickFreq) * MICROS_PER_SECOND)
+         + (((Local_u64Ticks % Global_u32TickFreq) * MICROS_PER_SECOND) / Global_u32TickFreq);
+}
+
+/**
+ * @brief Get the time since SysTick_voidStartFreeRunning in milliseconds.
+ *
+ * @return u64: The elapsed milliseconds.
+ */
+u64 SysTick_u64GetMillis(void)
+{
+    u64 Local_u64Ticks = SysTick_u64GetTicks();
+
+    if (Global_u32TickFreq == 0)
+    {
+        return 0;
+    }
+    return ((Local_u64Ticks / Global_u32TickFreq) * MILLIS_PER_SECOND)
+         + (((Local_u64Ticks % Global_u32TickFreq) * MILLIS_PER_SECOND) / Global_u32TickFreq);
+}
+
+/**
+ * @brief Get the number of periods accounted by the SysTick interrupt being handled.
+ *
+ * @return u32: 1, or 1 plus the periods slept through on the first interrupt
+ *              after tickless idle.
+ */
+u32 SysTick_u32GetElapsedPeriods(void)
+{
+    return Global_u32ElapsedPeriods;
+}
+
+/**
+ * @brief Get the frequency of the SysTick counter.
+ *
+ * @return u32: Ticks per second, 0 before SysTick_voidStartFreeRunning.
+ */
+u32 SysTick_u32GetTickFreq(void)
+{
+    return Global_u32TickFreq;
+}
+
+/**
+ * @brief Publish a new time base value, same protocol as the ISR.
+ *
+ * @param Copy_u64Ticks: Ticks to add to the base.
+ */
+static void SysTick_voidAdvanceBase(u64 Copy_u64Ticks)
+{
+    u32 Local_u32Seq = Global_u32TickSeq;
+    Global_u64TickBase[(Local_u32Seq + 1) & 1] = Global_u64TickBase[Local_u32Seq & 1] + Copy_u64Ticks;
+    Global_u32TickSeq = Local_u32Seq + 1;
+}
+
+/**
+ * @brief Restart the counter so the next wrap comes after Copy_u32Ticks ticks,
+ *        then keep wrapping every period.
+ *
+ * @param Copy_u32Ticks: Ticks until the next wrap (2 to 2^24).
+ */
+static void SysTick_voidRestartPeriod(u32 Copy_u32Ticks)
+{
+    SysTick_voidLoadChained(Copy_u32Ticks, Global_u32TickPeriod);
+}
+
+/**
+ * @brief Count one wakeup and refresh the wakeups per second statistic.
+ */
+static void SysTick_voidCountWakeup(void)
+{
+    u64 Local_u64Now = SysTick_u64GetTicks();
+
+    Global_u32Wakeups++;
+    if ((Local_u64Now - Global_u64WakeupWindowStart) >= Global_u32TickFreq)
+    {
+        Global_u32WakeupsPerSecond = Global_u32Wakeups;
+        Global_u32Wakeups = 0;
+        Global_u64WakeupWindowStart = Local_u64Now;
+    }
+}
+
+/**
+ * @brief Split a tickless sleep into the periods it completed and the rest.
+ *
+ * The timeline is counted from the start of the period the sleep began in,
+ * with the compensation for the ticks lost while the counter was stopped.
+ *
+ * @param Copy_u32Current: Counter value when the sleep began.
+ * @param Copy_u64Slept: Ticks counted during the sleep.
+ * @param Copy_pu32Left: Receives the ticks left to the next period boundary (2 to the period).
+ * @return u32: Period boundaries crossed, the one ending the period when fewer
+ *              than 2 ticks are left included.
+ */
+static u32 SysTick_u32SplitSleep(u32 Copy_u32Current, u64 Copy_u64Slept, u32 *Copy_pu32Left)
+{
+    u64 Local_u64Total = (u64)(Global_u32TickPeriod - 1 - Copy_u32Current) + Copy_u64Slept + SYSTICK_TICKLESS_COMPENSATION;
+    u32 Local_u32Completed = (u32)(Local_u64Total / Global_u32TickPeriod);
+    u32 Local_u32Left = Global_u32TickPeriod - (u32)(Local_u64Total % Global_u32TickPeriod);
+
+    if (Local_u32Left < 2)
+    {
+        /* Too close to the boundary to program it, end the period now */
+        Local_u32Completed++;
+        Local_u32Left = Global_u32TickPeriod;
+    }
+
+    *Copy_pu32Left = Local_u32Left;
+    return Local_u32Completed;
+}
+
+/**
+ * @brief Sleep until the next software deadline with the tick suppressed.
+ *
+ * Runs with interrupts disabled from the deadline query to the restart of the
+ * counter. The reload register is stretched up to the deadline (in chunks of
+ * 2^24 ticks when longer) and the core waits in WFI, which still wakes on any
+ * pending interrupt. On wakeup the slept ticks are added to the time base, the
+ * counter resumes at the same position within its period, and the periods
+ * slept through are delivered to the tick subscribers by the next SysTick
+ * interrupt in one call (SysTick_u32GetElapsedPeriods), which is pended
+ * right away when at least one period completed.
+ *
+ * @param pfGetIdlePeriods: Returns the number of whole periods until the next
+ *                          deadline (0xFFFFFFFF if none), called with interrupts disabled.
+ */
+void SysTick_voidTicklessIdle(u32 (*pfGetIdlePeriods)(void))
+{
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+    u32 Local_u32Periods = (pfGetIdlePeriods != NULL) ? pfGetIdlePeriods() : 0;
+    u32 Local_u32Current, Local_u32Chunk, Local_u32Completed;
+    u64 Local_u64Remaining, Local_u64Slept;
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        u32 Local_u32StopStart, Local_u32Stopped = 0;
+    #endif
+
+    if ((ATOMIC_u32Load(&Global_u32Mode) != MODE_FREE_RUNNING) || (Local_u32Periods < SYSTICK_TICKLESS_MIN_PERIODS)
+        || (GET_BIT(SCB_ICSR, ICSR_PENDSTSET) != 0))
+    {
+        /* Nothing to suppress: sleep until the next interrupt of any kind */
+        SYSTICK_WAIT_FOR_INTERRUPT();
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        SysTick_voidCountWakeup();
+        return;
+    }
+
+    CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        Local_u32StopStart = MDWT_u32GetCycles();
+    #endif
+    Local_u32Current = SYSTICK->SYST_CVR;
+    if (GET_BIT(SCB_ICSR, ICSR_PENDSTSET) != 0)
+    {
+        /* Wrapped just before the stop, let the ISR account for it */
+        SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return;
+    }
+
+    /* Ticks up to the period boundary of the deadline */
+    Local_u64Remaining = (u64)Local_u32Current + 1 + ((u64)(Local_u32Periods - 1) * Global_u32TickPeriod);
+    Local_u64Slept = 0;
+
+    while (Local_u64Remaining != 0)
+    {
+        Local_u32Chunk = (Local_u64Remaining > (SYSTICK_MAX_RELOAD + 1UL)) ? (SYSTICK_MAX_RELOAD + 1UL) : (u32)Local_u64Remaining;
+        SYSTICK->SYST_RVR = Local_u32Chunk - 1;
+        SYSTICK->SYST_CVR = 0;
+        #if SYSTICK_INSTRUMENTATION == ENABLE
+            Local_u32Stopped += MDWT_u32GetCycles() - Local_u32StopStart;
+        #endif
+        SET_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+
+        SYSTICK_WAIT_FOR_INTERRUPT();
+
+        if (GET_BIT(SYSTICK->SYST_CSR, CSR_COUNT_FLAG) != 0) // Reading CSR clears the flag
+        {
+            CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+            #if SYSTICK_INSTRUMENTATION == ENABLE
+                Local_u32StopStart = MDWT_u32GetCycles();
+            #endif
+            SCB_ICSR = (1UL << ICSR_PENDSTCLR); // Accounted below
+            Local_u64Slept += Local_u32Chunk;
+            Local_u64Remaining -= Local_u32Chunk;
+            if (GET_BIT(SCB_ICSR, ICSR_ISRPENDING) != 0)
+            {
+                break; // Another interrupt is waiting as well
+            }
+        }
+        else
+        {
+            /* Woken up early by another interrupt */
+            CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
+            #if SYSTICK_INSTRUMENTATION == ENABLE
+                Local_u32StopStart = MDWT_u32GetCycles();
+            #endif
+            Local_u64Slept += Local_u32Chunk - SYSTICK->SYST_CVR;
+            break;
+        }
+    }
+
+    Local_u32Completed = SysTick_u32SplitSleep(Local_u32Current, Local_u64Slept, &Local_u32Current);
+
+    if (Local_u32Completed != 0)
+    {
+        /* The ISR adds the last period and hands all of them to the subscribers */
+        SysTick_voidAdvanceBase((u64)(Local_u32Completed - 1) * Global_u32TickPeriod);
+        Global_u32SkippedPeriods += Local_u32Completed - 1;
+        SCB_ICSR = (1UL << ICSR_PENDSTSET);
+    }
+
+    SysTick_voidRestartPeriod(Local_u32Current);
+    #if SYSTICK_INSTRUMENTATION == ENABLE
+        Local_u32Stopped += MDWT_u32GetCycles() - Local_u32StopStart;
+        if (Local_u32Stopped > Global_u32TicklessStopped)
+        {
+            Global_u32TicklessStopped = Local_u32Stopped;
+        }
+    #endif
+
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    SysTick_voidCountWakeup();
+}
+
+/**
+ * @brief Get the number of wakeups from idle in the last complete second.
+ *
+ * @return u32: Wakeups per second.
+ */
+u32 SysTick_u32GetWakeupsPerSecond(void)
+{
+    return Global_u32WakeupsPerSecond;
+}
+
 /**
  * @brief Stop the SysTick timer.
  *
@@ -137,25 +871,130 @@ void SysTick_voidStopTimer(void)
     CLR_BIT(SYSTICK->SYST_CSR, CSR_ENABLE);
 }
 
+#if SYSTICK_INSTRUMENTATION == ENABLE
+/**
+ * @brief Take a consistent snapshot of the callback timing.
+ *
+ * The statistics are copied with interrupts disabled, the means are computed
+ * from the copy afterwards.
+ *
+ * @param Copy_pStats: Receives the statistics.
+ */
+void SysTick_voidGetJitterStats(SysTick_JitterStats_t *Copy_pStats)
+{
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+    u64 Local_u64IntervalSum = Global_u64IntervalSum;
+    s64 Local_s64JitterSum = Global_s64JitterSum;
+    u64 Local_u64RunSum = Global_u64RunSum;
+
+    *Copy_pStats = Global_JitterStats;
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+
+    if (Copy_pStats->Invocations != 0)
+    {
+        Copy_pStats->RunMean = (u32)(Local_u64RunSum / Copy_pStats->Invocations);
+    }
+    if (Copy_pStats->IntervalCount != 0)
+    {
+        Copy_pStats->IntervalMean = (u32)(Local_u64IntervalSum / Copy_pStats->IntervalCount);
+        Copy_pStats->JitterMean = (s32)(Local_s64JitterSum / (s64)Copy_pStats->IntervalCount);
+    }
+}
+
+/**
+ * @brief Clear the callback timing statistics.
+ *
+ * The programmed interval is kept; the next run starts a new interval measurement.
+ */
+void SysTick_voidResetJitterStats(void)
+{
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+    SysTick_JitterStats_t *Local_pStats = &Global_JitterStats;
+    u8 Local_u8Bin;
+
+    Local_pStats->Invocations = 0;
+    Local_pStats->Overruns = 0;
+    Local_pStats->IntervalCount = 0;
+    Local_pStats->IntervalLast = 0;
+    Local_pStats->IntervalMin = 0xFFFFFFFFUL;
+    Local_pStats->IntervalMax = 0;
+    Local_pStats->IntervalMean = 0;
+    Local_pStats->JitterMin = (s32)0x7FFFFFFFL;
+    Local_pStats->JitterMax = -(s32)0x7FFFFFFFL - 1;
+    Local_pStats->JitterMean = 0;
+    Local_pStats->RunLast = 0;
+    Local_pStats->RunMin = 0xFFFFFFFFUL;
+    Local_pStats->RunMax = 0;
+    Local_pStats->RunMean = 0;
+    for (Local_u8Bin = 0; Local_u8Bin < SYSTICK_JITTER_BINS; Local_u8Bin++)
+    {
+        Local_pStats->Histogram[Local_u8Bin] = 0;
+    }
+    Global_u64IntervalSum = 0;
+    Global_s64JitterSum = 0;
+    Global_u64RunSum = 0;
+    Global_u8JitterPrimed = FALSE;
+
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+}
+
+/**
+ * @brief Get the longest time the counter stood stopped in one tickless sleep.
+ *
+ * The value to put in SYSTICK_TICKLESS_STOPPED_CYCLES, measured from the stop
+ * before the counter is read to the restart of the period, including the
+ * stops between chunks of a sleep longer than 2^24 ticks.
+ *
+ * @return u32: Core cycles, 0 before the first tickless sleep.
+ */
+u32 SysTick_u32GetTicklessStoppedCycles(void)
+{
+    return Global_u32TicklessStopped;
+}
+#endif
+
 /**
  * @brief SysTick interrupt handler.
  *
- * Executes the registered callback function. In single interval mode,
- * it stops the timer after executing the callback; in periodic mode, it continues.
+ * Executes the registered callback function at the end of each interval (the
+ * last reload of a chained one). In single interval mode, it stops the timer
+ * before executing the callback; in periodic mode, it continues.
+ * The subscribed tick callbacks run after it on every interrupt.
  */
 void SysTick_Handler(void)
 {
-    if (Globalpf != NULL)
+    u32 Local_u32Mode = ATOMIC_u32Load(&Global_u32Mode);
+    ST_CallBack_t Local_Callback;
+
+    if (Local_u32Mode == MODE_FREE_RUNNING)
     {
-        switch (Flag)
+        /* Extend the time base first so subscribers see the new period */
+        SysTick_voidAdvanceBase(Global_u32TickPeriod);
+
+        /* Periods slept through in tickless idle come with this one, the
+         * subscribers advance by all of them in a single call */
+        Global_u32ElapsedPeriods = Global_u32SkippedPeriods + 1;
+        Global_u32SkippedPeriods = 0;
+    }
+    else if (SysTick_u8ChainWrap() == TRUE)
+    {
+        Local_Callback.pfHandler = SysTick_pfLoadHandler();
+        Local_Callback.pvContext = ATOMIC_pvLoad(&Globalpf.pvContext);
+        if (Local_Callback.pfHandler != NULL)
         {
-            case 1: 
-                Globalpf();             // Execute callback for single interval
-                SysTick_voidStopTimer(); // Stop timer after single interval
-                break;
-            case 2:
-                Globalpf();             // Execute callback for periodic interval
-                break;
+            switch (Local_u32Mode)
+            {
+                case MODE_SINGLE: 
+                    SysTick_voidStopTimer();                            // Stop timer after single interval
+                    SysTick_voidRunIntervalCallback(&Local_Callback);   // Execute callback for single interval
+                    break;
+                case MODE_PERIODIC:
+                    SysTick_voidRunIntervalCallback(&Local_Callback);   // Execute callback for periodic interval
+                    break;
+            }
         }
     }
+
+    CALLBACK_voidInvokeAll(Global_TickSubscribers, Global_u8TickSubscribersCount);
+    Global_u32ElapsedPeriods = 1;
 }
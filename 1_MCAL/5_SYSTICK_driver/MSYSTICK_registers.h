@@ -31,5 +31,8 @@
  /* Define a pointer for register access */
  #define SYSTICK    ((volatile SysTic_t*)SYSTICK_BASE_ADDRESS)
  
+ /* Interrupt Control and State Register of the SCB, holds the SysTick pending bit */
+ #define SCB_ICSR   *((volatile u32*)(0xE000ED04))
+ 
  #endif /* MSYSTICK_REGISTERS_H_ */
  
\ No newline at end of file
@@ -0,0 +1,67 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSYSTICK_time.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/*
+ * MSYSTICK_time.h
+ *
+ * @brief Time based SysTick APIs. Milliseconds and microseconds are turned
+ *        into ticks from the RCC and SysTick configuration at compile time
+ *        when the arguments are constants, and constant values that cannot
+ *        be programmed stop the build (array 'SysTick_IntervalOutOfRange'
+ *        has a negative size). Intervals longer than the 24-bit reload
+ *        register are chained by the driver.
+ */
+
+ #ifndef MSYSTICK_TIME_H_
+ #define MSYSTICK_TIME_H_
+ 
+ #include "MRCC_clock.h"
+ #include "MSYSTICK_private.h"
+ #include "MSYSTICK_config.h"
+ 
+ /* SysTick counter frequency */
+ #define SYSTICK_COUNTER_HZ      (MRCC_AHB_CLOCK_HZ / SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE))
+ 
+ /* Time to ticks, a multiplication when the frequency allows it */
+ #if (SYSTICK_COUNTER_HZ % 1000UL) == 0
+ #define SYSTICK_MS_TO_TICKS(MS)    ((u64)(MS) * (SYSTICK_COUNTER_HZ / 1000UL))
+ #else
+ #define SYSTICK_MS_TO_TICKS(MS)    (((u64)(MS) * SYSTICK_COUNTER_HZ) / 1000UL)
+ #endif
+ 
+ #if (SYSTICK_COUNTER_HZ % 1000000UL) == 0
+ #define SYSTICK_US_TO_TICKS(US)    ((u64)(US) * (SYSTICK_COUNTER_HZ / 1000000UL))
+ #else
+ #define SYSTICK_US_TO_TICKS(US)    (((u64)(US) * SYSTICK_COUNTER_HZ) / 1000000UL)
+ #endif
+ 
+ /* Ticks as u32, checked at compile time when constant: 2 to 2^32 - 1.
+  * Values computed at run time must stay in the same range. */
+ #define SYSTICK_CHECKED_TICKS(TICKS)                                                            \
+     ((u32)(TICKS) + 0 * sizeof(struct { char SysTick_IntervalOutOfRange[                        \
+         __builtin_choose_expr(__builtin_constant_p(TICKS),                                      \
+                               (((TICKS) >= 2) && ((TICKS) <= 0xFFFFFFFFULL)) ? 1 : -1, 1)]; }))
+ 
+ /**
+  * @brief Busy-wait delays.
+  */
+ #define SYSTICK_DELAY_MS(MS)    SysTick_voidBusyWait(SYSTICK_CHECKED_TICKS(SYSTICK_MS_TO_TICKS(MS)))
+ #define SYSTICK_DELAY_US(US)    SysTick_voidBusyWait(SYSTICK_CHECKED_TICKS(SYSTICK_US_TO_TICKS(US)))
+ 
+ /**
+  * @brief Single-shot and periodic intervals with a callback context (CALLBACK.h).
+  */
+ #define SYSTICK_INTERVAL_SINGLE_MS(MS, FN, CTX)     \
+     SysTick_voidSetIntervalSingleTicks(SYSTICK_CHECKED_TICKS(SYSTICK_MS_TO_TICKS(MS)), (FN), (CTX))
+ #define SYSTICK_INTERVAL_SINGLE_US(US, FN, CTX)     \
+     SysTick_voidSetIntervalSingleTicks(SYSTICK_CHECKED_TICKS(SYSTICK_US_TO_TICKS(US)), (FN), (CTX))
+ #define SYSTICK_INTERVAL_PERIODIC_MS(MS, FN, CTX)   \
+     SysTick_voidSetIntervalPeriodicTicks(SYSTICK_CHECKED_TICKS(SYSTICK_MS_TO_TICKS(MS)), (FN), (CTX))
+ #define SYSTICK_INTERVAL_PERIODIC_US(US, FN, CTX)   \
+     SysTick_voidSetIntervalPeriodicTicks(SYSTICK_CHECKED_TICKS(SYSTICK_US_TO_TICKS(US)), (FN), (CTX))
+ 
+ #endif /* MSYSTICK_TIME_H_ */
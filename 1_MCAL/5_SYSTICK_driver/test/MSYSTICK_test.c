@@ -0,0 +1,489 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MSYSTICK_test.c                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the SysTick driver, built with the Makefile next to it.
+ *
+ * The driver is compiled in with its registers moved to host variables and
+ * the RCC and NVIC drivers stubbed. The counter loads its reload value like
+ * the hardware, and counts one tick per register access where a test needs
+ * it to run. WFI is replaced by a simulation of the counter: each sleep either runs a whole reload (COUNTFLAG and the SysTick
+ * pending bit set, optionally with another interrupt pending) or is cut
+ * short by another interrupt after a number of ticks. What runs on the host:
+ * - the early returns of tickless idle: not free-running, too short an idle
+ *   time, a wrap already pending or taken just before the counter stops;
+ * - the reload plan of a sleep, in chunks of at most 2^24 ticks up to the
+ *   period boundary of the deadline;
+ * - the time base after the wakeup: read right after the restart it is the
+ *   simulated time plus the compensation (one tick more when the period is
+ *   ended early), the periods slept through are handed to the subscribers by
+ *   the pended interrupt, and the split of a sleep at every boundary case;
+ * - a busy wait pausing a chained periodic interval, with and without a
+ *   wrap pending, and resuming it where it was without switching the clock
+ *   source, its callback not run and no wrap of the wait reaching the ISR. */
+
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "MSYSTICK_registers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The counter and the SCB interrupt control register on the host */
+static volatile SysTic_t Host_SysTick;
+static u8  Host_u8Ticking = FALSE;          // every register access is one counter tick
+static u64 Host_u64Ticked = 0;              // ticks counted while ticking
+static u32 Host_u32Icsr = 0;
+static u32 Host_u32IcsrSticky = 0;          // bits held by the simulated hardware (ISRPENDING)
+static u32 Host_u32IcsrAccesses = 0;
+static u32 Host_u32PendAtAccess = 0;        // the counter wraps at this access of ICSR, 0 for never
+
+/* Every access goes through here, so the write-one-to-clear bit and the
+ * bits driven by the hardware take effect before the next access */
+static u32 *Host_pu32Icsr(void)
+{
+    if ((Host_u32Icsr & (1UL << 25)) != 0)
+    {
+        Host_u32Icsr &= ~((1UL << 25) | (1UL << 26));
+    }
+    Host_u32Icsr |= Host_u32IcsrSticky;
+    Host_u32IcsrAccesses++;
+    if (Host_u32IcsrAccesses == Host_u32PendAtAccess)
+    {
+        Host_u32Icsr |= (1UL << 26);
+    }
+    return &Host_u32Icsr;
+}
+
+/* Every access goes through here too: an enabled counter at 0 loads the
+ * reload value (a write of the current value clears COUNTFLAG), and when
+ * ticking it counts down, setting COUNTFLAG and pending its interrupt when
+ * TICKINT is set at each wrap */
+static volatile SysTic_t *Host_pSysTick(void)
+{
+    if (GET_BIT(Host_SysTick.SYST_CSR, 0) != 0)
+    {
+        if (Host_SysTick.SYST_CVR == 0)
+        {
+            Host_SysTick.SYST_CVR = Host_SysTick.SYST_RVR;
+            CLR_BIT(Host_SysTick.SYST_CSR, 16);
+            Host_u64Ticked += (Host_u8Ticking != FALSE) ? 1 : 0;
+        }
+        else if (Host_u8Ticking != FALSE)
+        {
+            Host_u64Ticked++;
+            if (--Host_SysTick.SYST_CVR == 0)
+            {
+                SET_BIT(Host_SysTick.SYST_CSR, 16);
+                Host_SysTick.SYST_CVR = Host_SysTick.SYST_RVR;
+                if (GET_BIT(Host_SysTick.SYST_CSR, 1) != 0)
+                {
+                    Host_u32Icsr |= (1UL << 26);
+                }
+            }
+        }
+    }
+    return &Host_SysTick;
+}
+
+#undef SYSTICK
+#define SYSTICK     (Host_pSysTick())
+#undef SCB_ICSR
+#define SCB_ICSR    (*Host_pu32Icsr())
+
+static void Host_voidWfi(void);
+#define SYSTICK_WAIT_FOR_INTERRUPT()    Host_voidWfi()
+
+#include "MSYSTICK_program.c"
+
+/****************************************************/
+/* STUBS                                            */
+/****************************************************/
+u32 MNVIC_u32DisableInterrupts(void)
+{
+    return 0;
+}
+
+void MNVIC_voidRestoreInterrupts(u32 Copy_u32State)
+{
+    (void)Copy_u32State;
+}
+
+u32 MRCC_u32GetAHBClockFreq(void)
+{
+    return 84000000UL;
+}
+
+/****************************************************/
+/* HELPERS                                          */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#define TEST_MAX_CHUNKS     8
+#define TEST_FULL           0xFFFFFFFFUL    // the chunk runs to its end
+
+/* Simulated sleep */
+static u8  Host_u8Tickless = FALSE;         // WFI runs a tickless chunk
+static u32 Host_u32Wfis = 0;
+static u32 Host_u32Chunk = 0;               // chunk being slept
+static u32 Host_Wake[TEST_MAX_CHUNKS];      // ticks slept in each chunk, TEST_FULL for all of it
+static u8  Host_Other[TEST_MAX_CHUNKS];     // another interrupt is pending at the end of the chunk
+static u64 Host_u64Remaining = 0;           // ticks the driver must still plan
+static u64 Host_u64Slept = 0;               // ticks the simulated counter ran
+static u32 Host_u32Elapsed = 0;             // periods seen by the subscriber
+
+static void Host_voidWfi(void)
+{
+    u32 Local_u32Chunk, Local_u32Expected;
+
+    Host_u32Wfis++;
+    if (Host_u8Tickless == FALSE)
+    {
+        return;
+    }
+
+    Local_u32Chunk = (u32)(Host_SysTick.SYST_RVR + 1);
+    Local_u32Expected = (Host_u64Remaining > (SYSTICK_MAX_RELOAD + 1UL)) ? (SYSTICK_MAX_RELOAD + 1UL) : (u32)Host_u64Remaining;
+    CHECK(Host_u32Chunk < TEST_MAX_CHUNKS, "more chunks than planned");
+    CHECK(Local_u32Chunk == Local_u32Expected, "chunk %u of %u ticks instead of %u",
+          (unsigned)Host_u32Chunk, (unsigned)Local_u32Chunk, (unsigned)Local_u32Expected);
+    CHECK(Host_SysTick.SYST_CVR == 0, "chunk started at %u", (unsigned)Host_SysTick.SYST_CVR);
+    CHECK(GET_BIT(Host_SysTick.SYST_CSR, CSR_ENABLE) != 0, "asleep with the counter stopped");
+    if (Host_u32Chunk >= TEST_MAX_CHUNKS)
+    {
+        return;
+    }
+
+    if (Host_Wake[Host_u32Chunk] >= Local_u32Chunk)
+    {
+        SET_BIT(Host_SysTick.SYST_CSR, CSR_COUNT_FLAG);
+        Host_SysTick.SYST_CVR = Local_u32Chunk - 1;
+        Host_u32Icsr |= (1UL << 26);
+        Host_u64Slept += Local_u32Chunk;
+    }
+    else
+    {
+        CLR_BIT(Host_SysTick.SYST_CSR, CSR_COUNT_FLAG);
+        Host_SysTick.SYST_CVR = Local_u32Chunk - Host_Wake[Host_u32Chunk];
+        Host_u64Slept += Host_Wake[Host_u32Chunk];
+    }
+    Host_u32IcsrSticky = (Host_Other[Host_u32Chunk] != FALSE) ? (1UL << 22) : 0;
+    Host_u64Remaining -= Local_u32Chunk;
+    Host_u32Chunk++;
+}
+
+static void Test_voidSubscriber(void *pvContext)
+{
+    (void)pvContext;
+    Host_u32Elapsed = SysTick_u32GetElapsedPeriods();
+}
+
+static u32 Test_u32Random(void)
+{
+    return ((u32)rand() << 16) ^ (u32)rand();
+}
+
+static u32 Test_u32Idle = 0;                // idle periods reported to the driver
+
+static u32 Test_u32GetIdlePeriods(void)
+{
+    return Test_u32Idle;
+}
+
+/* Starts the time base with the counter at Copy_u32Current (not 0: it would reload at the next access) */
+static void Test_voidStart(u32 Copy_u32Period, u32 Copy_u32Current)
+{
+    SysTick_voidStartFreeRunning(Copy_u32Period);
+    Host_SysTick.SYST_CVR = Copy_u32Current;
+    Host_SysTick.SYST_CSR &= ~(1UL << CSR_COUNT_FLAG);
+    Host_u32Icsr = 0;
+    Host_u32IcsrSticky = 0;
+    Host_u32IcsrAccesses = 0;
+    Host_u32PendAtAccess = 0;
+    Global_u32SkippedPeriods = 0;
+    Host_u32Wfis = 0;
+}
+
+/* Takes the pended SysTick interrupt like the core would */
+static void Test_voidTakeInterrupt(void)
+{
+    Host_u32Elapsed = 0;
+    if ((Host_u32Icsr & (1UL << 26)) != 0)
+    {
+        Host_u32Icsr &= ~(1UL << 26);
+        SysTick_Handler();
+    }
+}
+
+/****************************************************/
+/* TESTS                                            */
+/****************************************************/
+
+/* Idle calls that must sleep once without touching the counter */
+static void Test_voidPlainSleep(void)
+{
+    Host_u8Tickless = FALSE;
+
+    /* Not free-running */
+    Global_u32Mode = MODE_PERIODIC;
+    Host_SysTick.SYST_RVR = 999;
+    Host_u32Wfis = 0;
+    Test_u32Idle = 100;
+    SysTick_voidTicklessIdle(Test_u32GetIdlePeriods);
+    CHECK(Host_u32Wfis == 1, "periodic mode: %u sleeps", (unsigned)Host_u32Wfis);
+    CHECK(Host_SysTick.SYST_RVR == 999, "periodic mode: reload changed");
+
+    /* Below the minimum idle time */
+    Test_voidStart(10500, 4000);
+    Test_u32Idle = SYSTICK_TICKLESS_MIN_PERIODS - 1;
+    SysTick_voidTicklessIdle(Test_u32GetIdlePeriods);
+    CHECK(Host_u32Wfis == 1, "short idle: %u sleeps", (unsigned)Host_u32Wfis);
+    CHECK((Host_SysTick.SYST_RVR == 10499) && (Host_SysTick.SYST_CVR == 4000), "short idle: counter changed");
+
+    /* No callback */
+    Test_voidStart(10500, 4000);
+    SysTick_voidTicklessIdle(NULL);
+    CHECK(Host_u32Wfis == 1, "no callback: %u sleeps", (unsigned)Host_u32Wfis);
+
+    /* A wrap is already pending */
+    Test_voidStart(10500, 4000);
+    Host_u32Icsr = (1UL << 26);
+    Test_u32Idle = 100;
+    SysTick_voidTicklessIdle(Test_u32GetIdlePeriods);
+    CHECK(Host_u32Wfis == 1, "pending wrap: %u sleeps", (unsigned)Host_u32Wfis);
+    CHECK(Host_SysTick.SYST_RVR == 10499, "pending wrap: reload changed");
+
+    /* The counter wraps between the check and the stop */
+    Test_voidStart(10500, 4000);
+    Host_u32PendAtAccess = 2;
+    SysTick_voidTicklessIdle(Test_u32GetIdlePeriods);
+    CHECK(Host_u32Wfis == 0, "wrap at the stop: %u sleeps", (unsigned)Host_u32Wfis);
+    CHECK(GET_BIT(Host_SysTick.SYST_CSR, CSR_ENABLE) != 0, "wrap at the stop: counter left stopped");
+    CHECK((Host_SysTick.SYST_RVR == 10499) && ((Host_u32Icsr & (1UL << 26)) != 0), "wrap at the stop: wrap lost");
+    CHECK(Global_u32SkippedPeriods == 0, "wrap at the stop: %u periods skipped", (unsigned)Global_u32SkippedPeriods);
+}
+
+/* One tickless sleep against the simulated time */
+static void Test_voidSleep(u32 Copy_u32Period, u32 Copy_u32Current, u32 Copy_u32Idle)
+{
+    u64 Local_u64Real, Local_u64Ticks;
+    u32 Local_u32Completed, Local_u32Left;
+
+    Test_voidStart(Copy_u32Period, Copy_u32Current);
+    Host_u8Tickless = TRUE;
+    Host_u32Chunk = 0;
+    Host_u64Slept = 0;
+    Host_u64Remaining = (u64)Copy_u32Current + 1 + ((u64)(Copy_u32Idle - 1) * Copy_u32Period);
+    Test_u32Idle = Copy_u32Idle;
+
+    SysTick_voidTicklessIdle(Test_u32GetIdlePeriods);
+    Host_u8Tickless = FALSE;
+    Host_u32IcsrSticky = 0;
+
+    /* Ticks from the start of the period the sleep began in, with the ones lost while stopped */
+    Local_u64Real = (u64)(Copy_u32Period - 1 - Copy_u32Current) + Host_u64Slept + SYSTICK_TICKLESS_COMPENSATION;
+    Local_u32Completed = (u32)(Local_u64Real / Copy_u32Period);
+    Local_u32Left = Copy_u32Period - (u32)(Local_u64Real % Copy_u32Period);
+    if (Local_u32Left < 2)
+    {
+        Local_u32Completed++;
+        Local_u32Left = Copy_u32Period;
+    }
+
+    CHECK(Host_u32Chunk >= 1, "no sleep");
+    CHECK(Host_SysTick.SYST_RVR == (Copy_u32Period - 1), "period reload %u", (unsigned)Host_SysTick.SYST_RVR);
+    CHECK(GET_BIT(Host_SysTick.SYST_CSR, CSR_ENABLE) != 0, "counter left stopped");
+    CHECK((GET_BIT(Host_SysTick.SYST_CSR, CSR_CLOCKSOURCE) != 0) == (SYSTICK_CLOCKSOURCE == AHB),
+          "clock source left switched");
+    CHECK(((Host_u32Icsr >> 26) & 1) == (Local_u32Completed != 0), "pending %u after %u periods",
+          (unsigned)((Host_u32Icsr >> 26) & 1), (unsigned)Local_u32Completed);
+
+    /* Right after the restart the counter is Local_u32Left ticks away from its wrap */
+    Host_SysTick.SYST_CVR = Local_u32Left - 1;
+    Local_u64Ticks = SysTick_u64GetTicks();
+    CHECK((Local_u64Ticks >= Local_u64Real) && (Local_u64Ticks <= (Local_u64Real + 1)),
+          "time base %llu for %llu ticks (period %u, from %u, slept %llu)",
+          (unsigned long long)Local_u64Ticks, (unsigned long long)Local_u64Real, (unsigned)Copy_u32Period,
+          (unsigned)Copy_u32Current, (unsigned long long)Host_u64Slept);
+
+    /* The pended interrupt hands every period to the subscribers in one call */
+    Test_voidTakeInterrupt();
+    CHECK(Host_u32Elapsed == Local_u32Completed, "subscribers saw %u periods instead of %u",
+          (unsigned)Host_u32Elapsed, (unsigned)Local_u32Completed);
+    CHECK(SysTick_u64GetTicks() == Local_u64Ticks, "time base moved by the interrupt");
+}
+
+/* Sleeps to the deadline, cut short, and woken with another interrupt pending */
+static void Test_voidTickless(void)
+{
+    static const u32 Local_Periods[] = { 10500, 2, 3, 1000, 0x01000000UL };
+    u32 Local_u32Idx, Local_u32Run, Local_u32Period, Local_u32Chunk;
+
+    /* Whole sleeps, one chunk and several */
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_MAX_CHUNKS; Local_u32Idx++)
+    {
+        Host_Wake[Local_u32Idx] = TEST_FULL;
+        Host_Other[Local_u32Idx] = FALSE;
+    }
+    Test_voidSleep(10500, 10499, 2);
+    Test_voidSleep(10500, 1, 2);
+    Test_voidSleep(10500, 5000, 1000);
+    Test_voidSleep(10500, 5000, 5000);      // 5.2e7 ticks, 4 chunks
+    Test_voidSleep(0x01000000UL, 0x00FFFFFFUL, 3);
+
+    /* Woken by another interrupt at the end of the first chunk */
+    Host_Other[0] = TRUE;
+    Test_voidSleep(10500, 5000, 5000);
+    CHECK(Host_u32Chunk == 1, "slept on with an interrupt pending");
+    Host_Other[0] = FALSE;
+
+    /* Woken early at every boundary of the period */
+    for (Local_u32Run = 0; Local_u32Run < 10500; Local_u32Run++)
+    {
+        Host_Wake[0] = Local_u32Run + 1;
+        Test_voidSleep(10500, 3000, 3);
+    }
+
+    /* Random sleeps */
+    srand(7);
+    for (Local_u32Run = 0; Local_u32Run < 100000; Local_u32Run++)
+    {
+        Local_u32Period = Local_Periods[Local_u32Run % (sizeof(Local_Periods) / sizeof(Local_Periods[0]))];
+        if (Local_u32Period < 4)
+        {
+            Local_u32Period = 2 + (Test_u32Random() % 20000);
+        }
+        for (Local_u32Idx = 0; Local_u32Idx < TEST_MAX_CHUNKS; Local_u32Idx++)
+        {
+            Host_Wake[Local_u32Idx] = TEST_FULL;
+            Host_Other[Local_u32Idx] = ((Test_u32Random() % 8) == 0) ? TRUE : FALSE;
+        }
+        Local_u32Chunk = Test_u32Random() % TEST_MAX_CHUNKS;
+        if ((Test_u32Random() % 2) == 0)
+        {
+            Host_Wake[Local_u32Chunk] = 1 + (Test_u32Random() % Local_u32Period);
+        }
+        Test_voidSleep(Local_u32Period, 1 + (Test_u32Random() % (Local_u32Period - 1)),
+                       SYSTICK_TICKLESS_MIN_PERIODS + (Test_u32Random() % ((0x04000000UL / Local_u32Period) + 1)));
+    }
+}
+
+/* The split of a sleep at the period boundaries */
+static void Test_voidSplit(void)
+{
+    u32 Local_u32Left, Local_u32Completed;
+    u32 Local_u32Comp = SYSTICK_TICKLESS_COMPENSATION;
+
+    CHECK(Local_u32Comp == ((SYSTICK_TICKLESS_STOPPED_CYCLES + (SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE) / 2)) / SYSTICK_DIVIDER(SYSTICK_CLOCKSOURCE)),
+          "compensation %u", (unsigned)Local_u32Comp);
+
+    Global_u32TickPeriod = 100;
+
+    /* Starting at the top of a period: the slept ticks are the position */
+    Local_u32Completed = SysTick_u32SplitSleep(99, 10, &Local_u32Left);
+    CHECK((Local_u32Completed == 0) && (Local_u32Left == (90 - Local_u32Comp)), "10 ticks: %u, %u",
+          (unsigned)Local_u32Completed, (unsigned)Local_u32Left);
+
+    /* Exactly on a boundary */
+    Local_u32Completed = SysTick_u32SplitSleep(99, 300 - Local_u32Comp, &Local_u32Left);
+    CHECK((Local_u32Completed == 3) && (Local_u32Left == 100), "3 periods: %u, %u",
+          (unsigned)Local_u32Completed, (unsigned)Local_u32Left);
+
+    /* One tick short of a boundary: the period is ended now */
+    Local_u32Completed = SysTick_u32SplitSleep(99, 299 - Local_u32Comp, &Local_u32Left);
+    CHECK((Local_u32Completed == 3) && (Local_u32Left == 100), "1 tick left: %u, %u",
+          (unsigned)Local_u32Completed, (unsigned)Local_u32Left);
+
+    /* Two ticks short is still programmed */
+    Local_u32Completed = SysTick_u32SplitSleep(99, 298 - Local_u32Comp, &Local_u32Left);
+    CHECK((Local_u32Completed == 2) && (Local_u32Left == 2), "2 ticks left: %u, %u",
+          (unsigned)Local_u32Completed, (unsigned)Local_u32Left);
+
+    /* Started mid period */
+    Local_u32Completed = SysTick_u32SplitSleep(40, 41, &Local_u32Left);
+    CHECK((Local_u32Completed == 1) && (Local_u32Left == (100 - Local_u32Comp)), "mid period: %u, %u",
+          (unsigned)Local_u32Completed, (unsigned)Local_u32Left);
+}
+
+static u32 Global_u32IntervalRuns = 0;
+
+static void Test_voidInterval(void *pvContext)
+{
+    (void)pvContext;
+    Global_u32IntervalRuns++;
+}
+
+/* A busy wait in the middle of a chained periodic interval */
+static void Test_voidBusyWaitPaused(u8 Copy_u8Pending)
+{
+    u32 Local_u32Reload, Local_u32Index, Local_u32Segments;
+
+    SysTick_voidSetIntervalPeriodicTicks(40000000UL, Test_voidInterval, NULL);
+    CHECK(Global_u32ChainSegments == 3, "%u segments", (unsigned)Global_u32ChainSegments);
+    CHECK(Host_SysTick.SYST_RVR == (Global_u32ChainLength - 1), "next segment not loaded");
+    CHECK(Host_SysTick.SYST_CVR == (Global_u32ChainFirst - 1), "first segment not loaded");
+    CHECK(GET_BIT(Host_SysTick.SYST_CSR, CSR_CLOCKSOURCE) == 0, "clock source switched");
+
+    /* Somewhere in the second segment */
+    Global_u32ChainIndex = 1;
+    Host_SysTick.SYST_CVR = 12345;
+    Host_u32Icsr = (Copy_u8Pending != FALSE) ? (1UL << 26) : 0;
+    Local_u32Reload = (u32)Host_SysTick.SYST_RVR;
+    Local_u32Index = Global_u32ChainIndex;
+    Local_u32Segments = Global_u32ChainSegments;
+    Global_u32IntervalRuns = 0;
+
+    Host_u8Ticking = TRUE;
+    Host_u64Ticked = 0;
+    SysTick_voidBusyWait(40000000UL);
+    Host_u8Ticking = FALSE;
+
+    CHECK((Host_u64Ticked >= 40000000UL) && (Host_u64Ticked <= 40000010UL), "waited %llu ticks",
+          (unsigned long long)Host_u64Ticked);
+    CHECK(Global_u32IntervalRuns == 0, "interval callback run during the wait");
+    CHECK((Global_u32ChainIndex == Local_u32Index) && (Global_u32ChainSegments == Local_u32Segments), "chain changed");
+    CHECK(Host_SysTick.SYST_RVR == Local_u32Reload, "reload %u instead of %u", (unsigned)Host_SysTick.SYST_RVR,
+          (unsigned)Local_u32Reload);
+    CHECK((Host_SysTick.SYST_CVR <= 12344) && (Host_SysTick.SYST_CVR >= 12340), "resumed at %u",
+          (unsigned)Host_SysTick.SYST_CVR);
+    CHECK((GET_BIT(Host_SysTick.SYST_CSR, CSR_ENABLE) != 0) && (GET_BIT(Host_SysTick.SYST_CSR, CSR_TICKINT) != 0),
+          "interval not resumed");
+    CHECK(((Host_u32Icsr >> 26) & 1) == Copy_u8Pending, "pending %u", (unsigned)((Host_u32Icsr >> 26) & 1));
+}
+
+/* Busy waits around an interval */
+static void Test_voidBusyWait(void)
+{
+    Host_u8Tickless = FALSE;
+    Test_voidBusyWaitPaused(FALSE);
+    Test_voidBusyWaitPaused(TRUE);
+
+    /* Nothing armed: the counter is left stopped */
+    SysTick_voidStopTimer();
+    Host_u32Icsr = 0;
+    Host_u8Ticking = TRUE;
+    Host_u64Ticked = 0;
+    SysTick_voidBusyWait(1000);
+    Host_u8Ticking = FALSE;
+    CHECK((Host_u64Ticked >= 1000) && (Host_u64Ticked <= 1010), "waited %llu ticks", (unsigned long long)Host_u64Ticked);
+    CHECK((GET_BIT(Host_SysTick.SYST_CSR, CSR_ENABLE) == 0) && (Host_SysTick.SYST_RVR == 0), "counter left running");
+    CHECK((Host_u32Icsr & (1UL << 26)) == 0, "wrap pended by the wait");
+}
+
+int main(void)
+{
+    SysTick_u8Subscribe(Test_voidSubscriber, NULL);
+
+    Test_voidSplit();
+    Test_voidPlainSleep();
+    Test_voidTickless();
+    Test_voidBusyWait();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
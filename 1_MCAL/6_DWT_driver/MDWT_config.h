@@ -0,0 +1,14 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDWT_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDWT_CONFIG_H_
+#define MDWT_CONFIG_H_
+
+/* No build options: the cycles spent by a delay call outside of its wait
+ * loop are measured by MDWT_voidInit on the running build. */
+
+#endif /* MDWT_CONFIG_H_ */
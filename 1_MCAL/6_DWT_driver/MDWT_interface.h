@@ -0,0 +1,77 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDWT_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDWT_INTERFACE_H_
+#define MDWT_INTERFACE_H_
+
+/**
+ * @brief Stopwatch measuring core cycles with the DWT cycle counter.
+ */
+typedef struct
+{
+    u32 Start;      /**< Counter value at start */
+    u32 Lap;        /**< Counter value at the last lap */
+} MDWT_Stopwatch_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Enables the DWT cycle counter, without clearing it when it already
+ *        runs, and measures the overhead of an empty stopwatch interval and of
+ *        a delay call. SysTick is not used, delays and stopwatches can run
+ *        while SysTick keeps its own configuration. The delays call it
+ *        themselves when it has not run yet.
+ */
+void MDWT_voidInit(void);
+
+/**
+ * @brief Gets the free-running core cycle counter (wraps every 2^32 cycles).
+ * @return The cycle count.
+ */
+u32 MDWT_u32GetCycles(void);
+
+/**
+ * @brief Busy-waits a number of core cycles, the measured call overhead included.
+ * @param Copy_u32Cycles Cycles to wait.
+ */
+void MDWT_voidDelayCycles(u32 Copy_u32Cycles);
+
+/**
+ * @brief Busy-waits a number of microseconds at the live AHB frequency.
+ * @param Copy_u32Us Microseconds to wait.
+ */
+void MDWT_voidDelayUs(u32 Copy_u32Us);
+
+/**
+ * @brief Converts a cycle count to microseconds.
+ * @param Copy_u32Cycles Cycles.
+ * @return Microseconds.
+ */
+u32 MDWT_u32CyclesToUs(u32 Copy_u32Cycles);
+
+/**
+ * @brief Starts a stopwatch.
+ * @param Copy_pStopwatch Stopwatch object.
+ */
+void MDWT_voidStopwatchStart(MDWT_Stopwatch_t *Copy_pStopwatch);
+
+/**
+ * @brief Gets the cycles since the previous lap (or the start) and starts a new lap.
+ * @param Copy_pStopwatch Stopwatch object.
+ * @return Cycles of the lap, stopwatch overhead removed.
+ */
+u32 MDWT_u32StopwatchLap(MDWT_Stopwatch_t *Copy_pStopwatch);
+
+/**
+ * @brief Gets the cycles since the start of the stopwatch.
+ *        Intervals must be shorter than 2^32 cycles.
+ * @param Copy_pStopwatch Stopwatch object.
+ * @return Cycles since start, stopwatch overhead removed.
+ */
+u32 MDWT_u32StopwatchStop(MDWT_Stopwatch_t *Copy_pStopwatch);
+
+#endif /* MDWT_INTERFACE_H_ */
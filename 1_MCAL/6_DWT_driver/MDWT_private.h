@@ -0,0 +1,30 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDWT_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDWT_PRIVATE_H_
+#define MDWT_PRIVATE_H_
+
+/* DEMCR Bit Definitions */
+#define DEMCR_TRCENA        24  // Trace and DWT enable
+
+/* DWT CTRL Bit Definitions */
+#define CTRL_CYCCNTENA      0   // Cycle counter enable
+
+/* Key unlocking the DWT registers through LAR */
+#define DWT_LAR_KEY         0xC5ACCE55
+
+/* Longest busy-wait chunk, keeps the wrap-safe comparison valid */
+#define DWT_MAX_CHUNK       0x80000000UL
+
+/* Calibration of the delay overhead: length of the measured delay and
+ * number of measurements, the smallest one is kept */
+#define DWT_CALIBRATION_CYCLES  64
+#define DWT_CALIBRATION_RUNS    4
+
+#define MICROS_PER_SECOND   1000000UL
+
+#endif /* MDWT_PRIVATE_H_ */
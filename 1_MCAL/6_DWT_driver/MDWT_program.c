@@ -0,0 +1,209 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDWT_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+
+/****************************************************/
+/* DWT Directives                                   */
+/****************************************************/
+#include "MDWT_interface.h"
+#include "MDWT_config.h"
+#include "MDWT_private.h"
+#include "MDWT_register.h"
+
+/****************************************************/
+/* RCC Directives                                   */
+/****************************************************/
+#include "MRCC_interface.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static u32 Global_u32CyclesPerUsQ16 = 0;    // Core cycles per microsecond, 16 fractional bits
+static u32 Global_u32CoreFreq = 0;          // Core clock in Hz, 0 before MDWT_voidInit
+static u32 Global_u32ReadOverhead = 0;      // Cycles measured by an empty stopwatch interval
+static u32 Global_u32DelayOverhead = 0;     // Cycles of a delay call outside of its wait loop
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Enable the cycle counter and calibrate the stopwatch and delay overheads.
+ *
+ * The counter is never cleared: a counter already running (started by a
+ * debugger, or by another user calling this function) keeps counting, so the
+ * intervals measured across the call stay right. The overheads are the
+ * smallest of a few measurements, an interrupt taken during one of them
+ * cannot make every later delay short.
+ */
+void MDWT_voidInit(void)
+{
+    MDWT_Stopwatch_t Local_Stopwatch;
+    u32 Local_u32Run, Local_u32Cycles, Local_u32Read = 0xFFFFFFFFUL, Local_u32Delay = 0xFFFFFFFFUL;
+
+    if ((GET_BIT(CoreDebug_DEMCR, DEMCR_TRCENA) == 0) || (GET_BIT(DWT->CTRL, CTRL_CYCCNTENA) == 0))
+    {
+        SET_BIT(CoreDebug_DEMCR, DEMCR_TRCENA);
+        DWT_LAR = DWT_LAR_KEY;
+        SET_BIT(DWT->CTRL, CTRL_CYCCNTENA);
+    }
+
+    /* Scaled and rounded, 16.8 MHz is 16.8 cycles per microsecond and not 16 */
+    Global_u32CoreFreq = MRCC_u32GetAHBClockFreq();
+    Global_u32CyclesPerUsQ16 = (u32)((((u64)Global_u32CoreFreq << 16) + (MICROS_PER_SECOND / 2)) / MICROS_PER_SECOND);
+
+    Global_u32ReadOverhead = 0;
+    Global_u32DelayOverhead = 0;
+    for (Local_u32Run = 0; Local_u32Run < DWT_CALIBRATION_RUNS; Local_u32Run++)
+    {
+        /* An empty interval, removed from every stopwatch reading */
+        MDWT_voidStopwatchStart(&Local_Stopwatch);
+        Local_u32Cycles = DWT->CYCCNT - Local_Stopwatch.Start;
+        Local_u32Read = (Local_u32Cycles < Local_u32Read) ? Local_u32Cycles : Local_u32Read;
+
+        /* A delay with no overhead removed, what it waits beyond the request is removed from every delay */
+        MDWT_voidStopwatchStart(&Local_Stopwatch);
+        MDWT_voidDelayCycles(DWT_CALIBRATION_CYCLES);
+        Local_u32Cycles = DWT->CYCCNT - Local_Stopwatch.Start;
+        Local_u32Delay = (Local_u32Cycles < Local_u32Delay) ? Local_u32Cycles : Local_u32Delay;
+    }
+    Global_u32ReadOverhead = Local_u32Read;
+    Local_u32Delay -= Local_u32Read;
+    Global_u32DelayOverhead = (Local_u32Delay > DWT_CALIBRATION_CYCLES) ? (Local_u32Delay - DWT_CALIBRATION_CYCLES) : 0;
+}
+
+/**
+ * @brief Read the cycle counter.
+ * @return u32: The cycle count.
+ */
+u32 MDWT_u32GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Busy-wait a number of cycles.
+ *
+ * The elapsed time is an unsigned difference, so the wait is right across
+ * the counter wrap. The call overhead measured by MDWT_voidInit is removed
+ * first. Called before MDWT_voidInit, it initializes the driver: the
+ * counter does not run before and the wait would never end.
+ *
+ * @param Copy_u32Cycles: Cycles to wait.
+ */
+void MDWT_voidDelayCycles(u32 Copy_u32Cycles)
+{
+    u32 Local_u32Start;
+
+    if (Global_u32CoreFreq == 0)
+    {
+        MDWT_voidInit();
+    }
+    Local_u32Start = DWT->CYCCNT;
+
+    if (Copy_u32Cycles <= Global_u32DelayOverhead)
+    {
+        return;
+    }
+    Copy_u32Cycles -= Global_u32DelayOverhead;
+
+    while ((DWT->CYCCNT - Local_u32Start) < Copy_u32Cycles);
+}
+
+/**
+ * @brief Busy-wait a number of microseconds.
+ *
+ * Long delays are split in chunks of 2^31 cycles so each wait stays inside
+ * one counter wrap. Called before MDWT_voidInit, it initializes the driver
+ * rather than return at once.
+ *
+ * @param Copy_u32Us: Microseconds to wait.
+ */
+void MDWT_voidDelayUs(u32 Copy_u32Us)
+{
+    u64 Local_u64Cycles;
+    u32 Local_u32Start;
+    u32 Local_u32Chunk;
+
+    if (Global_u32CoreFreq == 0)
+    {
+        MDWT_voidInit();
+    }
+    Local_u32Start = DWT->CYCCNT;
+    Local_u64Cycles = (((u64)Copy_u32Us * Global_u32CyclesPerUsQ16) + 0xFFFFUL) >> 16; // Rounded up, never short
+
+    if (Local_u64Cycles <= Global_u32DelayOverhead)
+    {
+        return;
+    }
+    Local_u64Cycles -= Global_u32DelayOverhead;
+
+    while (Local_u64Cycles != 0)
+    {
+        Local_u32Chunk = (Local_u64Cycles > DWT_MAX_CHUNK) ? DWT_MAX_CHUNK : (u32)Local_u64Cycles;
+        while ((DWT->CYCCNT - Local_u32Start) < Local_u32Chunk);
+        Local_u32Start += Local_u32Chunk;
+        Local_u64Cycles -= Local_u32Chunk;
+    }
+}
+
+/**
+ * @brief Convert cycles to microseconds at the core clock of the init.
+ * @param Copy_u32Cycles: Cycles.
+ * @return u32: Microseconds.
+ */
+u32 MDWT_u32CyclesToUs(u32 Copy_u32Cycles)
+{
+    u32 Local_u32Us = 0;
+
+    if (Global_u32CoreFreq != 0)
+    {
+        Local_u32Us = (u32)(((u64)Copy_u32Cycles * MICROS_PER_SECOND) / Global_u32CoreFreq);
+    }
+    return Local_u32Us;
+}
+
+/**
+ * @brief Start a stopwatch.
+ * @param Copy_pStopwatch: Stopwatch object.
+ */
+void MDWT_voidStopwatchStart(MDWT_Stopwatch_t *Copy_pStopwatch)
+{
+    Copy_pStopwatch->Start = DWT->CYCCNT;
+    Copy_pStopwatch->Lap = Copy_pStopwatch->Start;
+}
+
+/**
+ * @brief Read the current lap and start the next one.
+ * @param Copy_pStopwatch: Stopwatch object.
+ * @return u32: Cycles of the lap.
+ */
+u32 MDWT_u32StopwatchLap(MDWT_Stopwatch_t *Copy_pStopwatch)
+{
+    u32 Local_u32Now = DWT->CYCCNT;
+    u32 Local_u32Lap = Local_u32Now - Copy_pStopwatch->Lap;
+
+    Copy_pStopwatch->Lap = Local_u32Now;
+    return (Local_u32Lap > Global_u32ReadOverhead) ? (Local_u32Lap - Global_u32ReadOverhead) : 0;
+}
+
+/**
+ * @brief Read the time since the start of a stopwatch.
+ * @param Copy_pStopwatch: Stopwatch object.
+ * @return u32: Cycles since start.
+ */
+u32 MDWT_u32StopwatchStop(MDWT_Stopwatch_t *Copy_pStopwatch)
+{
+    u32 Local_u32Total = DWT->CYCCNT - Copy_pStopwatch->Start;
+
+    return (Local_u32Total > Global_u32ReadOverhead) ? (Local_u32Total - Global_u32ReadOverhead) : 0;
+}
@@ -0,0 +1,36 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDWT_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDWT_REGISTER_H_
+#define MDWT_REGISTER_H_
+
+/* Base address of the Data Watchpoint and Trace unit */
+#define DWT_BASE_ADDRESS    0xE0001000
+
+/**
+ * @brief Structure representing the DWT registers used by the driver.
+ */
+typedef struct
+{
+    u32 CTRL;       /**< Control Register */
+    u32 CYCCNT;     /**< Cycle Count Register */
+    u32 CPICNT;     /**< CPI Count Register */
+    u32 EXCCNT;     /**< Exception Overhead Count Register */
+    u32 SLEEPCNT;   /**< Sleep Count Register */
+    u32 LSUCNT;     /**< LSU Count Register */
+    u32 FOLDCNT;    /**< Folded-instruction Count Register */
+} DWT_t;
+
+#define DWT         ((volatile DWT_t*)DWT_BASE_ADDRESS)
+
+/* Lock Access Register, must be unlocked on some cores before DWT writes */
+#define DWT_LAR     *((volatile u32*)(0xE0001FB0))
+
+/* Debug Exception and Monitor Control Register, gates the whole trace block */
+#define CoreDebug_DEMCR *((volatile u32*)(0xE000EDFC))
+
+#endif /* MDWT_REGISTER_H_ */
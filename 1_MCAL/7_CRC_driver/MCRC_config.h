@@ -0,0 +1,25 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MCRC_CONFIG_H_
+#define MCRC_CONFIG_H_
+
+/* MCRC_u8StartWords: feed word blocks to the unit with a DMA2 memory-to-memory
+ * stream while the CPU runs something else. Options: ENABLE or DISABLE */
+#define MCRC_DMA                ENABLE
+
+/* DMA2 stream used for the transfers (0 to 7), any channel works for memory to memory.
+ * Stream 6 is shared with USART6 TX: whichever initializes first gets it, the
+ * CRC then falls back to the CPU. */
+#define MCRC_DMA_STREAM         6
+#define MCRC_DMA_CHANNEL        0
+
+/* NVIC priority of the stream interrupt that chains the chunks and runs the callback */
+#define MCRC_DMA_IRQ_GROUP      3
+#define MCRC_DMA_IRQ_SUBGROUP   0
+
+#endif /* MCRC_CONFIG_H_ */
@@ -0,0 +1,165 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MCRC_INTERFACE_H_
+#define MCRC_INTERFACE_H_
+
+/*
+ * The CRC unit computes CRC-32/MPEG-2 (polynomial 0x04C11DB7, init 0xFFFFFFFF,
+ * MSB first, no final XOR) one 32-bit word at a time.
+ *
+ * Byte streams (MCRC_u32Compute, MCRC_u32ComputeCrc32) are fed in memory
+ * order: every word is byte-swapped (or bit-reversed for the reflected CRC-32)
+ * by the CPU on the way in and the last 1 to 3 bytes are finished in software,
+ * so the results are the standard check values and match the software CRC.
+ *
+ * Word blocks (MCRC_u32ComputeWords) are fed as they are, which is what a DMA
+ * transfer does: each word counts as its 4 bytes most significant first.
+ *
+ * The CPU feeds a word about as fast as the unit takes it, so a DMA feed is
+ * never faster; MCRC_u8StartWords uses it to free the CPU instead, returning
+ * at once and calling back from the stream interrupt when the block is in.
+ *
+ * The software CRC is table driven, slicing 8 bytes per step, for any 32-bit
+ * polynomial, reflected or not. It runs anywhere, including host builds.
+ */
+
+/* Parameters of the usual CRCs for MCRC_voidSwInit */
+#define MCRC_SW_CRC32_MPEG2     0x04C11DB7UL, 0xFFFFFFFFUL, 0x00000000UL, FALSE   /* the unit */
+#define MCRC_SW_CRC32           0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, TRUE    /* zlib, Ethernet */
+#define MCRC_SW_CRC32C          0x1EDC6F41UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, TRUE    /* Castagnoli */
+
+/**
+ * @brief Software CRC, tables and parameters (8 KB, keep it static).
+ */
+typedef struct
+{
+    u32 Table[8][256];  /**< Table[k][b]: CRC of byte b followed by k zero bytes */
+    u32 Init;           /**< Register value at the start */
+    u32 XorOut;         /**< Value XORed into the final register */
+    u8  Reflected;      /**< TRUE: bytes LSB first and reflected result */
+} MCRC_SwCrc_t;
+
+typedef enum {
+    MCRC_IDLE = 0,      // nothing started since init
+    MCRC_BUSY,          // a MCRC_u8StartWords block is being fed
+    MCRC_DONE,
+    MCRC_FAILED         // bus error, the unit is back to its value before the start
+} MCRC_Status_e;
+
+/* Function Prototypes */
+
+/**
+ * @brief Enables the clock of the CRC unit and configures its DMA2 stream if MCRC_DMA is enabled.
+ *        If another driver holds the stream, MCRC_u8StartWords refuses the blocks.
+ */
+void MCRC_voidInit(void);
+
+/**
+ * @brief Restarts the unit from 0xFFFFFFFF.
+ */
+void MCRC_voidReset(void);
+
+/**
+ * @brief Feeds words to the unit with the CPU, after the ones fed since the last reset.
+ * @param Copy_pu32Words Word-aligned block.
+ * @param Copy_u32Count Number of words.
+ * @return CRC of everything fed since the last reset.
+ */
+u32 MCRC_u32AccumulateWords(const u32 *Copy_pu32Words, u32 Copy_u32Count);
+
+/**
+ * @brief Starts feeding words to the unit through the DMA2 stream, after the
+ *        ones fed since the last reset, and returns at once. Leave the unit
+ *        and the block alone until the callback.
+ * @param Copy_pu32Words Word-aligned block.
+ * @param Copy_u32Count Number of words.
+ * @param pfHandler Callback run from the stream interrupt once the block is
+ *        in (MCRC_DONE) or the stream failed (MCRC_FAILED, feed the block
+ *        again with MCRC_u32AccumulateWords), NULL to poll MCRC_u8GetStatus.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK if MCRC_DMA is disabled, another driver holds
+ *         the stream, a block is still being fed, or the count is 0.
+ */
+u8 MCRC_u8StartWords(const u32 *Copy_pu32Words, u32 Copy_u32Count, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Gets the state of the last MCRC_u8StartWords block.
+ * @return MCRC_Status_e.
+ */
+u8 MCRC_u8GetStatus(void);
+
+/**
+ * @brief Reads the unit.
+ * @return CRC of everything fed since the last reset.
+ */
+u32 MCRC_u32GetResult(void);
+
+/**
+ * @brief Resets the unit and computes the CRC of a word block.
+ * @param Copy_pu32Words Word-aligned block.
+ * @param Copy_u32Count Number of words.
+ * @return CRC-32/MPEG-2 of the words, each taken most significant byte first.
+ */
+u32 MCRC_u32ComputeWords(const u32 *Copy_pu32Words, u32 Copy_u32Count);
+
+/**
+ * @brief Computes CRC-32/MPEG-2 of a byte stream with the unit.
+ * @param Copy_pu8Data Data, any alignment.
+ * @param Copy_u32Length Number of bytes.
+ * @return The CRC, equal to MCRC_u32SwCompute with MCRC_SW_CRC32_MPEG2.
+ */
+u32 MCRC_u32Compute(const u8 *Copy_pu8Data, u32 Copy_u32Length);
+
+/**
+ * @brief Computes the reflected CRC-32 (zlib, Ethernet) of a byte stream with the unit.
+ * @param Copy_pu8Data Data, any alignment.
+ * @param Copy_u32Length Number of bytes.
+ * @return The CRC, equal to MCRC_u32SwCompute with MCRC_SW_CRC32.
+ */
+u32 MCRC_u32ComputeCrc32(const u8 *Copy_pu8Data, u32 Copy_u32Length);
+
+/**
+ * @brief Builds the tables of a software CRC.
+ * @param Copy_pSw Software CRC object.
+ * @param Copy_u32Poly Polynomial, normal (MSB first) notation.
+ * @param Copy_u32Init Register value at the start.
+ * @param Copy_u32XorOut Value XORed into the final register.
+ * @param Copy_u8Reflected TRUE for LSB-first CRCs.
+ *        The MCRC_SW_ macros give the last four parameters of common CRCs.
+ */
+void MCRC_voidSwInit(MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Poly, u32 Copy_u32Init, u32 Copy_u32XorOut, u8 Copy_u8Reflected);
+
+/**
+ * @brief Continues a software CRC over more bytes.
+ *        Start with Copy_pSw->Init, finish with MCRC_u32SwFinish.
+ * @param Copy_pSw Software CRC object.
+ * @param Copy_u32Crc Register value so far.
+ * @param Copy_pu8Data Data, any alignment.
+ * @param Copy_u32Length Number of bytes.
+ * @return The new register value.
+ */
+u32 MCRC_u32SwUpdate(const MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Crc, const u8 *Copy_pu8Data, u32 Copy_u32Length);
+
+/**
+ * @brief Applies the final XOR to a register value.
+ * @param Copy_pSw Software CRC object.
+ * @param Copy_u32Crc Register value.
+ * @return The CRC.
+ */
+u32 MCRC_u32SwFinish(const MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Crc);
+
+/**
+ * @brief Computes a software CRC in one call.
+ * @param Copy_pSw Software CRC object.
+ * @param Copy_pu8Data Data, any alignment.
+ * @param Copy_u32Length Number of bytes.
+ * @return The CRC.
+ */
+u32 MCRC_u32SwCompute(const MCRC_SwCrc_t *Copy_pSw, const u8 *Copy_pu8Data, u32 Copy_u32Length);
+
+#endif /* MCRC_INTERFACE_H_ */
@@ -0,0 +1,24 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MCRC_PRIVATE_H_
+#define MCRC_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* CRC CR Bit Definitions */
+#define CR_RESET            0   // Reset the data register to 0xFFFFFFFF
+
+/* Largest transfer of a stream, in words */
+#define DMA_MAX_ITEMS       0xFFFFUL
+
+/* The unit only takes words; CRC-32/MPEG-2 parameters it implements */
+#define CRC_POLY            0x04C11DB7UL
+#define CRC_INIT            0xFFFFFFFFUL
+
+#endif /* MCRC_PRIVATE_H_ */
@@ -0,0 +1,489 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* CRC Directives                                   */
+/****************************************************/
+#include "MCRC_interface.h"
+#include "MCRC_config.h"
+#include "MCRC_private.h"
+#include "MCRC_register.h"
+
+/****************************************************/
+/* RCC Directives                                   */
+/****************************************************/
+#include "MRCC_interface.h"
+
+/****************************************************/
+/* DMA Directives                                   */
+/****************************************************/
+#include "MDMA_interface.h"
+
+#if (MCRC_DMA_STREAM < 0) || (MCRC_DMA_STREAM > 7)
+#error "MCRC_DMA_STREAM must be from 0 to 7"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+#if MCRC_DMA == ENABLE
+static u8 Global_u8DmaReady = FALSE;            // TRUE once the stream is ours, another driver may hold it
+static const u32 *Global_pu32Next = NULL;       // First word of the chunk on the stream
+static u32 Global_u32Left = 0;                  // Words of the block not fed yet, the chunk included
+static u32 Global_u32Chunk = 0;                 // Words of the chunk on the stream
+static u32 Global_u32Saved = 0;                 // CRC before the block, restored if it fails
+static CallBackFn_t Global_pfHandler = NULL;
+static void *Global_pvContext = NULL;
+#endif
+static volatile u8 Global_u8Status = MCRC_IDLE;
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Load a word from any address, bytes in memory order (little endian).
+ */
+static inline u32 MCRC_u32LoadWord(const u8 *Copy_pu8Data)
+{
+    return (u32)Copy_pu8Data[0] | ((u32)Copy_pu8Data[1] << 8) | ((u32)Copy_pu8Data[2] << 16) | ((u32)Copy_pu8Data[3] << 24);
+}
+
+/**
+ * @brief Reverse the 32 bits of a word (RBIT on the target).
+ */
+static inline u32 MCRC_u32ReverseBits(u32 Copy_u32Value)
+{
+#if defined(__arm__)
+    __asm__ ("rbit %0, %1" : "=r" (Copy_u32Value) : "r" (Copy_u32Value));
+    return Copy_u32Value;
+#else
+    u32 Local_u32Result = 0;
+    u8 Local_u8Bit;
+
+    for (Local_u8Bit = 0; Local_u8Bit < 32; Local_u8Bit++)
+    {
+        Local_u32Result = (Local_u32Result << 1) | ((Copy_u32Value >> Local_u8Bit) & 1UL);
+    }
+    return Local_u32Result;
+#endif
+}
+
+/**
+ * @brief Continue CRC-32/MPEG-2 bit by bit, for the 1 to 3 bytes left after the words.
+ */
+static u32 MCRC_u32TailMsbFirst(u32 Copy_u32Crc, const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    u8 Local_u8Bit;
+
+    while (Copy_u32Length-- != 0)
+    {
+        Copy_u32Crc ^= (u32)(*Copy_pu8Data++) << 24;
+        for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+        {
+            Copy_u32Crc = ((Copy_u32Crc & 0x80000000UL) != 0) ? ((Copy_u32Crc << 1) ^ CRC_POLY) : (Copy_u32Crc << 1);
+        }
+        Copy_u32Crc &= 0xFFFFFFFFUL;
+    }
+    return Copy_u32Crc;
+}
+
+/**
+ * @brief Continue a reflected CRC bit by bit, for the 1 to 3 bytes left after the words.
+ */
+static u32 MCRC_u32TailLsbFirst(u32 Copy_u32Crc, const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    u32 Local_u32Poly = MCRC_u32ReverseBits(CRC_POLY);
+    u8 Local_u8Bit;
+
+    while (Copy_u32Length-- != 0)
+    {
+        Copy_u32Crc ^= *Copy_pu8Data++;
+        for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+        {
+            Copy_u32Crc = ((Copy_u32Crc & 1UL) != 0) ? ((Copy_u32Crc >> 1) ^ Local_u32Poly) : (Copy_u32Crc >> 1);
+        }
+    }
+    return Copy_u32Crc;
+}
+
+#if MCRC_DMA == ENABLE
+/**
+ * @brief Put the unit back to a CRC value it held before.
+ *
+ * The data register cannot be written directly: one word step is
+ * CRC' = F(CRC ^ word), F being 32 shifts through the polynomial, so after a
+ * reset the word F^-1(value) ^ CRC_INIT lands on the value. F is inverted bit
+ * by bit, the polynomial's x^0 term tells which shifts carried it.
+ */
+static void MCRC_voidRestore(u32 Copy_u32Crc)
+{
+    u8 Local_u8Bit;
+
+    for (Local_u8Bit = 0; Local_u8Bit < 32; Local_u8Bit++)
+    {
+        Copy_u32Crc = ((Copy_u32Crc & 1UL) != 0) ? (((Copy_u32Crc ^ CRC_POLY) >> 1) | 0x80000000UL) : (Copy_u32Crc >> 1);
+    }
+    MCRC_voidReset();
+    CRC->DR = Copy_u32Crc ^ CRC_INIT;
+}
+
+/**
+ * @brief Start the next chunk of the block on the stream.
+ *
+ * Memory to memory: the peripheral port reads the block, the memory port
+ * writes the data register without incrementing.
+ *
+ * @return u8: STD_OK, or STD_NOK if the stream refused it.
+ */
+static u8 MCRC_u8StartChunk(void)
+{
+    Global_u32Chunk = (Global_u32Left > DMA_MAX_ITEMS) ? DMA_MAX_ITEMS : Global_u32Left;
+    return MDMA_u8Start(MDMA_DMA2, MCRC_DMA_STREAM, (u32)Global_pu32Next, (u32)&CRC->DR, 0, (u16)Global_u32Chunk);
+}
+
+/**
+ * @brief End the block and report it.
+ *
+ * A failed block may have fed part of its words: the unit is put back to the
+ * CRC from before it, so feeding it again gives the right result.
+ */
+static void MCRC_voidComplete(u8 Copy_u8Status)
+{
+    if (Copy_u8Status == MCRC_FAILED)
+    {
+        MDMA_voidStop(MDMA_DMA2, MCRC_DMA_STREAM);
+        MCRC_voidRestore(Global_u32Saved);
+    }
+    Global_u8Status = Copy_u8Status;
+    if (Global_pfHandler != NULL)
+    {
+        Global_pfHandler(Global_pvContext);
+    }
+}
+
+/**
+ * @brief Stream transfer complete: next chunk, or the end of the block.
+ */
+static void MCRC_voidOnFull(void *pvContext)
+{
+    (void)pvContext;
+    Global_pu32Next += Global_u32Chunk;
+    Global_u32Left -= Global_u32Chunk;
+    if (Global_u32Left == 0)
+    {
+        MCRC_voidComplete(MCRC_DONE);
+    }
+    else if (MCRC_u8StartChunk() != STD_OK)
+    {
+        MCRC_voidComplete(MCRC_FAILED);
+    }
+}
+
+/**
+ * @brief Stream bus error: the stream is disabled, the block fails.
+ */
+static void MCRC_voidOnError(void *pvContext)
+{
+    (void)pvContext;
+    MCRC_voidComplete(MCRC_FAILED);
+}
+#endif
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Clock the CRC unit, and set up the DMA2 stream when the DMA path is enabled.
+ *
+ * A stream held by another driver leaves MCRC_u8StartWords refusing the blocks.
+ */
+void MCRC_voidInit(void)
+{
+    MRCC_voidEnableVendorPerphiral(AHB1, AHB1_CRCEN);
+    #if MCRC_DMA == ENABLE
+        MDMA_StreamConfig_t Local_DmaConfig = {
+            .Channel = MCRC_DMA_CHANNEL, .Direction = MDMA_MEM_TO_MEM, .Priority = MDMA_PRIORITY_LOW,
+            .PeriphSize = MDMA_SIZE_WORD, .MemSize = MDMA_SIZE_WORD, .PeriphInc = TRUE, .MemInc = FALSE,
+            .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_FULL,
+            .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+            .Interrupts = MDMA_IT_FULL | MDMA_IT_ERROR,
+            .IrqGroup = MCRC_DMA_IRQ_GROUP, .IrqSubGroup = MCRC_DMA_IRQ_SUBGROUP,
+            .Owner = (const void *)CRC
+        };
+        Global_u8DmaReady = (MDMA_u8Init(MDMA_DMA2, MCRC_DMA_STREAM, &Local_DmaConfig) == STD_OK) ? TRUE : FALSE;
+        if (Global_u8DmaReady == TRUE)
+        {
+            MDMA_voidSetCallback(MDMA_DMA2, MCRC_DMA_STREAM, MDMA_EVENT_FULL, MCRC_voidOnFull, NULL);
+            MDMA_voidSetCallback(MDMA_DMA2, MCRC_DMA_STREAM, MDMA_EVENT_ERROR, MCRC_voidOnError, NULL);
+        }
+    #endif
+    Global_u8Status = MCRC_IDLE;
+    MCRC_voidReset();
+}
+
+/**
+ * @brief Restart the unit from 0xFFFFFFFF.
+ */
+void MCRC_voidReset(void)
+{
+    CRC->CR = (1UL << CR_RESET);
+}
+
+/**
+ * @brief Feed words to the unit as they are, with the CPU.
+ *
+ * @param Copy_pu32Words: Word-aligned block.
+ * @param Copy_u32Count: Number of words.
+ * @return u32: CRC of everything fed since the last reset.
+ */
+u32 MCRC_u32AccumulateWords(const u32 *Copy_pu32Words, u32 Copy_u32Count)
+{
+    while (Copy_u32Count-- != 0)
+    {
+        CRC->DR = *Copy_pu32Words++;
+    }
+    return CRC->DR;
+}
+
+/**
+ * @brief Start feeding a word block through the DMA2 stream.
+ *
+ * Blocks over 65535 words go in chunks, each started by the stream
+ * interrupt of the previous one.
+ *
+ * @param Copy_pu32Words: Word-aligned block.
+ * @param Copy_u32Count: Number of words.
+ * @param pfHandler: Callback run from the stream interrupt, NULL for none.
+ * @param pvContext: Context passed to the callback.
+ * @return u8: STD_OK, or STD_NOK if the block cannot be started.
+ */
+u8 MCRC_u8StartWords(const u32 *Copy_pu32Words, u32 Copy_u32Count, CallBackFn_t pfHandler, void *pvContext)
+{
+    #if MCRC_DMA == ENABLE
+        if ((Global_u8DmaReady == FALSE) || (Global_u8Status == MCRC_BUSY) || (Copy_u32Count == 0))
+        {
+            return STD_NOK;
+        }
+        Global_pu32Next = Copy_pu32Words;
+        Global_u32Left = Copy_u32Count;
+        Global_u32Saved = CRC->DR;
+        Global_pfHandler = pfHandler;
+        Global_pvContext = pvContext;
+        Global_u8Status = MCRC_BUSY;
+        if (MCRC_u8StartChunk() != STD_OK)
+        {
+            Global_u8Status = MCRC_IDLE;
+            return STD_NOK;
+        }
+        return STD_OK;
+    #else
+        (void)Copy_pu32Words;
+        (void)Copy_u32Count;
+        (void)pfHandler;
+        (void)pvContext;
+        return STD_NOK;
+    #endif
+}
+
+/**
+ * @brief Get the state of the last block started.
+ */
+u8 MCRC_u8GetStatus(void)
+{
+    return Global_u8Status;
+}
+
+/**
+ * @brief Read the CRC of everything fed since the last reset.
+ */
+u32 MCRC_u32GetResult(void)
+{
+    return CRC->DR;
+}
+
+/**
+ * @brief Reset the unit and compute the CRC of a word block.
+ *
+ * @param Copy_pu32Words: Word-aligned block.
+ * @param Copy_u32Count: Number of words.
+ * @return u32: The CRC.
+ */
+u32 MCRC_u32ComputeWords(const u32 *Copy_pu32Words, u32 Copy_u32Count)
+{
+    MCRC_voidReset();
+    return MCRC_u32AccumulateWords(Copy_pu32Words, Copy_u32Count);
+}
+
+/**
+ * @brief Compute CRC-32/MPEG-2 of a byte stream.
+ *
+ * Each word is byte-swapped so its first byte in memory is fed first, the
+ * 1 to 3 remaining bytes continue from the unit's result in software.
+ *
+ * @param Copy_pu8Data: Data, any alignment.
+ * @param Copy_u32Length: Number of bytes.
+ * @return u32: The CRC.
+ */
+u32 MCRC_u32Compute(const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    u32 Local_u32Words = Copy_u32Length / 4;
+
+    MCRC_voidReset();
+    while (Local_u32Words-- != 0)
+    {
+        CRC->DR = __builtin_bswap32(MCRC_u32LoadWord(Copy_pu8Data));
+        Copy_pu8Data += 4;
+    }
+    return MCRC_u32TailMsbFirst(CRC->DR, Copy_pu8Data, Copy_u32Length & 3UL);
+}
+
+/**
+ * @brief Compute the reflected CRC-32 of a byte stream.
+ *
+ * Feeding bit-reversed words computes the reflected CRC bit-reversed, with
+ * the same polynomial and initial value; the tail then continues LSB first.
+ *
+ * @param Copy_pu8Data: Data, any alignment.
+ * @param Copy_u32Length: Number of bytes.
+ * @return u32: The CRC.
+ */
+u32 MCRC_u32ComputeCrc32(const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    u32 Local_u32Words = Copy_u32Length / 4;
+
+    MCRC_voidReset();
+    while (Local_u32Words-- != 0)
+    {
+        CRC->DR = MCRC_u32ReverseBits(MCRC_u32LoadWord(Copy_pu8Data));
+        Copy_pu8Data += 4;
+    }
+    return MCRC_u32TailLsbFirst(MCRC_u32ReverseBits(CRC->DR), Copy_pu8Data, Copy_u32Length & 3UL) ^ 0xFFFFFFFFUL;
+}
+
+/**
+ * @brief Build the slicing-by-8 tables of a software CRC.
+ *
+ * Table[0] is the classic byte table, Table[k][b] advances Table[k-1][b]
+ * by one more zero byte.
+ */
+void MCRC_voidSwInit(MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Poly, u32 Copy_u32Init, u32 Copy_u32XorOut, u8 Copy_u8Reflected)
+{
+    u32 Local_u32Poly = (Copy_u8Reflected == TRUE) ? MCRC_u32ReverseBits(Copy_u32Poly) : Copy_u32Poly;
+    u32 Local_u32Crc, Local_u32Byte;
+    u8 Local_u8Bit, Local_u8Slice;
+
+    for (Local_u32Byte = 0; Local_u32Byte < 256; Local_u32Byte++)
+    {
+        if (Copy_u8Reflected == TRUE)
+        {
+            Local_u32Crc = Local_u32Byte;
+            for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+            {
+                Local_u32Crc = ((Local_u32Crc & 1UL) != 0) ? ((Local_u32Crc >> 1) ^ Local_u32Poly) : (Local_u32Crc >> 1);
+            }
+        }
+        else
+        {
+            Local_u32Crc = Local_u32Byte << 24;
+            for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+            {
+                Local_u32Crc = ((Local_u32Crc & 0x80000000UL) != 0) ? ((Local_u32Crc << 1) ^ Local_u32Poly) : (Local_u32Crc << 1);
+                Local_u32Crc &= 0xFFFFFFFFUL;
+            }
+        }
+        Copy_pSw->Table[0][Local_u32Byte] = Local_u32Crc;
+    }
+
+    for (Local_u8Slice = 1; Local_u8Slice < 8; Local_u8Slice++)
+    {
+        for (Local_u32Byte = 0; Local_u32Byte < 256; Local_u32Byte++)
+        {
+            Local_u32Crc = Copy_pSw->Table[Local_u8Slice - 1][Local_u32Byte];
+            Copy_pSw->Table[Local_u8Slice][Local_u32Byte] = (Copy_u8Reflected == TRUE)
+                ? ((Local_u32Crc >> 8) ^ Copy_pSw->Table[0][Local_u32Crc & 0xFFUL])
+                : (((Local_u32Crc << 8) & 0xFFFFFFFFUL) ^ Copy_pSw->Table[0][Local_u32Crc >> 24]);
+        }
+    }
+
+    Copy_pSw->Init = Copy_u32Init;
+    Copy_pSw->XorOut = Copy_u32XorOut;
+    Copy_pSw->Reflected = Copy_u8Reflected;
+}
+
+/**
+ * @brief Continue a software CRC, 8 bytes per table step.
+ *
+ * @param Copy_pSw: Software CRC object.
+ * @param Copy_u32Crc: Register value so far.
+ * @param Copy_pu8Data: Data, any alignment.
+ * @param Copy_u32Length: Number of bytes.
+ * @return u32: The new register value.
+ */
+u32 MCRC_u32SwUpdate(const MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Crc, const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    const u32 (*Local_pTable)[256] = Copy_pSw->Table;
+    u32 Local_u32Low, Local_u32High;
+
+    if (Copy_pSw->Reflected == TRUE)
+    {
+        for (; Copy_u32Length >= 8; Copy_u32Length -= 8, Copy_pu8Data += 8)
+        {
+            Local_u32Low = Copy_u32Crc ^ MCRC_u32LoadWord(Copy_pu8Data);
+            Local_u32High = MCRC_u32LoadWord(&Copy_pu8Data[4]);
+            Copy_u32Crc = Local_pTable[7][Local_u32Low & 0xFFUL] ^ Local_pTable[6][(Local_u32Low >> 8) & 0xFFUL]
+                        ^ Local_pTable[5][(Local_u32Low >> 16) & 0xFFUL] ^ Local_pTable[4][Local_u32Low >> 24]
+                        ^ Local_pTable[3][Local_u32High & 0xFFUL] ^ Local_pTable[2][(Local_u32High >> 8) & 0xFFUL]
+                        ^ Local_pTable[1][(Local_u32High >> 16) & 0xFFUL] ^ Local_pTable[0][Local_u32High >> 24];
+        }
+        while (Copy_u32Length-- != 0)
+        {
+            Copy_u32Crc = (Copy_u32Crc >> 8) ^ Local_pTable[0][(Copy_u32Crc ^ *Copy_pu8Data++) & 0xFFUL];
+        }
+    }
+    else
+    {
+        for (; Copy_u32Length >= 8; Copy_u32Length -= 8, Copy_pu8Data += 8)
+        {
+            Local_u32Low = Copy_u32Crc ^ __builtin_bswap32(MCRC_u32LoadWord(Copy_pu8Data));
+            Local_u32High = __builtin_bswap32(MCRC_u32LoadWord(&Copy_pu8Data[4]));
+            Copy_u32Crc = Local_pTable[7][Local_u32Low >> 24] ^ Local_pTable[6][(Local_u32Low >> 16) & 0xFFUL]
+                        ^ Local_pTable[5][(Local_u32Low >> 8) & 0xFFUL] ^ Local_pTable[4][Local_u32Low & 0xFFUL]
+                        ^ Local_pTable[3][Local_u32High >> 24] ^ Local_pTable[2][(Local_u32High >> 16) & 0xFFUL]
+                        ^ Local_pTable[1][(Local_u32High >> 8) & 0xFFUL] ^ Local_pTable[0][Local_u32High & 0xFFUL];
+        }
+        while (Copy_u32Length-- != 0)
+        {
+            Copy_u32Crc = ((Copy_u32Crc << 8) & 0xFFFFFFFFUL) ^ Local_pTable[0][(Copy_u32Crc >> 24) ^ *Copy_pu8Data++];
+        }
+    }
+    return Copy_u32Crc;
+}
+
+/**
+ * @brief Apply the final XOR.
+ */
+u32 MCRC_u32SwFinish(const MCRC_SwCrc_t *Copy_pSw, u32 Copy_u32Crc)
+{
+    return Copy_u32Crc ^ Copy_pSw->XorOut;
+}
+
+/**
+ * @brief Compute a software CRC in one call.
+ */
+u32 MCRC_u32SwCompute(const MCRC_SwCrc_t *Copy_pSw, const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    return MCRC_u32SwFinish(Copy_pSw, MCRC_u32SwUpdate(Copy_pSw, Copy_pSw->Init, Copy_pu8Data, Copy_u32Length));
+}
@@ -0,0 +1,26 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MCRC_REGISTER_H_
+#define MCRC_REGISTER_H_
+
+/* Base address of the CRC calculation unit */
+#define CRC_BASE_ADDRESS    0x40023000
+
+/**
+ * @brief Structure representing the CRC registers.
+ */
+typedef struct
+{
+    u32 DR;         /**< Data Register: write a word to feed it, read the CRC */
+    u32 IDR;        /**< Independent Data Register: free byte of storage */
+    u32 CR;         /**< Control Register */
+} CRC_t;
+
+#define CRC         ((volatile CRC_t*)CRC_BASE_ADDRESS)
+
+#endif /* MCRC_REGISTER_H_ */
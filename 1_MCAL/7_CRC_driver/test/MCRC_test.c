@@ -0,0 +1,379 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MCRC_test.c                      */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the CRC driver, built with the Makefile next to it.
+ *
+ * The driver is compiled in with its registers moved to a host structure and
+ * the DMA driver stubbed. Every register access goes through Host_pCrc,
+ * which models the unit: a reset loads 0xFFFFFFFF, and a word written to
+ * the data register is folded into the CRC before the next access. A word
+ * equal to the CRC it is written over cannot be told from a read and is
+ * missed; random data hits that once in 2^32 words. What runs on the host:
+ * - the slicing-by-8 software CRC against a bit by bit reference, for the
+ *   MPEG-2, zlib and Castagnoli parameters, any length and alignment;
+ * - MCRC_u32Compute, MCRC_u32ComputeCrc32 and MCRC_u32ComputeWords on the
+ *   model, against the same reference, any length and alignment;
+ * - the restore word written after a failed block, which must bring a reset
+ *   unit back to the CRC it held before the block;
+ * - MCRC_u8StartWords: the chunks, the callback, a failed chunk and a chunk
+ *   the stream refuses, with the stub stream feeding the model;
+ * - the throughput of the software CRC against the bitwise one.
+ * Nothing here times the unit itself; on the target, time the hardware paths
+ * with MDWT_u32GetCycles. */
+
+#include "STD_TYPES.h"
+#include "MCRC_register.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* The unit on the host */
+static CRC_t Host_Crc;
+static u32 Host_u32Crc = 0xFFFFFFFFUL;      // CRC the model holds, presented in DR
+static volatile CRC_t *Host_pCrc(void);
+#undef CRC
+#define CRC     (Host_pCrc())
+
+#include "MCRC_program.c"
+
+/****************************************************/
+/* REFERENCE                                        */
+/****************************************************/
+
+/* One word fed to the unit: 32 shifts MSB first */
+static u32 Ref_u32Word(u32 Copy_u32Crc, u32 Copy_u32Word)
+{
+    u8 Local_u8Bit;
+
+    Copy_u32Crc ^= Copy_u32Word;
+    for (Local_u8Bit = 0; Local_u8Bit < 32; Local_u8Bit++)
+    {
+        Copy_u32Crc = ((Copy_u32Crc & 0x80000000UL) != 0) ? (((Copy_u32Crc << 1) ^ CRC_POLY) & 0xFFFFFFFFUL) : ((Copy_u32Crc << 1) & 0xFFFFFFFFUL);
+    }
+    return Copy_u32Crc;
+}
+
+/* Any CRC bit by bit */
+static u32 Ref_u32Crc(u32 Copy_u32Poly, u32 Copy_u32Init, u32 Copy_u32XorOut, u8 Copy_u8Reflected,
+                      const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    u32 Local_u32Crc = Copy_u32Init;
+    u32 Local_u32Poly = (Copy_u8Reflected == TRUE) ? MCRC_u32ReverseBits(Copy_u32Poly) : Copy_u32Poly;
+    u8 Local_u8Bit;
+
+    while (Copy_u32Length-- != 0)
+    {
+        if (Copy_u8Reflected == TRUE)
+        {
+            Local_u32Crc ^= *Copy_pu8Data++;
+            for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+            {
+                Local_u32Crc = ((Local_u32Crc & 1UL) != 0) ? ((Local_u32Crc >> 1) ^ Local_u32Poly) : (Local_u32Crc >> 1);
+            }
+        }
+        else
+        {
+            Local_u32Crc ^= (u32)(*Copy_pu8Data++) << 24;
+            for (Local_u8Bit = 0; Local_u8Bit < 8; Local_u8Bit++)
+            {
+                Local_u32Crc = ((Local_u32Crc & 0x80000000UL) != 0) ? ((Local_u32Crc << 1) ^ Local_u32Poly) : (Local_u32Crc << 1);
+                Local_u32Crc &= 0xFFFFFFFFUL;
+            }
+        }
+    }
+    return Local_u32Crc ^ Copy_u32XorOut;
+}
+
+/****************************************************/
+/* MODEL AND STUBS                                  */
+/****************************************************/
+
+/* Applies the access made since the last call, then presents the CRC */
+static volatile CRC_t *Host_pCrc(void)
+{
+    if ((Host_Crc.CR & (1UL << CR_RESET)) != 0)
+    {
+        Host_Crc.CR = 0;
+        Host_u32Crc = CRC_INIT;
+    }
+    else if (Host_Crc.DR != Host_u32Crc)
+    {
+        Host_u32Crc = Ref_u32Word(Host_u32Crc, Host_Crc.DR);
+    }
+    Host_Crc.DR = Host_u32Crc;
+    return &Host_Crc;
+}
+
+static u8  Stub_u8StartResult = STD_OK;     // returned by MDMA_u8Start
+static u32 Stub_u32Chunks = 0;              // chunks started
+static const u32 *Stub_pu32Source = NULL;   // source of the last chunk
+static u16 Stub_u16Count = 0;               // words of the last chunk
+static CallBackFn_t Stub_pfEvents[MDMA_EVENTS];
+
+void MRCC_voidEnableVendorPerphiral(EN_AMBABus_t Copy_enuBus, EN_PeriphralID_t Copy_enuPerphiralID)
+{
+    (void)Copy_enuBus;
+    (void)Copy_enuPerphiralID;
+}
+
+u8 MDMA_u8Init(u8 Copy_u8Controller, u8 Copy_u8Stream, const MDMA_StreamConfig_t *Copy_pConfig)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)Copy_pConfig;
+    return STD_OK;
+}
+
+void MDMA_voidSetCallback(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Event,
+                          CallBackFn_t pfHandler, void *pvContext)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)pvContext;
+    Stub_pfEvents[Copy_u8Event] = pfHandler;
+}
+
+u8 MDMA_u8Start(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32PeriphAddr,
+                u32 Copy_u32Mem0Addr, u32 Copy_u32Mem1Addr, u16 Copy_u16Count)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+    (void)Copy_u32Mem0Addr;
+    (void)Copy_u32Mem1Addr;
+    if (Stub_u8StartResult == STD_OK)
+    {
+        Stub_pu32Source = (const u32 *)Copy_u32PeriphAddr;
+        Stub_u16Count = Copy_u16Count;
+        Stub_u32Chunks++;
+    }
+    return Stub_u8StartResult;
+}
+
+void MDMA_voidStop(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    (void)Copy_u8Controller;
+    (void)Copy_u8Stream;
+}
+
+/* The stream writes the first Copy_u32Words words of the last chunk, then raises Copy_u8Event */
+static void Stub_voidTransfer(u32 Copy_u32Words, u8 Copy_u8Event)
+{
+    u32 Local_u32Idx;
+
+    for (Local_u32Idx = 0; Local_u32Idx < Copy_u32Words; Local_u32Idx++)
+    {
+        Host_pCrc()->DR = Stub_pu32Source[Local_u32Idx];
+    }
+    Stub_pfEvents[Copy_u8Event](NULL);
+}
+
+static u32 Global_u32Callbacks = 0;
+
+static void Test_voidOnBlock(void *pvContext)
+{
+    Global_u32Callbacks += (pvContext == &Global_u32Callbacks) ? 1 : 1000;
+}
+
+/****************************************************/
+/* TESTS                                            */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static MCRC_SwCrc_t Global_Sw;
+static u8 Global_u8Data[65536 + 8];
+
+static void Test_voidSoftware(void)
+{
+    static const struct { u32 Poly, Init, XorOut; u8 Reflected; u32 Check; const char *Name; } Local_Params[] = {
+        { MCRC_SW_CRC32_MPEG2, 0x0376E6E7UL, "CRC-32/MPEG-2" },
+        { MCRC_SW_CRC32,       0xCBF43926UL, "CRC-32" },
+        { MCRC_SW_CRC32C,      0xE3069283UL, "CRC-32C" },
+    };
+    u32 Local_u32Param, Local_u32Iter, Local_u32Offset, Local_u32Length;
+
+    for (Local_u32Param = 0; Local_u32Param < (sizeof(Local_Params) / sizeof(Local_Params[0])); Local_u32Param++)
+    {
+        MCRC_voidSwInit(&Global_Sw, Local_Params[Local_u32Param].Poly, Local_Params[Local_u32Param].Init,
+                        Local_Params[Local_u32Param].XorOut, Local_Params[Local_u32Param].Reflected);
+        CHECK(MCRC_u32SwCompute(&Global_Sw, (const u8 *)"123456789", 9) == Local_Params[Local_u32Param].Check,
+              "%s check value", Local_Params[Local_u32Param].Name);
+
+        for (Local_u32Iter = 0; Local_u32Iter < 2000; Local_u32Iter++)
+        {
+            Local_u32Offset = (u32)rand() % 8;
+            Local_u32Length = (Local_u32Iter < 64) ? Local_u32Iter : ((u32)rand() % 4096);
+            CHECK(MCRC_u32SwCompute(&Global_Sw, &Global_u8Data[Local_u32Offset], Local_u32Length)
+                  == Ref_u32Crc(Local_Params[Local_u32Param].Poly, Local_Params[Local_u32Param].Init,
+                                Local_Params[Local_u32Param].XorOut, Local_Params[Local_u32Param].Reflected,
+                                &Global_u8Data[Local_u32Offset], Local_u32Length),
+                  "%s, %lu bytes at offset %lu", Local_Params[Local_u32Param].Name,
+                  (unsigned long)Local_u32Length, (unsigned long)Local_u32Offset);
+        }
+    }
+}
+
+static void Test_voidHardware(void)
+{
+    u32 Local_u32Iter, Local_u32Offset, Local_u32Length, Local_u32Idx, Local_u32Crc;
+    const u32 *Local_pu32Words;
+
+    MCRC_voidInit();
+    CHECK(MCRC_u32GetResult() == CRC_INIT, "init left 0x%08lX", (unsigned long)MCRC_u32GetResult());
+    CHECK(MCRC_u32Compute((const u8 *)"123456789", 9) == 0x0376E6E7UL, "CRC-32/MPEG-2 check value");
+    CHECK(MCRC_u32ComputeCrc32((const u8 *)"123456789", 9) == 0xCBF43926UL, "CRC-32 check value");
+
+    for (Local_u32Iter = 0; Local_u32Iter < 2000; Local_u32Iter++)
+    {
+        Local_u32Offset = (u32)rand() % 8;
+        Local_u32Length = (Local_u32Iter < 64) ? Local_u32Iter : ((u32)rand() % 4096);
+        CHECK(MCRC_u32Compute(&Global_u8Data[Local_u32Offset], Local_u32Length)
+              == Ref_u32Crc(MCRC_SW_CRC32_MPEG2, &Global_u8Data[Local_u32Offset], Local_u32Length),
+              "Compute, %lu bytes at offset %lu", (unsigned long)Local_u32Length, (unsigned long)Local_u32Offset);
+        CHECK(MCRC_u32ComputeCrc32(&Global_u8Data[Local_u32Offset], Local_u32Length)
+              == Ref_u32Crc(MCRC_SW_CRC32, &Global_u8Data[Local_u32Offset], Local_u32Length),
+              "ComputeCrc32, %lu bytes at offset %lu", (unsigned long)Local_u32Length, (unsigned long)Local_u32Offset);
+
+        /* Words count as their bytes most significant first */
+        Local_pu32Words = (const u32 *)(const void *)&Global_u8Data[8];
+        Local_u32Crc = CRC_INIT;
+        for (Local_u32Idx = 0; Local_u32Idx < (Local_u32Length / 4); Local_u32Idx++)
+        {
+            Local_u32Crc = Ref_u32Word(Local_u32Crc, Local_pu32Words[Local_u32Idx]);
+        }
+        CHECK(MCRC_u32ComputeWords(Local_pu32Words, Local_u32Length / 4) == Local_u32Crc,
+              "ComputeWords, %lu words", (unsigned long)(Local_u32Length / 4));
+    }
+}
+
+static void Test_voidRestore(void)
+{
+    static const u32 Local_u32Edge[] = { 0x00000000UL, 0xFFFFFFFFUL, 0x80000000UL, 0x00000001UL, 0x04C11DB7UL };
+    u32 Local_u32Iter, Local_u32Crc;
+
+    for (Local_u32Iter = 0; Local_u32Iter < 100000; Local_u32Iter++)
+    {
+        Local_u32Crc = (Local_u32Iter < 5) ? Local_u32Edge[Local_u32Iter]
+                                           : ((((u32)rand() & 0xFFFFUL) << 16) ^ ((u32)rand() & 0xFFFFUL));
+        MCRC_voidRestore(Local_u32Crc);
+        /* The word itself, read before the model folds it: restoring 0 writes 0xFFFFFFFF over 0xFFFFFFFF */
+        CHECK(Ref_u32Word(CRC_INIT, Host_Crc.DR) == Local_u32Crc, "restore 0x%08lX", (unsigned long)Local_u32Crc);
+    }
+}
+
+static void Test_voidDmaBlocks(void)
+{
+    static u32 Local_u32Words[(2 * DMA_MAX_ITEMS) + 10];
+    u32 Local_u32Idx, Local_u32Crc, Local_u32Before;
+
+    for (Local_u32Idx = 0; Local_u32Idx < ((2 * DMA_MAX_ITEMS) + 10); Local_u32Idx++)
+    {
+        Local_u32Words[Local_u32Idx] = (((u32)rand() & 0xFFFFUL) << 16) ^ ((u32)rand() & 0xFFFFUL);
+    }
+    MCRC_voidInit();
+    CHECK((Stub_pfEvents[MDMA_EVENT_FULL] != NULL) && (Stub_pfEvents[MDMA_EVENT_ERROR] != NULL), "stream callbacks not set");
+    CHECK(MCRC_u8GetStatus() == MCRC_IDLE, "status after init");
+    CHECK(MCRC_u8StartWords(Local_u32Words, 0, NULL, NULL) == STD_NOK, "empty block started");
+
+    /* Three chunks after some words fed by the CPU, the last one short */
+    Local_u32Crc = MCRC_u32AccumulateWords(Local_u32Words, 3);
+    for (Local_u32Idx = 0; Local_u32Idx < ((2 * DMA_MAX_ITEMS) + 10); Local_u32Idx++)
+    {
+        Local_u32Crc = Ref_u32Word(Local_u32Crc, Local_u32Words[Local_u32Idx]);
+    }
+    Stub_u32Chunks = 0;
+    Global_u32Callbacks = 0;
+    CHECK(MCRC_u8StartWords(Local_u32Words, (2 * DMA_MAX_ITEMS) + 10, Test_voidOnBlock, &Global_u32Callbacks) == STD_OK, "block refused");
+    CHECK((MCRC_u8GetStatus() == MCRC_BUSY) && (Stub_pu32Source == Local_u32Words) && (Stub_u16Count == DMA_MAX_ITEMS),
+          "first chunk: status %u, %u words", MCRC_u8GetStatus(), Stub_u16Count);
+    CHECK(MCRC_u8StartWords(Local_u32Words, 1, NULL, NULL) == STD_NOK, "second block started while busy");
+    Stub_voidTransfer(Stub_u16Count, MDMA_EVENT_FULL);
+    Stub_voidTransfer(Stub_u16Count, MDMA_EVENT_FULL);
+    CHECK((Stub_u32Chunks == 3) && (Stub_pu32Source == &Local_u32Words[2 * DMA_MAX_ITEMS]) && (Stub_u16Count == 10),
+          "last chunk: %lu chunks, %u words", (unsigned long)Stub_u32Chunks, Stub_u16Count);
+    CHECK((MCRC_u8GetStatus() == MCRC_BUSY) && (Global_u32Callbacks == 0), "block ended early");
+    Stub_voidTransfer(Stub_u16Count, MDMA_EVENT_FULL);
+    CHECK((MCRC_u8GetStatus() == MCRC_DONE) && (Global_u32Callbacks == 1), "end: status %u, %lu callbacks",
+          MCRC_u8GetStatus(), (unsigned long)Global_u32Callbacks);
+    CHECK(MCRC_u32GetResult() == Local_u32Crc, "block CRC 0x%08lX, expected 0x%08lX",
+          (unsigned long)MCRC_u32GetResult(), (unsigned long)Local_u32Crc);
+
+    /* Bus error half way through the second chunk: the unit goes back to before the block */
+    Local_u32Before = MCRC_u32GetResult();
+    CHECK(MCRC_u8StartWords(Local_u32Words, (2 * DMA_MAX_ITEMS) + 10, Test_voidOnBlock, &Global_u32Callbacks) == STD_OK, "block refused");
+    Stub_voidTransfer(Stub_u16Count, MDMA_EVENT_FULL);
+    Stub_voidTransfer(Stub_u16Count / 2, MDMA_EVENT_ERROR);
+    CHECK((MCRC_u8GetStatus() == MCRC_FAILED) && (Global_u32Callbacks == 2), "bus error: status %u", MCRC_u8GetStatus());
+    CHECK(MCRC_u32GetResult() == Local_u32Before, "bus error: unit not restored");
+
+    /* The stream refuses the second chunk */
+    CHECK(MCRC_u8StartWords(Local_u32Words, (2 * DMA_MAX_ITEMS) + 10, NULL, NULL) == STD_OK, "block refused");
+    Stub_u8StartResult = STD_NOK;
+    Stub_voidTransfer(Stub_u16Count, MDMA_EVENT_FULL);
+    CHECK((MCRC_u8GetStatus() == MCRC_FAILED) && (MCRC_u32GetResult() == Local_u32Before), "refused chunk: status %u",
+          MCRC_u8GetStatus());
+
+    /* The stream refuses the first chunk: nothing started, the unit untouched */
+    CHECK((MCRC_u8StartWords(Local_u32Words, 10, NULL, NULL) == STD_NOK) && (MCRC_u8GetStatus() != MCRC_BUSY)
+          && (MCRC_u32GetResult() == Local_u32Before), "refused block");
+    Stub_u8StartResult = STD_OK;
+}
+
+static f64 Bench_f64Seconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return (f64)Local_Time.tv_sec + ((f64)Local_Time.tv_nsec * 1e-9);
+}
+
+static void Bench_voidThroughput(void)
+{
+    volatile u32 Local_u32Sink = 0;
+    u32 Local_u32Rounds;
+    f64 Local_f64Start, Local_f64Sliced, Local_f64Bitwise;
+
+    MCRC_voidSwInit(&Global_Sw, MCRC_SW_CRC32_MPEG2);
+
+    Local_f64Start = Bench_f64Seconds();
+    for (Local_u32Rounds = 0; Local_u32Rounds < 2000; Local_u32Rounds++)
+    {
+        Local_u32Sink ^= MCRC_u32SwCompute(&Global_Sw, Global_u8Data, 65536);
+    }
+    Local_f64Sliced = Bench_f64Seconds() - Local_f64Start;
+
+    Local_f64Start = Bench_f64Seconds();
+    for (Local_u32Rounds = 0; Local_u32Rounds < 50; Local_u32Rounds++)
+    {
+        Local_u32Sink ^= Ref_u32Crc(MCRC_SW_CRC32_MPEG2, Global_u8Data, 65536);
+    }
+    Local_f64Bitwise = Bench_f64Seconds() - Local_f64Start;
+
+    printf("software CRC-32/MPEG-2: slicing-by-8 %.0f MB/s, bitwise %.0f MB/s\n",
+           (2000.0 * 65536.0) / Local_f64Sliced / 1e6, (50.0 * 65536.0) / Local_f64Bitwise / 1e6);
+}
+
+int main(void)
+{
+    u32 Local_u32Idx;
+
+    for (Local_u32Idx = 0; Local_u32Idx < sizeof(Global_u8Data); Local_u32Idx++)
+    {
+        Global_u8Data[Local_u32Idx] = (u8)rand();
+    }
+
+    Test_voidSoftware();
+    Test_voidHardware();
+    Test_voidRestore();
+    Test_voidDmaBlocks();
+    Bench_voidThroughput();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
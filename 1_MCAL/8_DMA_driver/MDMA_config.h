@@ -0,0 +1,30 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDMA_config.h                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDMA_CONFIG_H_
+#define MDMA_CONFIG_H_
+
+/* Stream interrupt handlers defined by the driver, per controller.
+ * Disable a controller whose handlers are written elsewhere.
+ * Options: ENABLE or DISABLE */
+#define MDMA_DMA1_HANDLERS      ENABLE
+#define MDMA_DMA2_HANDLERS      ENABLE
+
+/* Default streams of the drivers (set in their own config files).
+ * The F401 has more requests than streams, the pairs left sharing a
+ * stream cannot run together: the second init gets STD_NOK.
+ *          DMA1                        DMA2
+ *  S0      I2C1 RX, SPI3 RX            ADC1
+ *  S1      I2C3 RX                     USART6 RX, memory copies (SMEMDMA)
+ *  S2      I2C2 RX                     SPI1 RX
+ *  S3      SPI2 RX                     SPI1 TX, SPI4 RX
+ *  S4      SPI2 TX                     SPI4 TX
+ *  S5      USART2 RX                   USART1 RX
+ *  S6      USART2 TX                   USART6 TX, CRC feed (MCRC)
+ *  S7      SPI3 TX                     USART1 TX */
+
+#endif /* MDMA_CONFIG_H_ */
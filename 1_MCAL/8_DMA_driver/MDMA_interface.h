@@ -0,0 +1,219 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDMA_interface.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDMA_INTERFACE_H_
+#define MDMA_INTERFACE_H_
+
+/*
+ * Each controller has 8 streams; a stream serves one of 8 request channels
+ * (see the request mapping tables of the reference manual). Only DMA2 copies
+ * memory to memory. Counts are in items of the peripheral data size.
+ *
+ * A stream belongs to the driver that first initializes it (Owner of the
+ * configuration) until that driver releases it: an init by another owner is
+ * refused instead of silently taking over the stream and its callbacks.
+ *
+ * Circular mode restarts the same buffer forever; double-buffer mode
+ * alternates between memory 0 and memory 1, the idle one may be refilled or
+ * moved with MDMA_voidSetIdleBuffer while the other is transferred.
+ */
+
+typedef enum {
+    MDMA_DMA1 = 0,
+    MDMA_DMA2
+} MDMA_Controller_e;
+
+typedef enum {
+    MDMA_PERIPH_TO_MEM = 0,
+    MDMA_MEM_TO_PERIPH,
+    MDMA_MEM_TO_MEM         // DMA2 only, normal mode only
+} MDMA_Direction_e;
+
+typedef enum {
+    MDMA_PRIORITY_LOW = 0,
+    MDMA_PRIORITY_MEDIUM,
+    MDMA_PRIORITY_HIGH,
+    MDMA_PRIORITY_VERY_HIGH
+} MDMA_Priority_e;
+
+typedef enum {
+    MDMA_SIZE_BYTE = 0,
+    MDMA_SIZE_HALFWORD,
+    MDMA_SIZE_WORD
+} MDMA_Size_e;
+
+typedef enum {
+    MDMA_MODE_NORMAL = 0,
+    MDMA_MODE_CIRCULAR,
+    MDMA_MODE_DOUBLE_BUFFER
+} MDMA_Mode_e;
+
+typedef enum {
+    MDMA_FIFO_QUARTER = 0,  // FIFO enabled, threshold 1/4
+    MDMA_FIFO_HALF,
+    MDMA_FIFO_THREE_QUARTERS,
+    MDMA_FIFO_FULL,
+    MDMA_FIFO_DIRECT        // no FIFO, not allowed memory to memory
+} MDMA_Fifo_e;
+
+typedef enum {
+    MDMA_BURST_SINGLE = 0,  // bursts need the FIFO
+    MDMA_BURST_INCR4,
+    MDMA_BURST_INCR8,
+    MDMA_BURST_INCR16
+} MDMA_Burst_e;
+
+typedef enum {
+    MDMA_EVENT_HALF = 0,    // first half of the buffer done
+    MDMA_EVENT_FULL,        // buffer done
+    MDMA_EVENT_ERROR,       // bus or direct mode error, the stream is disabled
+    MDMA_EVENTS
+} MDMA_Event_e;
+
+/* Interrupts of MDMA_StreamConfig_t.Interrupts */
+#define MDMA_IT_HALF        (1U << MDMA_EVENT_HALF)
+#define MDMA_IT_FULL        (1U << MDMA_EVENT_FULL)
+#define MDMA_IT_ERROR       (1U << MDMA_EVENT_ERROR)
+
+typedef enum {
+    MDMA_BUSY = 0,
+    MDMA_DONE,
+    MDMA_FAILED
+} MDMA_Status_e;
+
+/**
+ * @brief Stream configuration, kept by the driver for the restarts.
+ */
+typedef struct
+{
+    u8 Channel;         /**< Request channel, 0 to 7 */
+    u8 Direction;       /**< MDMA_Direction_e */
+    u8 Priority;        /**< MDMA_Priority_e */
+    u8 PeriphSize;      /**< MDMA_Size_e */
+    u8 MemSize;         /**< MDMA_Size_e */
+    u8 PeriphInc;       /**< TRUE to increment the peripheral (source) address */
+    u8 MemInc;          /**< TRUE to increment the memory address */
+    u8 Mode;            /**< MDMA_Mode_e */
+    u8 Fifo;            /**< MDMA_Fifo_e */
+    u8 PeriphBurst;     /**< MDMA_Burst_e */
+    u8 MemBurst;        /**< MDMA_Burst_e */
+    u8 Interrupts;      /**< MDMA_IT_ mask, 0 to poll with MDMA_u8GetStatus */
+    u8 IrqGroup;        /**< NVIC group priority of the stream interrupt */
+    u8 IrqSubGroup;     /**< NVIC subgroup priority of the stream interrupt */
+    const void *Owner;  /**< Identifies the user of the stream, e.g. its driver state */
+} MDMA_StreamConfig_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Clocks the controller, stops the stream and applies a configuration.
+ *        Enables the stream interrupt in the NVIC when interrupts are requested.
+ *        The stream then belongs to Copy_pConfig->Owner, which may init it
+ *        again with another configuration.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_pConfig Configuration.
+ * @return STD_OK, or STD_NOK for an invalid stream or combination, or a
+ *         stream owned by another user (left untouched).
+ */
+u8 MDMA_u8Init(u8 Copy_u8Controller, u8 Copy_u8Stream, const MDMA_StreamConfig_t *Copy_pConfig);
+
+/**
+ * @brief Stops a stream, disables its interrupt and drops its callbacks and
+ *        owner, so another user may init it.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ */
+void MDMA_voidRelease(u8 Copy_u8Controller, u8 Copy_u8Stream);
+
+/**
+ * @brief Sets the callback of a stream event. Set it before starting the stream.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_u8Event MDMA_Event_e.
+ * @param pfHandler Callback, NULL for none.
+ * @param pvContext Context passed to the callback.
+ */
+void MDMA_voidSetCallback(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Event,
+                          CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Programs all the addresses and starts a transfer.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_u32PeriphAddr Peripheral register (the source in memory-to-memory).
+ * @param Copy_u32Mem0Addr Memory 0 (the destination in memory-to-memory).
+ * @param Copy_u32Mem1Addr Memory 1, double-buffer mode only.
+ * @param Copy_u16Count Items per buffer, 1 to 65535.
+ * @return STD_OK, or STD_NOK if the stream is not initialized or the count is 0.
+ */
+u8 MDMA_u8Start(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32PeriphAddr,
+                u32 Copy_u32Mem0Addr, u32 Copy_u32Mem1Addr, u16 Copy_u16Count);
+
+/**
+ * @brief Starts the next transfer of a stopped stream with the same peripheral
+ *        and configuration: four register writes (flags, memory, count, enable).
+ *        Ignored for a stream that is not initialized, or a count of 0.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_u32Mem0Addr Memory 0.
+ * @param Copy_u16Count Items, 1 to 65535.
+ */
+void MDMA_voidRestart(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32Mem0Addr, u16 Copy_u16Count);
+
+/**
+ * @brief Changes the item size (both ports) and the memory increment of a
+ *        stream, applied by the next start or restart. Lets one stream serve
+ *        8 and 16-bit transfers, or send a constant, without a full init.
+ *        Ignored for a stream that is not initialized.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_u8Size MDMA_Size_e.
+ * @param Copy_u8MemInc TRUE to increment the memory address.
+ */
+void MDMA_voidSetItemFormat(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Size, u8 Copy_u8MemInc);
+
+/**
+ * @brief Points the memory the double-buffered stream is not using to a new buffer.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @param Copy_u32Addr New buffer.
+ */
+void MDMA_voidSetIdleBuffer(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32Addr);
+
+/**
+ * @brief Gets the memory a double-buffered stream is transferring.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @return 0 for memory 0, 1 for memory 1 (the other one is complete).
+ */
+u8 MDMA_u8GetCurrentBuffer(u8 Copy_u8Controller, u8 Copy_u8Stream);
+
+/**
+ * @brief Stops a stream and waits until it is disabled. Pending flags are cleared.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ */
+void MDMA_voidStop(u8 Copy_u8Controller, u8 Copy_u8Stream);
+
+/**
+ * @brief Gets the items left in the current buffer.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @return Items left.
+ */
+u16 MDMA_u16GetRemaining(u8 Copy_u8Controller, u8 Copy_u8Stream);
+
+/**
+ * @brief Polls a transfer started without interrupts, clearing its flags once finished.
+ * @param Copy_u8Controller MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream Stream, 0 to 7.
+ * @return MDMA_BUSY, MDMA_DONE or MDMA_FAILED.
+ */
+u8 MDMA_u8GetStatus(u8 Copy_u8Controller, u8 Copy_u8Stream);
+
+#endif /* MDMA_INTERFACE_H_ */
@@ -0,0 +1,57 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDMA_private.h                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDMA_PRIVATE_H_
+#define MDMA_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+#define DMA_CONTROLLERS     2
+#define DMA_STREAMS         8
+
+/* Stream CR Bit Definitions */
+#define CR_EN               0   // Stream enable
+#define CR_DMEIE            1   // Direct mode error interrupt enable
+#define CR_TEIE             2   // Transfer error interrupt enable
+#define CR_HTIE             3   // Half transfer interrupt enable
+#define CR_TCIE             4   // Transfer complete interrupt enable
+#define CR_DIR              6   // Data transfer direction, 2 bits
+#define CR_CIRC             8   // Circular mode
+#define CR_PINC             9   // Peripheral increment mode
+#define CR_MINC             10  // Memory increment mode
+#define CR_PSIZE            11  // Peripheral data size, 2 bits
+#define CR_MSIZE            13  // Memory data size, 2 bits
+#define CR_PL               16  // Priority level, 2 bits
+#define CR_DBM              18  // Double-buffer mode
+#define CR_CT               19  // Current target (0: M0AR, 1: M1AR)
+#define CR_PBURST           21  // Peripheral burst, 2 bits
+#define CR_MBURST           23  // Memory burst, 2 bits
+#define CR_CHSEL            25  // Channel selection, 3 bits
+
+#define CR_SIZE_MASK        0b11UL  // Mask of the 2-bit size fields
+
+/* Stream FCR Bit Definitions */
+#define FCR_FTH             0   // FIFO threshold, 2 bits
+#define FCR_DMDIS           2   // Direct mode disable
+
+/* Flags of a stream, relative to its group in LISR/HISR */
+#define FLAG_FEIF           0   // FIFO error
+#define FLAG_DMEIF          2   // Direct mode error
+#define FLAG_TEIF           3   // Transfer error
+#define FLAG_HTIF           4   // Half transfer
+#define FLAG_TCIF           5   // Transfer complete
+#define FLAGS_ALL           0x3DUL
+
+/* Offset of the flag group of a stream (0-7) in its LISR/HISR word */
+#define DMA_FLAGS_OFFSET(STREAM)    ((((STREAM) & 2U) != 0 ? 16U : 0U) + (((STREAM) & 1U) != 0 ? 6U : 0U))
+
+/* Interrupt numbers of the streams */
+#define DMA_IRQ_NUMBERS     { { 11, 12, 13, 14, 15, 16, 17, 47 }, \
+                              { 56, 57, 58, 59, 60, 68, 69, 70 } }
+
+#endif /* MDMA_PRIVATE_H_ */
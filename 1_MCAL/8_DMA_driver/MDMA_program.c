@@ -0,0 +1,453 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDMA_program.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* DMA Directives                                   */
+/****************************************************/
+#include "MDMA_interface.h"
+#include "MDMA_config.h"
+#include "MDMA_private.h"
+#include "MDMA_register.h"
+
+/****************************************************/
+/* RCC Directives                                   */
+/****************************************************/
+#include "MRCC_interface.h"
+
+/****************************************************/
+/* NVIC Directives                                  */
+/****************************************************/
+#include "NVIC_interface.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static volatile DMA_t *const Global_pDMA[DMA_CONTROLLERS] = {DMA1, DMA2};
+static const u8 Global_u8IrqNumbers[DMA_CONTROLLERS][DMA_STREAMS] = DMA_IRQ_NUMBERS;
+
+/* CR of each stream as configured, enable bit clear: the restarts write it back in one go */
+static u32 Global_u32StreamCR[DMA_CONTROLLERS][DMA_STREAMS];
+static u16 Global_u16Initialized = 0;   // Bit (controller * 8 + stream) set once configured
+static const void *Global_pvOwners[DMA_CONTROLLERS][DMA_STREAMS];   // Owner of each configured stream
+
+static ST_CallBack_t Global_StreamCallbacks[DMA_CONTROLLERS][DMA_STREAMS][MDMA_EVENTS];
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+static inline volatile DMA_Stream_t *MDMA_pGetStream(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    return &Global_pDMA[Copy_u8Controller]->S[Copy_u8Stream];
+}
+
+/**
+ * @brief Read the flags of a stream, shifted down to bit 0.
+ */
+static inline u32 MDMA_u32GetFlags(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    volatile DMA_t *Local_pDMA = Global_pDMA[Copy_u8Controller];
+    u32 Local_u32Status = (Copy_u8Stream < 4) ? Local_pDMA->LISR : Local_pDMA->HISR;
+
+    return (Local_u32Status >> DMA_FLAGS_OFFSET(Copy_u8Stream)) & FLAGS_ALL;
+}
+
+/**
+ * @brief Clear flags of a stream, given relative to bit 0.
+ */
+static inline void MDMA_voidClearFlags(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32Flags)
+{
+    volatile DMA_t *Local_pDMA = Global_pDMA[Copy_u8Controller];
+
+    if (Copy_u8Stream < 4)
+    {
+        Local_pDMA->LIFCR = Copy_u32Flags << DMA_FLAGS_OFFSET(Copy_u8Stream);
+    }
+    else
+    {
+        Local_pDMA->HIFCR = Copy_u32Flags << DMA_FLAGS_OFFSET(Copy_u8Stream);
+    }
+}
+
+static inline u8 MDMA_u8IsValid(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    return ((Copy_u8Controller < DMA_CONTROLLERS) && (Copy_u8Stream < DMA_STREAMS)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Check that a stream exists and has been initialized by an owner.
+ */
+static inline u8 MDMA_u8IsClaimed(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    return ((MDMA_u8IsValid(Copy_u8Controller, Copy_u8Stream) == TRUE)
+            && (GET_BIT(Global_u16Initialized, ((Copy_u8Controller * DMA_STREAMS) + Copy_u8Stream)) != 0)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Disable a stream and wait until the current beat is over.
+ */
+static void MDMA_voidDisable(volatile DMA_Stream_t *Copy_pStream)
+{
+    CLR_BIT(Copy_pStream->CR, CR_EN);
+    while (GET_BIT(Copy_pStream->CR, CR_EN) != 0);
+}
+
+/**
+ * @brief Serve a stream interrupt: clear its flags, then run the callbacks.
+ *
+ * Half and full may be reported together when the interrupt was held off;
+ * the half callback then runs first.
+ */
+static void MDMA_voidServeStream(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    u32 Local_u32Flags = MDMA_u32GetFlags(Copy_u8Controller, Copy_u8Stream);
+    ST_CallBack_t *Local_pCallbacks = Global_StreamCallbacks[Copy_u8Controller][Copy_u8Stream];
+
+    MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, Local_u32Flags);
+
+    if (((Local_u32Flags & ((1UL << FLAG_TEIF) | (1UL << FLAG_DMEIF))) != 0) && (Local_pCallbacks[MDMA_EVENT_ERROR].pfHandler != NULL))
+    {
+        Local_pCallbacks[MDMA_EVENT_ERROR].pfHandler(Local_pCallbacks[MDMA_EVENT_ERROR].pvContext);
+    }
+    if ((GET_BIT(Local_u32Flags, FLAG_HTIF) != 0) && (Local_pCallbacks[MDMA_EVENT_HALF].pfHandler != NULL))
+    {
+        Local_pCallbacks[MDMA_EVENT_HALF].pfHandler(Local_pCallbacks[MDMA_EVENT_HALF].pvContext);
+    }
+    if ((GET_BIT(Local_u32Flags, FLAG_TCIF) != 0) && (Local_pCallbacks[MDMA_EVENT_FULL].pfHandler != NULL))
+    {
+        Local_pCallbacks[MDMA_EVENT_FULL].pfHandler(Local_pCallbacks[MDMA_EVENT_FULL].pvContext);
+    }
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Configure a stream, it is left disabled.
+ *
+ * The stream is claimed for its owner with interrupts disabled, so two
+ * drivers initializing it at once cannot both get it.
+ *
+ * @param Copy_u8Controller: MDMA_DMA1 or MDMA_DMA2.
+ * @param Copy_u8Stream: Stream, 0 to 7.
+ * @param Copy_pConfig: Configuration.
+ * @return u8: STD_OK, or STD_NOK for an invalid stream or combination, or a
+ *             stream owned by another user.
+ */
+u8 MDMA_u8Init(u8 Copy_u8Controller, u8 Copy_u8Stream, const MDMA_StreamConfig_t *Copy_pConfig)
+{
+    volatile DMA_Stream_t *Local_pStream;
+    u8 Local_u8Irq;
+    u32 Local_u32CR, Local_u32State;
+    u8 Local_u8Bit;
+
+    if ((MDMA_u8IsValid(Copy_u8Controller, Copy_u8Stream) == FALSE) || (Copy_pConfig->Channel > 7)
+        || ((Copy_pConfig->Direction == MDMA_MEM_TO_MEM)
+            && ((Copy_u8Controller != MDMA_DMA2) || (Copy_pConfig->Mode != MDMA_MODE_NORMAL) || (Copy_pConfig->Fifo == MDMA_FIFO_DIRECT)))
+        || ((Copy_pConfig->Fifo == MDMA_FIFO_DIRECT)
+            && ((Copy_pConfig->PeriphBurst != MDMA_BURST_SINGLE) || (Copy_pConfig->MemBurst != MDMA_BURST_SINGLE))))
+    {
+        return STD_NOK;
+    }
+
+    Local_u8Bit = (u8)((Copy_u8Controller * DMA_STREAMS) + Copy_u8Stream);
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if ((GET_BIT(Global_u16Initialized, Local_u8Bit) != 0)
+        && (Global_pvOwners[Copy_u8Controller][Copy_u8Stream] != Copy_pConfig->Owner))
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Global_pvOwners[Copy_u8Controller][Copy_u8Stream] = Copy_pConfig->Owner;
+    SET_BIT(Global_u16Initialized, Local_u8Bit);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+
+    MRCC_voidEnableVendorPerphiral(AHB1, (Copy_u8Controller == MDMA_DMA1) ? AHB1_DMA1EN : AHB1_DMA2EN);
+
+    Local_pStream = MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream);
+    MDMA_voidDisable(Local_pStream);
+    MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+
+    Local_u32CR = ((u32)Copy_pConfig->Channel << CR_CHSEL)
+                | ((u32)Copy_pConfig->MemBurst << CR_MBURST)
+                | ((u32)Copy_pConfig->PeriphBurst << CR_PBURST)
+                | ((u32)Copy_pConfig->Priority << CR_PL)
+                | ((u32)Copy_pConfig->MemSize << CR_MSIZE)
+                | ((u32)Copy_pConfig->PeriphSize << CR_PSIZE)
+                | ((u32)Copy_pConfig->Direction << CR_DIR);
+    if (Copy_pConfig->MemInc == TRUE)
+    {
+        SET_BIT(Local_u32CR, CR_MINC);
+    }
+    if (Copy_pConfig->PeriphInc == TRUE)
+    {
+        SET_BIT(Local_u32CR, CR_PINC);
+    }
+    if (Copy_pConfig->Mode == MDMA_MODE_DOUBLE_BUFFER)
+    {
+        SET_BIT(Local_u32CR, CR_DBM);
+        SET_BIT(Local_u32CR, CR_CIRC);
+    }
+    else if (Copy_pConfig->Mode == MDMA_MODE_CIRCULAR)
+    {
+        SET_BIT(Local_u32CR, CR_CIRC);
+    }
+    if ((Copy_pConfig->Interrupts & MDMA_IT_HALF) != 0)
+    {
+        SET_BIT(Local_u32CR, CR_HTIE);
+    }
+    if ((Copy_pConfig->Interrupts & MDMA_IT_FULL) != 0)
+    {
+        SET_BIT(Local_u32CR, CR_TCIE);
+    }
+    if ((Copy_pConfig->Interrupts & MDMA_IT_ERROR) != 0)
+    {
+        SET_BIT(Local_u32CR, CR_TEIE);
+        if (Copy_pConfig->Fifo == MDMA_FIFO_DIRECT)
+        {
+            SET_BIT(Local_u32CR, CR_DMEIE);
+        }
+    }
+
+    Local_pStream->FCR = (Copy_pConfig->Fifo == MDMA_FIFO_DIRECT) ? 0
+                       : ((1UL << FCR_DMDIS) | ((u32)Copy_pConfig->Fifo << FCR_FTH));
+    Local_pStream->CR = Local_u32CR;
+    Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream] = Local_u32CR;
+
+    Local_u8Irq = Global_u8IrqNumbers[Copy_u8Controller][Copy_u8Stream];
+    if (Copy_pConfig->Interrupts != 0)
+    {
+        MNVIC_voidSetInterruptPriority(Local_u8Irq, Copy_pConfig->IrqGroup, Copy_pConfig->IrqSubGroup);
+        MNVIC_voidClearPendingFlag(Local_u8Irq);
+        MNVIC_voidSetEnablePeripheralInterrupt(Local_u8Irq);
+    }
+    else
+    {
+        MNVIC_voidSetDisablePeripheralInterrupt(Local_u8Irq);
+    }
+    return STD_OK;
+}
+
+/**
+ * @brief Give a stream back: stopped, interrupt off, no callback, no owner.
+ *
+ * The owner is dropped with interrupts disabled, as MDMA_u8Init claims it:
+ * the initialized bits of all the streams share one word.
+ */
+void MDMA_voidRelease(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    u8 Local_u8Event;
+    u32 Local_u32State;
+
+    if (MDMA_u8IsValid(Copy_u8Controller, Copy_u8Stream) == TRUE)
+    {
+        MDMA_voidStop(Copy_u8Controller, Copy_u8Stream);
+        MNVIC_voidSetDisablePeripheralInterrupt(Global_u8IrqNumbers[Copy_u8Controller][Copy_u8Stream]);
+        for (Local_u8Event = 0; Local_u8Event < MDMA_EVENTS; Local_u8Event++)
+        {
+            Global_StreamCallbacks[Copy_u8Controller][Copy_u8Stream][Local_u8Event].pfHandler = NULL;
+            Global_StreamCallbacks[Copy_u8Controller][Copy_u8Stream][Local_u8Event].pvContext = NULL;
+        }
+        Local_u32State = MNVIC_u32DisableInterrupts();
+        Global_pvOwners[Copy_u8Controller][Copy_u8Stream] = NULL;
+        CLR_BIT(Global_u16Initialized, ((Copy_u8Controller * DMA_STREAMS) + Copy_u8Stream));
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+    }
+}
+
+/**
+ * @brief Set the callback of a stream event.
+ */
+void MDMA_voidSetCallback(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Event,
+                          CallBackFn_t pfHandler, void *pvContext)
+{
+    if ((MDMA_u8IsValid(Copy_u8Controller, Copy_u8Stream) == TRUE) && (Copy_u8Event < MDMA_EVENTS))
+    {
+        Global_StreamCallbacks[Copy_u8Controller][Copy_u8Stream][Copy_u8Event].pfHandler = pfHandler;
+        Global_StreamCallbacks[Copy_u8Controller][Copy_u8Stream][Copy_u8Event].pvContext = pvContext;
+    }
+}
+
+/**
+ * @brief Program the addresses and the count, then enable the stream.
+ *
+ * @return u8: STD_OK, or STD_NOK if the stream is not initialized or the count is 0.
+ */
+u8 MDMA_u8Start(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32PeriphAddr,
+                u32 Copy_u32Mem0Addr, u32 Copy_u32Mem1Addr, u16 Copy_u16Count)
+{
+    volatile DMA_Stream_t *Local_pStream;
+
+    if ((MDMA_u8IsClaimed(Copy_u8Controller, Copy_u8Stream) == FALSE) || (Copy_u16Count == 0))
+    {
+        return STD_NOK;
+    }
+
+    Local_pStream = MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream);
+    MDMA_voidDisable(Local_pStream);
+    MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+
+    Local_pStream->PAR = Copy_u32PeriphAddr;
+    Local_pStream->M0AR = Copy_u32Mem0Addr;
+    if (GET_BIT(Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream], CR_DBM) != 0)
+    {
+        Local_pStream->M1AR = Copy_u32Mem1Addr;
+    }
+    Local_pStream->NDTR = Copy_u16Count;
+    Local_pStream->CR = Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream] | (1UL << CR_EN);
+    return STD_OK;
+}
+
+/**
+ * @brief Start the next transfer of a stopped stream, same peripheral and configuration.
+ *
+ * The configuration is written back from the copy kept at init together with
+ * the enable bit, so no register is read. A stream that does not exist or
+ * has no owner, or a count of 0, is ignored.
+ */
+void MDMA_voidRestart(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32Mem0Addr, u16 Copy_u16Count)
+{
+    volatile DMA_Stream_t *Local_pStream;
+
+    if ((MDMA_u8IsClaimed(Copy_u8Controller, Copy_u8Stream) == FALSE) || (Copy_u16Count == 0))
+    {
+        return;
+    }
+
+    Local_pStream = MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream);
+    MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+    Local_pStream->M0AR = Copy_u32Mem0Addr;
+    Local_pStream->NDTR = Copy_u16Count;
+    Local_pStream->CR = Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream] | (1UL << CR_EN);
+}
+
+/**
+ * @brief Change the item size and the memory increment kept for the restarts.
+ *
+ * Ignored for a stream that does not exist or has no owner, or a size that
+ * is not a MDMA_Size_e.
+ */
+void MDMA_voidSetItemFormat(u8 Copy_u8Controller, u8 Copy_u8Stream, u8 Copy_u8Size, u8 Copy_u8MemInc)
+{
+    u32 Local_u32CR;
+
+    if ((MDMA_u8IsClaimed(Copy_u8Controller, Copy_u8Stream) == FALSE) || (Copy_u8Size > MDMA_SIZE_WORD))
+    {
+        return;
+    }
+
+    Local_u32CR = Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream];
+
+    Local_u32CR &= ~((CR_SIZE_MASK << CR_PSIZE) | (CR_SIZE_MASK << CR_MSIZE) | (1UL << CR_MINC));
+    Local_u32CR |= ((u32)Copy_u8Size << CR_PSIZE) | ((u32)Copy_u8Size << CR_MSIZE);
+    if (Copy_u8MemInc == TRUE)
+    {
+        SET_BIT(Local_u32CR, CR_MINC);
+    }
+    Global_u32StreamCR[Copy_u8Controller][Copy_u8Stream] = Local_u32CR;
+}
+
+/**
+ * @brief Point the memory the double-buffered stream is not using to a new buffer.
+ */
+void MDMA_voidSetIdleBuffer(u8 Copy_u8Controller, u8 Copy_u8Stream, u32 Copy_u32Addr)
+{
+    volatile DMA_Stream_t *Local_pStream = MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream);
+
+    if (GET_BIT(Local_pStream->CR, CR_CT) != 0)
+    {
+        Local_pStream->M0AR = Copy_u32Addr;
+    }
+    else
+    {
+        Local_pStream->M1AR = Copy_u32Addr;
+    }
+}
+
+/**
+ * @brief Get the memory a double-buffered stream is transferring.
+ */
+u8 MDMA_u8GetCurrentBuffer(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    return (u8)GET_BIT(MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream)->CR, CR_CT);
+}
+
+/**
+ * @brief Stop a stream and clear its flags.
+ */
+void MDMA_voidStop(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    if (MDMA_u8IsValid(Copy_u8Controller, Copy_u8Stream) == TRUE)
+    {
+        MDMA_voidDisable(MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream));
+        MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+    }
+}
+
+/**
+ * @brief Get the items left in the current buffer.
+ */
+u16 MDMA_u16GetRemaining(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    return (u16)MDMA_pGetStream(Copy_u8Controller, Copy_u8Stream)->NDTR;
+}
+
+/**
+ * @brief Poll a transfer started without interrupts.
+ *
+ * @return u8: MDMA_BUSY, MDMA_DONE or MDMA_FAILED (flags cleared in the last two cases).
+ */
+u8 MDMA_u8GetStatus(u8 Copy_u8Controller, u8 Copy_u8Stream)
+{
+    u32 Local_u32Flags = MDMA_u32GetFlags(Copy_u8Controller, Copy_u8Stream);
+
+    if ((Local_u32Flags & ((1UL << FLAG_TEIF) | (1UL << FLAG_DMEIF))) != 0)
+    {
+        MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+        return MDMA_FAILED;
+    }
+    if (GET_BIT(Local_u32Flags, FLAG_TCIF) != 0)
+    {
+        MDMA_voidClearFlags(Copy_u8Controller, Copy_u8Stream, FLAGS_ALL);
+        return MDMA_DONE;
+    }
+    return MDMA_BUSY;
+}
+
+/****************************************************/
+/* INTERRUPT HANDLERS                               */
+/****************************************************/
+
+#if MDMA_DMA1_HANDLERS == ENABLE
+void DMA1_Stream0_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 0); }
+void DMA1_Stream1_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 1); }
+void DMA1_Stream2_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 2); }
+void DMA1_Stream3_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 3); }
+void DMA1_Stream4_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 4); }
+void DMA1_Stream5_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 5); }
+void DMA1_Stream6_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 6); }
+void DMA1_Stream7_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA1, 7); }
+#endif
+
+#if MDMA_DMA2_HANDLERS == ENABLE
+void DMA2_Stream0_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 0); }
+void DMA2_Stream1_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 1); }
+void DMA2_Stream2_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 2); }
+void DMA2_Stream3_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 3); }
+void DMA2_Stream4_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 4); }
+void DMA2_Stream5_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 5); }
+void DMA2_Stream6_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 6); }
+void DMA2_Stream7_IRQHandler(void) { MDMA_voidServeStream(MDMA_DMA2, 7); }
+#endif
@@ -0,0 +1,43 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MDMA_register.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MDMA_REGISTER_H_
+#define MDMA_REGISTER_H_
+
+/* Base addresses of the DMA controllers */
+#define DMA1_BASE_ADDRESS   0x40026000
+#define DMA2_BASE_ADDRESS   0x40026400
+
+/**
+ * @brief Structure representing the registers of one stream.
+ */
+typedef struct
+{
+    u32 CR;         /**< Stream Configuration Register */
+    u32 NDTR;       /**< Number of Data Register */
+    u32 PAR;        /**< Peripheral Address Register (source in memory-to-memory) */
+    u32 M0AR;       /**< Memory 0 Address Register */
+    u32 M1AR;       /**< Memory 1 Address Register (double-buffer mode) */
+    u32 FCR;        /**< FIFO Control Register */
+} DMA_Stream_t;
+
+/**
+ * @brief Structure representing the DMA controller registers.
+ */
+typedef struct
+{
+    u32 LISR;           /**< Low Interrupt Status Register (streams 0-3) */
+    u32 HISR;           /**< High Interrupt Status Register (streams 4-7) */
+    u32 LIFCR;          /**< Low Interrupt Flag Clear Register */
+    u32 HIFCR;          /**< High Interrupt Flag Clear Register */
+    DMA_Stream_t S[8];  /**< Streams 0 to 7 */
+} DMA_t;
+
+#define DMA1        ((volatile DMA_t*)DMA1_BASE_ADDRESS)
+#define DMA2        ((volatile DMA_t*)DMA2_BASE_ADDRESS)
+
+#endif /* MDMA_REGISTER_H_ */
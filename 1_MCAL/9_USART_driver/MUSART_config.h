@@ -0,0 +1,26 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MUSART_config.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MUSART_CONFIG_H_
+#define MUSART_CONFIG_H_
+
+/* Interrupt handlers defined by the driver, per USART.
+ * Disable a USART whose handler is written elsewhere.
+ * Options: ENABLE or DISABLE */
+#define MUSART1_HANDLER         ENABLE
+#define MUSART2_HANDLER         ENABLE
+#define MUSART6_HANDLER         ENABLE
+
+/* Priority of the reception DMA stream, MDMA_Priority_e.
+ * At 4 Mbaud a byte arrives every 2.5 us: keep it above the memory copies. */
+#define MUSART_RX_DMA_PRIORITY  MDMA_PRIORITY_VERY_HIGH
+
+/* Priority of the transmission DMA stream, MDMA_Priority_e.
+ * A late byte only delays the line, it is never lost. */
+#define MUSART_TX_DMA_PRIORITY  MDMA_PRIORITY_MEDIUM
+
+#endif /* MUSART_CONFIG_H_ */
@@ -0,0 +1,220 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MUSART_interface.h               */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MUSART_INTERFACE_H_
+#define MUSART_INTERFACE_H_
+
+/*
+ * Reception runs on a circular DMA buffer: the CPU only runs on idle lines
+ * and on the half and full buffer marks. Each time, the bytes received since
+ * the last call are handed to the application in place, as (pointer, length)
+ * slices of the buffer; a frame crossing the end of the buffer comes as two
+ * slices. The last slice of a frame (the line went idle after it) carries
+ * FrameEnd = TRUE, possibly with a length of 0.
+ *
+ * A slice stays valid until the DMA wraps around to it: consume or copy it
+ * within (buffer size - slice length) byte times. The DMA stream and the USART
+ * interrupt share the same NVIC priority so slices are never handed twice.
+ *
+ * Transmission takes messages made of (pointer, length) segments, sent in
+ * place one after the other: a header, a pool buffer and a trailer go out
+ * without being copied together. Messages are queued; the DMA transfer
+ * complete interrupt chains the next segment or message within a byte time,
+ * so the line stays busy without gaps.
+ *
+ * Pins are set with MGPIO_voidSetPinAltFunc: AF7 for USART1 and USART2,
+ * AF8 for USART6.
+ */
+
+typedef enum {
+    MUSART_1 = 0,
+    MUSART_2,
+    MUSART_6
+} MUSART_Instance_e;
+
+typedef enum {
+    MUSART_PARITY_NONE = 0,
+    MUSART_PARITY_EVEN,
+    MUSART_PARITY_ODD
+} MUSART_Parity_e;
+
+typedef enum {
+    MUSART_STOP_1 = 0,
+    MUSART_STOP_2 = 2
+} MUSART_StopBits_e;
+
+/**
+ * @brief Line configuration, 8 data bits.
+ */
+typedef struct
+{
+    u32 BaudRate;       /**< Bits per second */
+    u8  Parity;         /**< MUSART_Parity_e, the parity bit is added after the 8 data bits */
+    u8  StopBits;       /**< MUSART_StopBits_e */
+    u8  IrqGroup;       /**< NVIC group priority of the USART and its DMA streams */
+    u8  IrqSubGroup;    /**< NVIC subgroup priority */
+} MUSART_Config_t;
+
+/**
+ * @brief Error and traffic counters, they wrap.
+ */
+typedef struct
+{
+    u32 Overrun;        /**< Bytes lost because the DMA did not read the data register in time */
+    u32 Framing;        /**< Stop bit missing */
+    u32 Noise;          /**< Noise detected on a bit */
+    u32 Parity;         /**< Parity mismatch */
+    u32 DmaErrors;      /**< DMA bus errors: the reception restarts at the start of the buffer,
+                             the message being sent fails */
+    u32 Frames;         /**< Frames ended by an idle line */
+    u32 Bytes;          /**< Bytes handed to the application */
+} MUSART_Stats_t;
+
+typedef enum {
+    MUSART_TX_IDLE = 0,     // never submitted
+    MUSART_TX_QUEUED,       // waiting or in progress
+    MUSART_TX_DONE,         // all segments read by the DMA, the buffers are free
+    MUSART_TX_FAILED        // DMA bus error, the message is cut short
+} MUSART_TxStatus_e;
+
+/**
+ * @brief One piece of a message.
+ */
+typedef struct
+{
+    const u8 *Data;     /**< Bytes to send */
+    u16       Length;   /**< Number of bytes, 0 to skip the segment */
+} MUSART_Segment_t;
+
+/**
+ * @brief Message object, allocated by the user and only handled through the
+ *        MUSART APIs. Zero-initialize it before its first use, and keep it,
+ *        its segment table and its buffers alive until it is done.
+ */
+typedef struct MUSART_TxMessage_s
+{
+    struct MUSART_TxMessage_s *Next;    /**< Next message in the queue */
+    const MUSART_Segment_t *Segments;   /**< Segment table */
+    u8           Count;                 /**< Segments in the table */
+    u8           Current;               /**< Next segment to send */
+    volatile u8  Status;                /**< MUSART_TxStatus_e */
+    CallBackFn_t pfHandler;             /**< Completion callback (CALLBACK.h), NULL for none */
+    void        *pvContext;             /**< Context passed to the callback */
+} MUSART_TxMessage_t;
+
+/**
+ * @brief Receives the slices of the buffer, runs in interrupt context.
+ * @param pvContext Context given to MUSART_u8StartReceive.
+ * @param Copy_pu8Data Start of the slice, inside the reception buffer.
+ * @param Copy_u16Length Bytes in the slice.
+ * @param Copy_u8FrameEnd TRUE if the line went idle after the slice.
+ */
+typedef void (*MUSART_RxHandler_t)(void *pvContext, const u8 *Copy_pu8Data, u16 Copy_u16Length, u8 Copy_u8FrameEnd);
+
+/* Function Prototypes */
+
+/**
+ * @brief Clocks the USART, applies the line configuration, enables the
+ *        transmitter and the receiver and prepares the transmission DMA stream.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_pConfig Line configuration.
+ * @return STD_OK, or STD_NOK if the baud rate is out of reach of the bus clock
+ *         (see MUSART_u8SetBaudRate) or the transmission stream is held by
+ *         another driver.
+ */
+u8 MUSART_u8Init(u8 Copy_u8Instance, const MUSART_Config_t *Copy_pConfig);
+
+/**
+ * @brief Programs the baud rate from the live bus clock frequency (read back
+ *        from RCC), oversampling by 8 when the rate is above PCLK / 16.
+ *        Call it again after changing the bus clock.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_u32BaudRate Bits per second.
+ * @return STD_OK, or STD_NOK if the rate is above PCLK / 8, below PCLK / 65535,
+ *         or more than 2 % away from the closest divider (e.g. 4 Mbaud on USART2
+ *         with PCLK1 at 42 MHz; USART1 and USART6 on PCLK2 reach it exactly at 84 MHz).
+ */
+u8 MUSART_u8SetBaudRate(u8 Copy_u8Instance, u32 Copy_u32BaudRate);
+
+/**
+ * @brief Gets the baud rate actually produced by the divider.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @return Bits per second.
+ */
+u32 MUSART_u32GetBaudRate(u8 Copy_u8Instance);
+
+/**
+ * @brief Starts the circular DMA reception with idle-line framing.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_pu8Buffer Reception buffer, kept by the driver until MUSART_voidStopReceive.
+ * @param Copy_u16Size Size of the buffer, even, at least 2 frames long for the zero-copy slices.
+ * @param pfHandler Slice handler.
+ * @param pvContext Context passed to the handler.
+ * @return STD_OK, or STD_NOK for an invalid instance, buffer or handler, or a
+ *         reception stream held by another driver.
+ */
+u8 MUSART_u8StartReceive(u8 Copy_u8Instance, u8 *Copy_pu8Buffer, u16 Copy_u16Size,
+                         MUSART_RxHandler_t pfHandler, void *pvContext);
+
+/**
+ * @brief Stops the reception, the bytes not handed yet are dropped.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ */
+void MUSART_voidStopReceive(u8 Copy_u8Instance);
+
+/**
+ * @brief Queues a message for transmission by DMA.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_pMessage Message object, not queued.
+ * @param Copy_pSegments Segment table, read when each segment starts.
+ * @param Copy_u8Count Segments in the table.
+ * @param pfHandler Callback run from the DMA interrupt once the DMA has read
+ *        the last segment (the last bytes are still being shifted out), NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK for an invalid instance or a message already queued.
+ */
+u8 MUSART_u8Send(u8 Copy_u8Instance, MUSART_TxMessage_t *Copy_pMessage, const MUSART_Segment_t *Copy_pSegments,
+                 u8 Copy_u8Count, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Gets the state of a message.
+ * @param Copy_pMessage Message object.
+ * @return MUSART_TxStatus_e.
+ */
+u8 MUSART_u8GetTxStatus(const MUSART_TxMessage_t *Copy_pMessage);
+
+/**
+ * @brief Checks whether the transmission is over: no message queued and the
+ *        last stop bit sent (e.g. before turning an RS-485 driver around).
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @return TRUE if idle, FALSE otherwise.
+ */
+u8 MUSART_u8IsTxIdle(u8 Copy_u8Instance);
+
+/**
+ * @brief Sends bytes with the CPU, waiting until the last one is shifted out.
+ *        Not to be mixed with queued messages on the same USART.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_pu8Data Bytes to send.
+ * @param Copy_u32Length Number of bytes.
+ */
+void MUSART_voidSendBlocking(u8 Copy_u8Instance, const u8 *Copy_pu8Data, u32 Copy_u32Length);
+
+/**
+ * @brief Copies the counters of a USART.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ * @param Copy_pStats Destination.
+ */
+void MUSART_voidGetStats(u8 Copy_u8Instance, MUSART_Stats_t *Copy_pStats);
+
+/**
+ * @brief Clears the counters of a USART.
+ * @param Copy_u8Instance MUSART_Instance_e.
+ */
+void MUSART_voidResetStats(u8 Copy_u8Instance);
+
+#endif /* MUSART_INTERFACE_H_ */
@@ -0,0 +1,103 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MUSART_private.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MUSART_PRIVATE_H_
+#define MUSART_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* SR Bit Definitions */
+#define SR_PE               0   // Parity error
+#define SR_FE               1   // Framing error
+#define SR_NF               2   // Noise detected
+#define SR_ORE              3   // Overrun error
+#define SR_IDLE             4   // Idle line detected
+#define SR_RXNE             5   // Read data register not empty
+#define SR_TC               6   // Transmission complete
+#define SR_TXE              7   // Transmit data register empty
+
+#define SR_ERRORS           ((1UL << SR_PE) | (1UL << SR_FE) | (1UL << SR_NF) | (1UL << SR_ORE))
+
+/* CR1 Bit Definitions */
+#define CR1_RE              2   // Receiver enable
+#define CR1_TE              3   // Transmitter enable
+#define CR1_IDLEIE          4   // Idle interrupt enable
+#define CR1_TCIE            6   // Transmission complete interrupt enable
+#define CR1_PEIE            8   // Parity error interrupt enable
+#define CR1_PS              9   // Parity selection, 1 for odd
+#define CR1_PCE             10  // Parity control enable
+#define CR1_M               12  // Word length, 1 for 9 bits (8 data bits and the parity)
+#define CR1_UE              13  // USART enable
+#define CR1_OVER8           15  // Oversampling by 8
+
+/* CR2 Bit Definitions */
+#define CR2_STOP            12  // Stop bits, 2 bits: 00 one, 10 two
+
+/* CR3 Bit Definitions */
+#define CR3_EIE             0   // Error interrupt enable (framing, overrun, noise with DMA reception)
+#define CR3_DMAR            6   // DMA enable receiver
+#define CR3_DMAT            7   // DMA enable transmitter
+
+/* BRR: USARTDIV in 1/16 (OVER16) or in 1/8 with the fraction on 3 bits (OVER8) */
+#define BRR_MIN_DIV16       16UL    // USARTDIV 1.0 with oversampling by 16
+#define BRR_MIN_DIV8        8UL     // USARTDIV 1.0 with oversampling by 8
+#define BRR_MAX_DIV         0xFFFFUL
+
+/* Largest baud rate error accepted, 1 / MUSART_BAUD_TOLERANCE (2 %) */
+#define MUSART_BAUD_TOLERANCE   50UL
+
+#define USART_INSTANCES     3
+
+/* Interrupt lines of USART1, USART2 and USART6 */
+#define USART_IRQ_NUMBERS   {37, 38, 71}
+
+/* Receive DMA request of each USART: controller, stream, channel (reference manual
+ * request tables). USART1 may also use DMA2 stream 2, USART6 DMA2 stream 2
+ * (the SPI1 RX default). */
+#define USART_RX_DMA        { {MDMA_DMA2, 5, 4}, {MDMA_DMA1, 5, 4}, {MDMA_DMA2, 1, 5} }
+
+/* Transmit DMA request of each USART. USART6 may also use DMA2 stream 7. */
+#define USART_TX_DMA        { {MDMA_DMA2, 7, 4}, {MDMA_DMA1, 6, 4}, {MDMA_DMA2, 6, 5} }
+
+/**
+ * @brief Reception state of one USART.
+ */
+typedef struct
+{
+    u8                *Buffer;      /**< Circular buffer written by the DMA */
+    u16                Size;        /**< Size of the buffer */
+    u16                Read;        /**< Next byte not handed to the application */
+    u8                 FrameOpen;   /**< TRUE when bytes were handed since the last frame end */
+    u8                 Instance;    /**< MUSART_Instance_e */
+    MUSART_RxHandler_t pfHandler;   /**< Slice handler */
+    void              *pvContext;   /**< Context passed to the handler */
+} MUSART_RxState_t;
+
+/**
+ * @brief Transmission state of one USART.
+ */
+typedef struct
+{
+    MUSART_TxMessage_t *Head;       /**< Message on the stream (or next to send), oldest first */
+    MUSART_TxMessage_t *Tail;       /**< Last queued message */
+    u8                  Busy;       /**< TRUE while a segment is on the stream */
+    u8                  Primed;     /**< TRUE once the stream points to the data register */
+    u8                  Instance;   /**< MUSART_Instance_e */
+} MUSART_TxState_t;
+
+/**
+ * @brief DMA request of a USART direction.
+ */
+typedef struct
+{
+    u8 Controller;
+    u8 Stream;
+    u8 Channel;
+} MUSART_DmaRequest_t;
+
+#endif /* MUSART_PRIVATE_H_ */
@@ -0,0 +1,673 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MUSART_program.c                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MRCC_interface.h"
+#include "NVIC_interface.h"
+#include "MDMA_interface.h"
+
+/****************************************************/
+/* USART Directives                                 */
+/****************************************************/
+#include "MUSART_interface.h"
+#include "MUSART_config.h"
+#include "MUSART_private.h"
+#include "MUSART_register.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static volatile USART_t *const Global_pUSART[USART_INSTANCES] = {USART1, USART2, USART6};
+static const u8 Global_u8IrqNumbers[USART_INSTANCES] = USART_IRQ_NUMBERS;
+static const MUSART_DmaRequest_t Global_RxDma[USART_INSTANCES] = USART_RX_DMA;
+static const MUSART_DmaRequest_t Global_TxDma[USART_INSTANCES] = USART_TX_DMA;
+
+static u8 Global_u8IrqGroup[USART_INSTANCES];
+static u8 Global_u8IrqSubGroup[USART_INSTANCES];
+
+static MUSART_RxState_t Global_RxState[USART_INSTANCES];
+static MUSART_TxState_t Global_TxState[USART_INSTANCES];
+static MUSART_Stats_t Global_Stats[USART_INSTANCES];
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Get the live clock frequency of the bus of a USART.
+ */
+static u32 MUSART_u32GetBusClock(u8 Copy_u8Instance)
+{
+    return (Copy_u8Instance == MUSART_2) ? MRCC_u32GetAPB1ClockFreq() : MRCC_u32GetAPB2ClockFreq();
+}
+
+/**
+ * @brief Hand one slice of the buffer to the application.
+ */
+static void MUSART_voidHandSlice(MUSART_RxState_t *Copy_pState, u16 Copy_u16Start, u16 Copy_u16Length, u8 Copy_u8FrameEnd)
+{
+    MUSART_Stats_t *Local_pStats = &Global_Stats[Copy_pState->Instance];
+
+    Local_pStats->Bytes += Copy_u16Length;
+    if (Copy_u8FrameEnd == TRUE)
+    {
+        Local_pStats->Frames++;
+    }
+    Copy_pState->FrameOpen = (Copy_u8FrameEnd == TRUE) ? FALSE : TRUE;
+    Copy_pState->pfHandler(Copy_pState->pvContext, &Copy_pState->Buffer[Copy_u16Start], Copy_u16Length, Copy_u8FrameEnd);
+}
+
+/**
+ * @brief Hand the bytes written by the DMA since the last call.
+ *
+ * The write position comes from the count left in the stream; the slice
+ * behind the end of the buffer goes first when the DMA has wrapped.
+ *
+ * @param Copy_u8FrameEnd: TRUE when called on an idle line.
+ */
+static void MUSART_voidDeliver(MUSART_RxState_t *Copy_pState, u8 Copy_u8FrameEnd)
+{
+    const MUSART_DmaRequest_t *Local_pDma = &Global_RxDma[Copy_pState->Instance];
+    u16 Local_u16Write = Copy_pState->Size - MDMA_u16GetRemaining(Local_pDma->Controller, Local_pDma->Stream);
+
+    if (Local_u16Write >= Copy_pState->Size)
+    {
+        Local_u16Write = 0;     // count reloaded at the end of the buffer
+    }
+
+    if (Local_u16Write < Copy_pState->Read)
+    {
+        MUSART_voidHandSlice(Copy_pState, Copy_pState->Read, Copy_pState->Size - Copy_pState->Read,
+                             (Local_u16Write == 0) ? Copy_u8FrameEnd : FALSE);
+        Copy_pState->Read = 0;
+    }
+    if (Local_u16Write > Copy_pState->Read)
+    {
+        MUSART_voidHandSlice(Copy_pState, Copy_pState->Read, Local_u16Write - Copy_pState->Read, Copy_u8FrameEnd);
+        Copy_pState->Read = Local_u16Write;
+    }
+    else if ((Copy_u8FrameEnd == TRUE) && (Copy_pState->FrameOpen == TRUE))
+    {
+        // The frame was already handed by the buffer marks, only its end is left
+        MUSART_voidHandSlice(Copy_pState, Copy_pState->Read, 0, TRUE);
+    }
+}
+
+/**
+ * @brief Half and full buffer marks of the reception stream.
+ */
+static void MUSART_voidOnDmaMark(void *pvContext)
+{
+    MUSART_voidDeliver((MUSART_RxState_t *)pvContext, FALSE);
+}
+
+/**
+ * @brief Bus error of the reception stream: the stream is disabled, start over.
+ */
+static void MUSART_voidOnDmaError(void *pvContext)
+{
+    MUSART_RxState_t *Local_pState = (MUSART_RxState_t *)pvContext;
+    const MUSART_DmaRequest_t *Local_pDma = &Global_RxDma[Local_pState->Instance];
+
+    Global_Stats[Local_pState->Instance].DmaErrors++;
+    Local_pState->Read = 0;
+    Local_pState->FrameOpen = FALSE;
+    MDMA_u8Start(Local_pDma->Controller, Local_pDma->Stream, (u32)&Global_pUSART[Local_pState->Instance]->DR,
+                 (u32)Local_pState->Buffer, 0, Local_pState->Size);
+}
+
+/**
+ * @brief Start the next non-empty segment of the head message.
+ *
+ * The first segment after init programs the whole stream, the next ones only
+ * move the memory address and the count.
+ *
+ * @return u8: TRUE if a segment is started, FALSE if the message is over.
+ */
+static u8 MUSART_u8StartSegment(MUSART_TxState_t *Copy_pState)
+{
+    MUSART_TxMessage_t *Local_pMessage = Copy_pState->Head;
+    const MUSART_DmaRequest_t *Local_pDma = &Global_TxDma[Copy_pState->Instance];
+    const MUSART_Segment_t *Local_pSegment;
+
+    while ((Local_pMessage->Current < Local_pMessage->Count) && (Local_pMessage->Segments[Local_pMessage->Current].Length == 0))
+    {
+        Local_pMessage->Current++;
+    }
+    if (Local_pMessage->Current >= Local_pMessage->Count)
+    {
+        return FALSE;
+    }
+    Local_pSegment = &Local_pMessage->Segments[Local_pMessage->Current++];
+
+    if (Copy_pState->Primed == TRUE)
+    {
+        MDMA_voidRestart(Local_pDma->Controller, Local_pDma->Stream, (u32)Local_pSegment->Data, Local_pSegment->Length);
+    }
+    else
+    {
+        MDMA_u8Start(Local_pDma->Controller, Local_pDma->Stream, (u32)&Global_pUSART[Copy_pState->Instance]->DR,
+                     (u32)Local_pSegment->Data, 0, Local_pSegment->Length);
+        Copy_pState->Primed = TRUE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Remove the head message from the queue.
+ */
+static MUSART_TxMessage_t *MUSART_pPopMessage(MUSART_TxState_t *Copy_pState)
+{
+    MUSART_TxMessage_t *Local_pMessage = Copy_pState->Head;
+
+    Copy_pState->Head = Local_pMessage->Next;
+    if (Copy_pState->Head == NULL)
+    {
+        Copy_pState->Tail = NULL;
+    }
+    return Local_pMessage;
+}
+
+/**
+ * @brief Report the result of a message removed from the queue.
+ */
+static void MUSART_voidFinishMessage(MUSART_TxMessage_t *Copy_pMessage, u8 Copy_u8Status)
+{
+    Copy_pMessage->Status = Copy_u8Status;
+    if (Copy_pMessage->pfHandler != NULL)
+    {
+        Copy_pMessage->pfHandler(Copy_pMessage->pvContext);
+    }
+}
+
+/**
+ * @brief Start the queue until a segment is on the stream or the queue is empty.
+ *        Interrupts must be disabled or the caller must be the stream interrupt.
+ */
+static void MUSART_voidRunTxQueue(MUSART_TxState_t *Copy_pState)
+{
+    while ((Copy_pState->Head != NULL) && (Copy_pState->Busy == FALSE))
+    {
+        if (MUSART_u8StartSegment(Copy_pState) == TRUE)
+        {
+            Copy_pState->Busy = TRUE;
+        }
+        else
+        {
+            MUSART_voidFinishMessage(MUSART_pPopMessage(Copy_pState), MUSART_TX_DONE);
+        }
+    }
+}
+
+/**
+ * @brief Remove the finished head message and report it.
+ *
+ * The next message is chained before the callback when it has data, so the
+ * line does not idle while the callback runs. Messages without data are
+ * finished by MUSART_voidRunTxQueue only after this one: the callbacks always
+ * run in the order the messages were queued.
+ */
+static void MUSART_voidEndMessage(MUSART_TxState_t *Copy_pState, u8 Copy_u8Status)
+{
+    MUSART_TxMessage_t *Local_pMessage = MUSART_pPopMessage(Copy_pState);
+
+    Copy_pState->Busy = FALSE;
+    if ((Copy_pState->Head != NULL) && (MUSART_u8StartSegment(Copy_pState) == TRUE))
+    {
+        Copy_pState->Busy = TRUE;
+    }
+    MUSART_voidFinishMessage(Local_pMessage, Copy_u8Status);
+    MUSART_voidRunTxQueue(Copy_pState);
+}
+
+/**
+ * @brief Transmission stream complete: chain the next segment, or end the message.
+ */
+static void MUSART_voidOnTxFull(void *pvContext)
+{
+    MUSART_TxState_t *Local_pState = (MUSART_TxState_t *)pvContext;
+
+    if (MUSART_u8StartSegment(Local_pState) == FALSE)
+    {
+        MUSART_voidEndMessage(Local_pState, MUSART_TX_DONE);
+    }
+}
+
+/**
+ * @brief Bus error of the transmission stream: drop the message, go on with the next.
+ */
+static void MUSART_voidOnTxError(void *pvContext)
+{
+    MUSART_TxState_t *Local_pState = (MUSART_TxState_t *)pvContext;
+
+    Global_Stats[Local_pState->Instance].DmaErrors++;
+    MUSART_voidEndMessage(Local_pState, MUSART_TX_FAILED);
+}
+
+/**
+ * @brief Serve a USART interrupt: line errors and idle line.
+ *
+ * The flags are cleared by reading SR then DR. The DMA has already taken the
+ * data register by then, except on an overrun where the byte is lost anyway.
+ */
+static void MUSART_voidServe(u8 Copy_u8Instance)
+{
+    volatile USART_t *Local_pUSART = Global_pUSART[Copy_u8Instance];
+    MUSART_Stats_t *Local_pStats = &Global_Stats[Copy_u8Instance];
+    u32 Local_u32Status = Local_pUSART->SR;
+
+    if ((Local_u32Status & (SR_ERRORS | (1UL << SR_IDLE))) != 0)
+    {
+        (void)Local_pUSART->DR;
+
+        if (GET_BIT(Local_u32Status, SR_ORE) != 0)
+        {
+            Local_pStats->Overrun++;
+        }
+        if (GET_BIT(Local_u32Status, SR_FE) != 0)
+        {
+            Local_pStats->Framing++;
+        }
+        if (GET_BIT(Local_u32Status, SR_NF) != 0)
+        {
+            Local_pStats->Noise++;
+        }
+        if (GET_BIT(Local_u32Status, SR_PE) != 0)
+        {
+            Local_pStats->Parity++;
+        }
+        if ((GET_BIT(Local_u32Status, SR_IDLE) != 0) && (Global_RxState[Copy_u8Instance].pfHandler != NULL))
+        {
+            MUSART_voidDeliver(&Global_RxState[Copy_u8Instance], TRUE);
+        }
+    }
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/**
+ * @brief Clock the USART, configure the line and enable it.
+ *
+ * @param Copy_u8Instance: MUSART_Instance_e.
+ * @param Copy_pConfig: Line configuration.
+ * @return u8: STD_OK, or STD_NOK if the baud rate is out of reach or the stream is held by another driver.
+ */
+u8 MUSART_u8Init(u8 Copy_u8Instance, const MUSART_Config_t *Copy_pConfig)
+{
+    volatile USART_t *Local_pUSART;
+    const MUSART_DmaRequest_t *Local_pDma;
+    MUSART_TxState_t *Local_pState;
+    u32 Local_u32CR1 = 0;
+    MDMA_StreamConfig_t Local_DmaConfig = {
+        .Direction = MDMA_MEM_TO_PERIPH, .Priority = MUSART_TX_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_BYTE, .MemSize = MDMA_SIZE_BYTE, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_HALF,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_FULL | MDMA_IT_ERROR
+    };
+
+    if (Copy_u8Instance >= USART_INSTANCES)
+    {
+        return STD_NOK;
+    }
+    Local_pUSART = Global_pUSART[Copy_u8Instance];
+    Local_pDma = &Global_TxDma[Copy_u8Instance];
+    Local_pState = &Global_TxState[Copy_u8Instance];
+
+    // Transmission stream: requested by TXE, restarted segment after segment.
+    // Claimed first, a stream held by another driver leaves everything as it was
+    Local_DmaConfig.Channel = Local_pDma->Channel;
+    Local_DmaConfig.IrqGroup = Copy_pConfig->IrqGroup;
+    Local_DmaConfig.IrqSubGroup = Copy_pConfig->IrqSubGroup;
+    Local_DmaConfig.Owner = Local_pState;
+    if (MDMA_u8Init(Local_pDma->Controller, Local_pDma->Stream, &Local_DmaConfig) == STD_NOK)
+    {
+        return STD_NOK;
+    }
+
+    switch (Copy_u8Instance)
+    {
+    case MUSART_1:
+        MRCC_voidEnableVendorPerphiral(APB2, APB2_USART1EN);
+        break;
+    case MUSART_2:
+        MRCC_voidEnableVendorPerphiral(APB1, APB1_USART2EN);
+        break;
+    default:
+        MRCC_voidEnableVendorPerphiral(APB2, APB2_USART6EN);
+        break;
+    }
+
+    Local_pUSART->CR1 = 0;
+    Local_pUSART->CR2 = (u32)Copy_pConfig->StopBits << CR2_STOP;
+    Local_pUSART->CR3 = 0;
+    if (Copy_pConfig->Parity != MUSART_PARITY_NONE)
+    {
+        SET_BIT(Local_u32CR1, CR1_PCE);
+        SET_BIT(Local_u32CR1, CR1_M);
+        if (Copy_pConfig->Parity == MUSART_PARITY_ODD)
+        {
+            SET_BIT(Local_u32CR1, CR1_PS);
+        }
+    }
+    Local_pUSART->CR1 = Local_u32CR1;
+
+    if (MUSART_u8SetBaudRate(Copy_u8Instance, Copy_pConfig->BaudRate) == STD_NOK)
+    {
+        // The USART stays disabled, give the stream back to the other drivers
+        MDMA_voidRelease(Local_pDma->Controller, Local_pDma->Stream);
+        return STD_NOK;
+    }
+    Local_pUSART->CR1 = Local_u32CR1 | (Local_pUSART->CR1 & (1UL << CR1_OVER8))
+                      | (1UL << CR1_TE) | (1UL << CR1_RE) | (1UL << CR1_UE);
+
+    Global_u8IrqGroup[Copy_u8Instance] = Copy_pConfig->IrqGroup;
+    Global_u8IrqSubGroup[Copy_u8Instance] = Copy_pConfig->IrqSubGroup;
+    MNVIC_voidSetInterruptPriority(Global_u8IrqNumbers[Copy_u8Instance], Copy_pConfig->IrqGroup, Copy_pConfig->IrqSubGroup);
+    MNVIC_voidSetEnablePeripheralInterrupt(Global_u8IrqNumbers[Copy_u8Instance]);
+
+    Local_pState->Head = NULL;
+    Local_pState->Tail = NULL;
+    Local_pState->Busy = FALSE;
+    Local_pState->Primed = FALSE;
+    Local_pState->Instance = Copy_u8Instance;
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_FULL, MUSART_voidOnTxFull, Local_pState);
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_ERROR, MUSART_voidOnTxError, Local_pState);
+    SET_BIT(Local_pUSART->CR3, CR3_DMAT);
+    return STD_OK;
+}
+
+/**
+ * @brief Program the divider from the live bus clock.
+ *
+ * BRR holds USARTDIV in 1/16 with oversampling by 16, in 1/8 with
+ * oversampling by 8: either way PCLK / baud rounded. Below 16 (rates above
+ * PCLK / 16) the USART oversamples by 8, the 3 fraction bits stay in place
+ * and the mantissa moves up one bit. The USART is disabled while OVER8 changes.
+ *
+ * @return u8: STD_OK, or STD_NOK if the rate is out of reach or off by more
+ *             than MUSART_BAUD_TOLERANCE.
+ */
+u8 MUSART_u8SetBaudRate(u8 Copy_u8Instance, u32 Copy_u32BaudRate)
+{
+    volatile USART_t *Local_pUSART;
+    u32 Local_u32Clock;
+    u32 Local_u32Div;
+    u32 Local_u32Actual;
+    u32 Local_u32Enabled;
+
+    if ((Copy_u8Instance >= USART_INSTANCES) || (Copy_u32BaudRate == 0))
+    {
+        return STD_NOK;
+    }
+    Local_pUSART = Global_pUSART[Copy_u8Instance];
+    Local_u32Clock = MUSART_u32GetBusClock(Copy_u8Instance);
+
+    Local_u32Div = (Local_u32Clock + (Copy_u32BaudRate / 2)) / Copy_u32BaudRate;
+    if ((Local_u32Div < BRR_MIN_DIV8) || (Local_u32Div > BRR_MAX_DIV))
+    {
+        return STD_NOK;
+    }
+    Local_u32Actual = Local_u32Clock / Local_u32Div;
+    if ((((Local_u32Actual > Copy_u32BaudRate) ? (Local_u32Actual - Copy_u32BaudRate) : (Copy_u32BaudRate - Local_u32Actual))
+         * MUSART_BAUD_TOLERANCE) > Copy_u32BaudRate)
+    {
+        return STD_NOK;
+    }
+
+    Local_u32Enabled = Local_pUSART->CR1 & (1UL << CR1_UE);
+    CLR_BIT(Local_pUSART->CR1, CR1_UE);
+    if (Local_u32Div >= BRR_MIN_DIV16)
+    {
+        CLR_BIT(Local_pUSART->CR1, CR1_OVER8);
+        Local_pUSART->BRR = Local_u32Div;
+    }
+    else
+    {
+        SET_BIT(Local_pUSART->CR1, CR1_OVER8);
+        Local_pUSART->BRR = ((Local_u32Div & ~7UL) << 1) | (Local_u32Div & 7UL);
+    }
+    Local_pUSART->CR1 |= Local_u32Enabled;
+    return STD_OK;
+}
+
+/**
+ * @brief Get the baud rate produced by the divider.
+ */
+u32 MUSART_u32GetBaudRate(u8 Copy_u8Instance)
+{
+    volatile USART_t *Local_pUSART = Global_pUSART[Copy_u8Instance];
+    u32 Local_u32Div = Local_pUSART->BRR;
+
+    if (GET_BIT(Local_pUSART->CR1, CR1_OVER8) != 0)
+    {
+        Local_u32Div = ((Local_u32Div >> 1) & ~7UL) | (Local_u32Div & 7UL);
+    }
+    return (Local_u32Div != 0) ? (MUSART_u32GetBusClock(Copy_u8Instance) / Local_u32Div) : 0;
+}
+
+/**
+ * @brief Start the circular DMA reception with idle-line framing.
+ *
+ * The stream runs in direct mode, so a byte counted by the stream is already
+ * in the buffer when a slice is handed.
+ *
+ * @return u8: STD_OK, or STD_NOK for invalid parameters or a stream held by another driver.
+ */
+u8 MUSART_u8StartReceive(u8 Copy_u8Instance, u8 *Copy_pu8Buffer, u16 Copy_u16Size,
+                         MUSART_RxHandler_t pfHandler, void *pvContext)
+{
+    volatile USART_t *Local_pUSART;
+    const MUSART_DmaRequest_t *Local_pDma;
+    MUSART_RxState_t *Local_pState;
+    MDMA_StreamConfig_t Local_DmaConfig = {
+        .Direction = MDMA_PERIPH_TO_MEM, .Priority = MUSART_RX_DMA_PRIORITY,
+        .PeriphSize = MDMA_SIZE_BYTE, .MemSize = MDMA_SIZE_BYTE, .PeriphInc = FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_CIRCULAR, .Fifo = MDMA_FIFO_DIRECT,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_HALF | MDMA_IT_FULL | MDMA_IT_ERROR
+    };
+
+    if ((Copy_u8Instance >= USART_INSTANCES) || (Copy_pu8Buffer == NULL) || (Copy_u16Size < 2) || (pfHandler == NULL))
+    {
+        return STD_NOK;
+    }
+    MUSART_voidStopReceive(Copy_u8Instance);
+
+    Local_pUSART = Global_pUSART[Copy_u8Instance];
+    Local_pDma = &Global_RxDma[Copy_u8Instance];
+    Local_pState = &Global_RxState[Copy_u8Instance];
+
+    Local_pState->Buffer = Copy_pu8Buffer;
+    Local_pState->Size = Copy_u16Size;
+    Local_pState->Read = 0;
+    Local_pState->FrameOpen = FALSE;
+    Local_pState->Instance = Copy_u8Instance;
+    Local_pState->pvContext = pvContext;
+    Local_pState->pfHandler = pfHandler;
+
+    Local_DmaConfig.Channel = Local_pDma->Channel;
+    Local_DmaConfig.IrqGroup = Global_u8IrqGroup[Copy_u8Instance];
+    Local_DmaConfig.IrqSubGroup = Global_u8IrqSubGroup[Copy_u8Instance];
+    Local_DmaConfig.Owner = Local_pState;
+    if (MDMA_u8Init(Local_pDma->Controller, Local_pDma->Stream, &Local_DmaConfig) == STD_NOK)
+    {
+        Local_pState->pfHandler = NULL;     // MUSART_voidStopReceive must not stop the other driver's stream
+        return STD_NOK;
+    }
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_HALF, MUSART_voidOnDmaMark, Local_pState);
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_FULL, MUSART_voidOnDmaMark, Local_pState);
+    MDMA_voidSetCallback(Local_pDma->Controller, Local_pDma->Stream, MDMA_EVENT_ERROR, MUSART_voidOnDmaError, Local_pState);
+
+    // Drop a stale idle or error flag, then let the DMA take the data register
+    (void)Local_pUSART->SR;
+    (void)Local_pUSART->DR;
+    MDMA_u8Start(Local_pDma->Controller, Local_pDma->Stream, (u32)&Local_pUSART->DR, (u32)Copy_pu8Buffer, 0, Copy_u16Size);
+    Local_pUSART->CR3 |= (1UL << CR3_DMAR) | (1UL << CR3_EIE);
+    Local_pUSART->CR1 |= (1UL << CR1_IDLEIE) | (1UL << CR1_PEIE);
+    return STD_OK;
+}
+
+/**
+ * @brief Stop the reception.
+ */
+void MUSART_voidStopReceive(u8 Copy_u8Instance)
+{
+    volatile USART_t *Local_pUSART;
+    const MUSART_DmaRequest_t *Local_pDma;
+
+    if (Copy_u8Instance >= USART_INSTANCES)
+    {
+        return;
+    }
+    Local_pUSART = Global_pUSART[Copy_u8Instance];
+    Local_pDma = &Global_RxDma[Copy_u8Instance];
+
+    Local_pUSART->CR1 &= ~((1UL << CR1_IDLEIE) | (1UL << CR1_PEIE));
+    Local_pUSART->CR3 &= ~((1UL << CR3_DMAR) | (1UL << CR3_EIE));
+    if (Global_RxState[Copy_u8Instance].pfHandler != NULL)
+    {
+        MDMA_voidStop(Local_pDma->Controller, Local_pDma->Stream);
+        Global_RxState[Copy_u8Instance].pfHandler = NULL;
+    }
+}
+
+/**
+ * @brief Queue a message for transmission.
+ *
+ * @return u8: STD_OK, or STD_NOK for an invalid instance or a message already queued.
+ */
+u8 MUSART_u8Send(u8 Copy_u8Instance, MUSART_TxMessage_t *Copy_pMessage, const MUSART_Segment_t *Copy_pSegments,
+                 u8 Copy_u8Count, CallBackFn_t pfHandler, void *pvContext)
+{
+    MUSART_TxState_t *Local_pState;
+    u32 Local_u32State;
+
+    if (Copy_u8Instance >= USART_INSTANCES)
+    {
+        return STD_NOK;
+    }
+    Local_pState = &Global_TxState[Copy_u8Instance];
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Copy_pMessage->Status == MUSART_TX_QUEUED)
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Copy_pMessage->Next = NULL;
+    Copy_pMessage->Segments = Copy_pSegments;
+    Copy_pMessage->Count = Copy_u8Count;
+    Copy_pMessage->Current = 0;
+    Copy_pMessage->Status = MUSART_TX_QUEUED;
+    Copy_pMessage->pfHandler = pfHandler;
+    Copy_pMessage->pvContext = pvContext;
+
+    if (Local_pState->Tail != NULL)
+    {
+        Local_pState->Tail->Next = Copy_pMessage;
+    }
+    else
+    {
+        Local_pState->Head = Copy_pMessage;
+    }
+    Local_pState->Tail = Copy_pMessage;
+    MUSART_voidRunTxQueue(Local_pState);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return STD_OK;
+}
+
+/**
+ * @brief Get the state of a message.
+ */
+u8 MUSART_u8GetTxStatus(const MUSART_TxMessage_t *Copy_pMessage)
+{
+    return Copy_pMessage->Status;
+}
+
+/**
+ * @brief Check that no message is queued and the last stop bit is out.
+ */
+u8 MUSART_u8IsTxIdle(u8 Copy_u8Instance)
+{
+    return ((Global_TxState[Copy_u8Instance].Head == NULL) && (GET_BIT(Global_pUSART[Copy_u8Instance]->SR, SR_TC) != 0)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Send bytes with the CPU and wait for the end of the last one.
+ */
+void MUSART_voidSendBlocking(u8 Copy_u8Instance, const u8 *Copy_pu8Data, u32 Copy_u32Length)
+{
+    volatile USART_t *Local_pUSART = Global_pUSART[Copy_u8Instance];
+
+    while (Copy_u32Length-- != 0)
+    {
+        while (GET_BIT(Local_pUSART->SR, SR_TXE) == 0);
+        Local_pUSART->DR = *Copy_pu8Data++;
+    }
+    while (GET_BIT(Local_pUSART->SR, SR_TC) == 0);
+}
+
+/**
+ * @brief Copy the counters of a USART.
+ */
+void MUSART_voidGetStats(u8 Copy_u8Instance, MUSART_Stats_t *Copy_pStats)
+{
+    if (Copy_u8Instance < USART_INSTANCES)
+    {
+        *Copy_pStats = Global_Stats[Copy_u8Instance];
+    }
+}
+
+/**
+ * @brief Clear the counters of a USART.
+ */
+void MUSART_voidResetStats(u8 Copy_u8Instance)
+{
+    static const MUSART_Stats_t Local_Zero = {0};
+
+    if (Copy_u8Instance < USART_INSTANCES)
+    {
+        Global_Stats[Copy_u8Instance] = Local_Zero;
+    }
+}
+
+/****************************************************/
+/* INTERRUPT HANDLERS                               */
+/****************************************************/
+
+#if MUSART1_HANDLER == ENABLE
+void USART1_IRQHandler(void)
+{
+    MUSART_voidServe(MUSART_1);
+}
+#endif
+
+#if MUSART2_HANDLER == ENABLE
+void USART2_IRQHandler(void)
+{
+    MUSART_voidServe(MUSART_2);
+}
+#endif
+
+#if MUSART6_HANDLER == ENABLE
+void USART6_IRQHandler(void)
+{
+    MUSART_voidServe(MUSART_6);
+}
+#endif
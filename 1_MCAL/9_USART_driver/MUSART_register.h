@@ -0,0 +1,34 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : MUSART_register.h                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef MUSART_REGISTER_H_
+#define MUSART_REGISTER_H_
+
+/* Base addresses of the USARTs (USART1 and USART6 on APB2, USART2 on APB1) */
+#define USART1_BASE_ADDRESS     0x40011000
+#define USART2_BASE_ADDRESS     0x40004400
+#define USART6_BASE_ADDRESS     0x40011400
+
+/**
+ * @brief Structure representing the USART registers.
+ */
+typedef struct
+{
+    u32 SR;         /**< Status Register */
+    u32 DR;         /**< Data Register */
+    u32 BRR;        /**< Baud Rate Register */
+    u32 CR1;        /**< Control Register 1 */
+    u32 CR2;        /**< Control Register 2 */
+    u32 CR3;        /**< Control Register 3 */
+    u32 GTPR;       /**< Guard Time and Prescaler Register */
+} USART_t;
+
+#define USART1      ((volatile USART_t*)USART1_BASE_ADDRESS)
+#define USART2      ((volatile USART_t*)USART2_BASE_ADDRESS)
+#define USART6      ((volatile USART_t*)USART6_BASE_ADDRESS)
+
+#endif /* MUSART_REGISTER_H_ */
@@ -0,0 +1,25 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : HENCODER_config.h                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef HENCODER_CONFIG_H_
+#define HENCODER_CONFIG_H_
+
+/* Number of encoders, each one takes one callback slot on two EXTI lines */
+#define HENCODERS_NUMBER                2
+
+/* Encoders pins, one entry { Port, PinA, PinB, PUPD } per encoder
+ * Two encoders must not use the same pin number (one EXTI line per pin number) */
+#define HENCODER_CONFIG_TABLE                                               \
+{                                                                           \
+    { GPIO_PORTA, GPIO_PIN00, GPIO_PIN01, GPIO_PUPD_PULL_UP },              \
+    { GPIO_PORTB, GPIO_PIN06, GPIO_PIN07, GPIO_PUPD_PULL_UP },              \
+}
+
+/* Velocity drops to zero when no edge is received for this time */
+#define HENCODER_VELOCITY_TIMEOUT_MS    100
+
+#endif /* HENCODER_CONFIG_H_ */
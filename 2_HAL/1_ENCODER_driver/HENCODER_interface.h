@@ -0,0 +1,71 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : HENCODER_interface.h             */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef HENCODER_INTERFACE_H_
+#define HENCODER_INTERFACE_H_
+
+/**
+ * @brief Pins of one quadrature encoder.
+ *        Channels A and B must be on the same port so both levels are sampled
+ *        with a single IDR read, the EXTI line of a channel is its pin number.
+ */
+typedef struct
+{
+    EN_GpioPortNo_t Port;   /**< Port of both channels */
+    EN_GpioPinNo_t  PinA;   /**< Channel A pin */
+    EN_GpioPinNo_t  PinB;   /**< Channel B pin */
+    EN_GpioPUPD_t   PUPD;   /**< Internal pull resistor of both channels */
+} HENCODER_Config_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Configures the pins, EXTI lines (ON_CHANGE) and NVIC of all the
+ *        encoders listed in HENCODER_CONFIG_TABLE and resets their counters.
+ *        The SYSCFG clock must be enabled before calling it.
+ */
+void HENCODER_voidInit(void);
+
+/**
+ * @brief Sets the free-running timestamp source used for velocity estimation.
+ * @param pfGetTime Function returning a wrapping 32-bit timestamp.
+ * @param Copy_u32TimeFreqHz Frequency of the timestamp counter in Hz.
+ */
+void HENCODER_voidSetTimeBase(u32 (*pfGetTime)(void), u32 Copy_u32TimeFreqHz);
+
+/**
+ * @brief Gets the position of an encoder in counts (4 counts per cycle).
+ * @param Copy_u8EncoderId Index of the encoder in HENCODER_CONFIG_TABLE.
+ * @return The signed position.
+ */
+s32 HENCODER_s32GetPosition(u8 Copy_u8EncoderId);
+
+/**
+ * @brief Overwrites the position of an encoder.
+ * @param Copy_u8EncoderId Index of the encoder in HENCODER_CONFIG_TABLE.
+ * @param Copy_s32Position New position in counts.
+ */
+void HENCODER_voidSetPosition(u8 Copy_u8EncoderId, s32 Copy_s32Position);
+
+/**
+ * @brief Gets the number of illegal transitions (both channels changed
+ *        between two samples, i.e. at least one edge was missed).
+ * @param Copy_u8EncoderId Index of the encoder in HENCODER_CONFIG_TABLE.
+ * @return The error count since init.
+ */
+u32 HENCODER_u32GetErrorCount(u8 Copy_u8EncoderId);
+
+/**
+ * @brief Estimates the velocity of an encoder from the timestamps of the edges
+ *        received since the previous call. Returns 0 when no time base is set
+ *        or when no edge came for HENCODER_VELOCITY_TIMEOUT_MS.
+ * @param Copy_u8EncoderId Index of the encoder in HENCODER_CONFIG_TABLE.
+ * @return The velocity in counts per second.
+ */
+s32 HENCODER_s32GetVelocity(u8 Copy_u8EncoderId);
+
+#endif /* HENCODER_INTERFACE_H_ */
@@ -0,0 +1,38 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : HENCODER_private.h               */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef HENCODER_PRIVATE_H_
+#define HENCODER_PRIVATE_H_
+
+/* Marks a transition where both channels changed in the lookup table */
+#define HENCODER_ILLEGAL            2
+
+/* Index of the lookup table: previous AB state in bits 3:2, new AB state in bits 1:0 */
+#define HENCODER_STATE_INDEX(PREV, CURR)    ( ((PREV) << 2) | (CURR) )
+
+/* EXTI ports are numbered from 0, GPIO ports from 1 */
+#define HENCODER_EXTI_PORT(GPIO_PORT)       ( (PORT_e)((GPIO_PORT) - GPIO_PORTA) )
+
+/**
+ * @brief Runtime state of one encoder, written by its interrupt.
+ */
+typedef struct
+{
+    volatile s32 Position;      /**< Position in counts */
+    volatile u32 Errors;        /**< Illegal transitions count */
+    volatile u32 Edges;         /**< Valid edges count, used to detect concurrent updates */
+    volatile u32 LastEdgeTime;  /**< Timestamp of the last valid edge */
+    EN_GpioPortNo_t Port;       /**< Port of both channels */
+    u8  State;                  /**< Last sampled AB state */
+    u8  ShiftA;                 /**< Pin number of channel A */
+    u8  ShiftB;                 /**< Pin number of channel B */
+    s32 VelocityPosition;       /**< Position at the previous velocity estimate */
+    u32 VelocityTime;           /**< Edge timestamp at the previous velocity estimate */
+    s32 Velocity;               /**< Last velocity estimate in counts per second */
+} HENCODER_State_t;
+
+#endif /* HENCODER_PRIVATE_H_ */
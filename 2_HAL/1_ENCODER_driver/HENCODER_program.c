@@ -0,0 +1,211 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : HENCODER_program.c               */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "MGPIO_interface.h"
+#include "EXTI_interface.h"
+#include "NVIC_interface.h"
+
+/****************************************************/
+/* ENCODER Directives                               */
+/****************************************************/
+#include "HENCODER_interface.h"
+#include "HENCODER_config.h"
+#include "HENCODER_private.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static const HENCODER_Config_t Global_EncoderConfig[HENCODERS_NUMBER] = HENCODER_CONFIG_TABLE;
+
+static HENCODER_State_t Global_EncoderState[HENCODERS_NUMBER];
+
+/* Timestamp source used by the velocity estimation */
+static u32 (*Global_pfGetTime)(void) = NULL;
+static u32 Global_u32TimeFreqHz = 0;
+static u32 Global_u32VelocityTimeout = 0;   // HENCODER_VELOCITY_TIMEOUT_MS in timestamp ticks
+
+/* Count step of every transition, indexed by HENCODER_STATE_INDEX(previous AB, new AB).
+ * Channel A leading B (AB: 00 -> 10 -> 11 -> 01 -> 00) counts up. */
+static const s8 Global_s8Transition[16] = {
+    /* prev 00 */  0,                -1,                +1,                HENCODER_ILLEGAL,
+    /* prev 01 */ +1,                 0,                HENCODER_ILLEGAL, -1,
+    /* prev 10 */ -1,                 HENCODER_ILLEGAL,  0,               +1,
+    /* prev 11 */  HENCODER_ILLEGAL, +1,                -1,                0,
+};
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Decodes one edge of an encoder, subscribed to the EXTI lines of both
+ *        channels with the encoder state as context.
+ *        Both channels are sampled with one IDR read then the transition is
+ *        looked up, there is no branch on the pin levels.
+ *        The two lines can have different priorities, so the handler of one
+ *        channel can preempt the other: the sample and the state update are
+ *        taken under a critical section so they stay one step.
+ * @param pvContext: State of the encoder.
+ */
+static void HENCODER_voidEdge(void *pvContext) {
+    HENCODER_State_t *Local_pState = (HENCODER_State_t *)pvContext;
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+    u16 Local_u16Port = MGPIO_u16GetPortValue(Local_pState->Port);
+    u8 Local_u8New = (u8)((GET_BIT(Local_u16Port, Local_pState->ShiftA) << 1) | GET_BIT(Local_u16Port, Local_pState->ShiftB));
+    s8 Local_s8Step = Global_s8Transition[HENCODER_STATE_INDEX(Local_pState->State, Local_u8New)];
+
+    Local_pState->State = Local_u8New;
+    if (Local_s8Step == HENCODER_ILLEGAL) {
+        Local_pState->Errors++;
+    } else if (Local_s8Step != 0) {
+        Local_pState->Position += Local_s8Step;
+        if (Global_pfGetTime != NULL) {
+            Local_pState->LastEdgeTime = Global_pfGetTime();
+        }
+        Local_pState->Edges++;
+    }
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+void HENCODER_voidInit(void) {
+    u8 Local_u8Id;
+
+    for (Local_u8Id = 0; Local_u8Id < HENCODERS_NUMBER; Local_u8Id++) {
+        const HENCODER_Config_t *Local_pConfig = &Global_EncoderConfig[Local_u8Id];
+        HENCODER_State_t *Local_pState = &Global_EncoderState[Local_u8Id];
+        u16 Local_u16Lines = EXTI_LINE_MASK(Local_pConfig->PinA) | EXTI_LINE_MASK(Local_pConfig->PinB);
+        u16 Local_u16Port;
+
+        MGPIO_voidSetPinInput(Local_pConfig->Port, Local_pConfig->PinA, Local_pConfig->PUPD);
+        MGPIO_voidSetPinInput(Local_pConfig->Port, Local_pConfig->PinB, Local_pConfig->PUPD);
+
+        Local_pState->Port = Local_pConfig->Port;
+        Local_pState->ShiftA = Local_pConfig->PinA;
+        Local_pState->ShiftB = Local_pConfig->PinB;
+        Local_pState->Position = 0;
+        Local_pState->Errors = 0;
+        Local_pState->Edges = 0;
+        Local_pState->Velocity = 0;
+        Local_pState->VelocityPosition = 0;
+
+        // Start from the current levels so the first edge decodes correctly
+        Local_u16Port = MGPIO_u16GetPortValue(Local_pConfig->Port);
+        Local_pState->State = (u8)((GET_BIT(Local_u16Port, Local_pState->ShiftA) << 1) | GET_BIT(Local_u16Port, Local_pState->ShiftB));
+
+        MEXTI_u8Subscribe((Line_e)Local_pConfig->PinA, HENCODER_voidEdge, Local_pState);
+        MEXTI_u8Subscribe((Line_e)Local_pConfig->PinB, HENCODER_voidEdge, Local_pState);
+        MEXTI_voidConfigLinesMask(Local_u16Lines, HENCODER_EXTI_PORT(Local_pConfig->Port), ON_CHANGE, ENABLED, DISABLED);
+
+        MNVIC_voidSetEnablePeripheralInterrupt(EXTI_LINE_IRQ_NUMBER(Local_pConfig->PinA));
+        MNVIC_voidSetEnablePeripheralInterrupt(EXTI_LINE_IRQ_NUMBER(Local_pConfig->PinB));
+    }
+}
+
+void HENCODER_voidSetTimeBase(u32 (*pfGetTime)(void), u32 Copy_u32TimeFreqHz) {
+    u8 Local_u8Id;
+
+    Global_pfGetTime = NULL;
+    Global_u32TimeFreqHz = Copy_u32TimeFreqHz;
+    Global_u32VelocityTimeout = (Copy_u32TimeFreqHz / 1000UL) * HENCODER_VELOCITY_TIMEOUT_MS;
+
+    if (pfGetTime != NULL) {
+        u32 Local_u32Now = pfGetTime();
+        for (Local_u8Id = 0; Local_u8Id < HENCODERS_NUMBER; Local_u8Id++) {
+            Global_EncoderState[Local_u8Id].LastEdgeTime = Local_u32Now;
+            Global_EncoderState[Local_u8Id].VelocityTime = Local_u32Now;
+            Global_EncoderState[Local_u8Id].VelocityPosition = Global_EncoderState[Local_u8Id].Position;
+        }
+    }
+    Global_pfGetTime = pfGetTime;
+}
+
+s32 HENCODER_s32GetPosition(u8 Copy_u8EncoderId) {
+    s32 Local_s32Position = 0;
+
+    if (Copy_u8EncoderId < HENCODERS_NUMBER) {
+        Local_s32Position = Global_EncoderState[Copy_u8EncoderId].Position;
+    }
+    return Local_s32Position;
+}
+
+void HENCODER_voidSetPosition(u8 Copy_u8EncoderId, s32 Copy_s32Position) {
+    if (Copy_u8EncoderId < HENCODERS_NUMBER) {
+        const HENCODER_Config_t *Local_pConfig = &Global_EncoderConfig[Copy_u8EncoderId];
+        u16 Local_u16Lines = EXTI_LINE_MASK(Local_pConfig->PinA) | EXTI_LINE_MASK(Local_pConfig->PinB);
+        u32 Local_u32State;
+
+        // Keep the encoder interrupt out while the position is replaced,
+        // an edge arriving meanwhile stays pending and is decoded afterwards.
+        // Only the lines unmasked now are unmasked again: a line throttled
+        // by the storm protection stays masked until its holdoff ends.
+        Local_u32State = MNVIC_u32DisableInterrupts();
+        Local_u16Lines &= MEXTI_u16GetInterruptMask();
+        MEXTI_voidDisableInterruptMask(Local_u16Lines);
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        Global_EncoderState[Copy_u8EncoderId].VelocityPosition += Copy_s32Position - Global_EncoderState[Copy_u8EncoderId].Position;
+        Global_EncoderState[Copy_u8EncoderId].Position = Copy_s32Position;
+        MEXTI_voidEnableInterruptMask(Local_u16Lines);
+    }
+}
+
+u32 HENCODER_u32GetErrorCount(u8 Copy_u8EncoderId) {
+    u32 Local_u32Errors = 0;
+
+    if (Copy_u8EncoderId < HENCODERS_NUMBER) {
+        Local_u32Errors = Global_EncoderState[Copy_u8EncoderId].Errors;
+    }
+    return Local_u32Errors;
+}
+
+s32 HENCODER_s32GetVelocity(u8 Copy_u8EncoderId) {
+    HENCODER_State_t *Local_pState;
+    u32 Local_u32Edges, Local_u32EdgeTime;
+    s32 Local_s32Position;
+
+    if ((Copy_u8EncoderId >= HENCODERS_NUMBER) || (Global_pfGetTime == NULL)) {
+        return 0;
+    }
+    Local_pState = &Global_EncoderState[Copy_u8EncoderId];
+
+    // Take a consistent (position, timestamp) pair, retry if an edge came in between
+    do {
+        Local_u32Edges = Local_pState->Edges;
+        Local_s32Position = Local_pState->Position;
+        Local_u32EdgeTime = Local_pState->LastEdgeTime;
+    } while (Local_u32Edges != Local_pState->Edges);
+
+    if (Local_s32Position != Local_pState->VelocityPosition) {
+        // Counts over the time between the last edges of two estimates,
+        // unsigned subtraction keeps the interval right across timestamp wrap
+        u32 Local_u32Interval = Local_u32EdgeTime - Local_pState->VelocityTime;
+        if (Local_u32Interval != 0) {
+            Local_pState->Velocity = (s32)(((s64)(Local_s32Position - Local_pState->VelocityPosition) * (s64)Global_u32TimeFreqHz)
+                                           / (s64)Local_u32Interval);
+        }
+        Local_pState->VelocityPosition = Local_s32Position;
+        Local_pState->VelocityTime = Local_u32EdgeTime;
+    } else if ((u32)(Global_pfGetTime() - Local_u32EdgeTime) > Global_u32VelocityTimeout) {
+        Local_pState->Velocity = 0;
+        Local_pState->VelocityTime = Local_u32EdgeTime;
+    }
+
+    return Local_pState->Velocity;
+}
@@ -0,0 +1,299 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : HENCODER_test.c                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the encoder HAL, built with the Makefile next to it.
+ *
+ * The HAL is compiled in with the GPIO, EXTI and NVIC drivers stubbed: the
+ * port levels are plain memory and an edge is a direct call of the handler
+ * subscribed to the line of the pin that moved. What runs on the host is:
+ * - the decode table, every (previous, new) pair against the Gray code order;
+ * - counting over full cycles both ways and over a random walk, with the
+ *   illegal jumps counted as errors and leaving the position alone;
+ * - SetPosition, which must keep counting from the new value and unmask only
+ *   the lines that were unmasked;
+ * - the velocity estimate and its timeout;
+ * - the port being sampled inside the critical section of the handler. */
+
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+#include "MGPIO_interface.h"
+#include "EXTI_interface.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HENCODER_program.c"
+
+/****************************************************/
+/* STUBS                                            */
+/****************************************************/
+static u16 Host_u16Port[8];                     // IDR of each GPIO port
+static CallBackFn_t Host_pfHandler[16];         // subscribed handler of each EXTI line
+static void *Host_pvContext[16];
+static u16 Host_u16Imr = 0;                     // EXTI interrupt mask
+static u32 Host_u32Masked = 0;                  // critical section depth
+static u32 Host_u32UnmaskedReads = 0;           // port samples taken outside a critical section
+static u32 Host_u32Time = 0;                    // timestamp source
+
+void MGPIO_voidSetPinInput(EN_GpioPortNo_t PortNo, EN_GpioPinNo_t PinNo, EN_GpioPUPD_t PUPD) {
+    (void)PortNo;
+    (void)PinNo;
+    (void)PUPD;
+}
+
+u16 MGPIO_u16GetPortValue(EN_GpioPortNo_t PortNo) {
+    if (Host_u32Masked == 0) {
+        Host_u32UnmaskedReads++;
+    }
+    return Host_u16Port[PortNo];
+}
+
+u8 MEXTI_u8Subscribe(Line_e Copy_line, CallBackFn_t pfHandler, void *pvContext) {
+    Host_pfHandler[Copy_line] = pfHandler;
+    Host_pvContext[Copy_line] = pvContext;
+    return STD_OK;
+}
+
+void MEXTI_voidConfigLinesMask(u16 Copy_u16LinesMask, PORT_e Copy_port, Trigger_t Copy_edge,
+                               Mode_t Copy_interrupt, Mode_t Copy_event) {
+    (void)Copy_port;
+    (void)Copy_edge;
+    (void)Copy_event;
+    if (Copy_interrupt == ENABLED) {
+        Host_u16Imr |= Copy_u16LinesMask;
+    }
+}
+
+void MEXTI_voidEnableInterruptMask(u16 Copy_u16LinesMask) {
+    Host_u16Imr |= Copy_u16LinesMask;
+}
+
+void MEXTI_voidDisableInterruptMask(u16 Copy_u16LinesMask) {
+    Host_u16Imr &= (u16)~Copy_u16LinesMask;
+}
+
+u16 MEXTI_u16GetInterruptMask(void) {
+    return Host_u16Imr;
+}
+
+void MNVIC_voidSetEnablePeripheralInterrupt(u8 Copy_u8IDX) {
+    (void)Copy_u8IDX;
+}
+
+u32 MNVIC_u32DisableInterrupts(void) {
+    Host_u32Masked++;
+    return 0;
+}
+
+void MNVIC_voidRestoreInterrupts(u32 Copy_u32State) {
+    (void)Copy_u32State;
+    Host_u32Masked--;
+}
+
+static u32 Host_u32GetTime(void) {
+    return Host_u32Time;
+}
+
+/****************************************************/
+/* HELPERS                                          */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static const HENCODER_Config_t Global_Config[HENCODERS_NUMBER] = HENCODER_CONFIG_TABLE;
+
+/* Position of each AB state along a cycle with A leading: 00 -> 10 -> 11 -> 01 */
+static const u8 Global_u8Gray[4] = { 0, 3, 1, 2 };
+
+/* Drives the pins of an encoder to AB, then raises the line of a pin that moved */
+static void Host_voidMove(u8 Copy_u8Id, u8 Copy_u8AB) {
+    const HENCODER_Config_t *Local_pConfig = &Global_Config[Copy_u8Id];
+    u16 Local_u16Old = Host_u16Port[Local_pConfig->Port];
+    u16 Local_u16New = Local_u16Old;
+    u8 Local_u8Line;
+
+    Local_u16New = (u16)((Local_u16New & ~(1U << Local_pConfig->PinA)) | ((u32)GET_BIT(Copy_u8AB, 1) << Local_pConfig->PinA));
+    Local_u16New = (u16)((Local_u16New & ~(1U << Local_pConfig->PinB)) | ((u32)GET_BIT(Copy_u8AB, 0) << Local_pConfig->PinB));
+    Host_u16Port[Local_pConfig->Port] = Local_u16New;
+
+    Local_u8Line = (GET_BIT(Local_u16Old ^ Local_u16New, Local_pConfig->PinA) != 0) ? Local_pConfig->PinA : Local_pConfig->PinB;
+    Host_pfHandler[Local_u8Line](Host_pvContext[Local_u8Line]);
+}
+
+static u8 Host_u8GetAB(u8 Copy_u8Id) {
+    const HENCODER_Config_t *Local_pConfig = &Global_Config[Copy_u8Id];
+    u16 Local_u16Port = Host_u16Port[Local_pConfig->Port];
+
+    return (u8)((GET_BIT(Local_u16Port, Local_pConfig->PinA) << 1) | GET_BIT(Local_u16Port, Local_pConfig->PinB));
+}
+
+/****************************************************/
+/* TESTS                                            */
+/****************************************************/
+
+static void Test_voidTable(void) {
+    u8 Local_u8Prev, Local_u8New;
+    s32 Local_s32Position;
+    u32 Local_u32Errors;
+    u8 Local_u8Distance;
+
+    for (Local_u8Prev = 0; Local_u8Prev < 4; Local_u8Prev++) {
+        for (Local_u8New = 0; Local_u8New < 4; Local_u8New++) {
+            if (Local_u8New == Local_u8Prev) {
+                continue;
+            }
+            Host_voidMove(0, Local_u8Prev);
+            Local_s32Position = HENCODER_s32GetPosition(0);
+            Local_u32Errors = HENCODER_u32GetErrorCount(0);
+            Host_voidMove(0, Local_u8New);
+
+            Local_u8Distance = (u8)((Global_u8Gray[Local_u8New] - Global_u8Gray[Local_u8Prev]) & 3U);
+            if (Local_u8Distance == 2) {
+                CHECK((HENCODER_s32GetPosition(0) == Local_s32Position) && (HENCODER_u32GetErrorCount(0) == (Local_u32Errors + 1)),
+                      "%u -> %u must count one error", Local_u8Prev, Local_u8New);
+            } else {
+                CHECK((HENCODER_s32GetPosition(0) == (Local_s32Position + ((Local_u8Distance == 1) ? 1 : -1)))
+                      && (HENCODER_u32GetErrorCount(0) == Local_u32Errors),
+                      "%u -> %u must count %d", Local_u8Prev, Local_u8New, (Local_u8Distance == 1) ? 1 : -1);
+            }
+        }
+    }
+}
+
+static void Test_voidCycles(void) {
+    static const u8 Local_u8Forward[4] = { 2, 3, 1, 0 };   // 10, 11, 01, 00
+    s32 Local_s32Start;
+    u32 Local_u32Errors = HENCODER_u32GetErrorCount(1);
+    u32 Local_u32Cycle;
+    s8 Local_s8Step;
+
+    Host_voidMove(1, 1);
+    Host_voidMove(1, 0);
+    Local_s32Start = HENCODER_s32GetPosition(1);
+
+    for (Local_u32Cycle = 0; Local_u32Cycle < 100; Local_u32Cycle++) {
+        for (Local_s8Step = 0; Local_s8Step < 4; Local_s8Step++) {
+            Host_voidMove(1, Local_u8Forward[Local_s8Step]);
+        }
+    }
+    CHECK(HENCODER_s32GetPosition(1) == (Local_s32Start + 400), "100 cycles forward: %ld", (long)(HENCODER_s32GetPosition(1) - Local_s32Start));
+
+    for (Local_u32Cycle = 0; Local_u32Cycle < 150; Local_u32Cycle++) {
+        for (Local_s8Step = 3; Local_s8Step >= 0; Local_s8Step--) {
+            Host_voidMove(1, Local_u8Forward[(Local_s8Step + 3) & 3]);
+        }
+    }
+    CHECK(HENCODER_s32GetPosition(1) == (Local_s32Start - 200), "150 cycles back: %ld", (long)(HENCODER_s32GetPosition(1) - Local_s32Start));
+    CHECK(HENCODER_u32GetErrorCount(1) == Local_u32Errors, "errors while counting cycles");
+    CHECK(Host_u32UnmaskedReads == 0, "%lu samples outside the critical section", (unsigned long)Host_u32UnmaskedReads);
+}
+
+static void Test_voidRandomWalk(void) {
+    s32 Local_s32Expected = HENCODER_s32GetPosition(0);
+    u32 Local_u32Errors = HENCODER_u32GetErrorCount(0);
+    u32 Local_u32ExpectedErrors = Local_u32Errors;
+    u32 Local_u32Step;
+    u8 Local_u8Now, Local_u8Next, Local_u8Distance;
+
+    for (Local_u32Step = 0; Local_u32Step < 100000; Local_u32Step++) {
+        Local_u8Now = Host_u8GetAB(0);
+        // Mostly single channel moves, one in 64 is a missed edge
+        Local_u8Next = ((rand() % 64) == 0) ? (u8)(Local_u8Now ^ 3U) : (u8)(Local_u8Now ^ (1U << (rand() & 1)));
+        Local_u8Distance = (u8)((Global_u8Gray[Local_u8Next] - Global_u8Gray[Local_u8Now]) & 3U);
+        if (Local_u8Distance == 1) {
+            Local_s32Expected++;
+        } else if (Local_u8Distance == 3) {
+            Local_s32Expected--;
+        } else {
+            Local_u32ExpectedErrors++;
+        }
+        Host_voidMove(0, Local_u8Next);
+    }
+    CHECK(HENCODER_s32GetPosition(0) == Local_s32Expected, "random walk: %ld instead of %ld",
+          (long)HENCODER_s32GetPosition(0), (long)Local_s32Expected);
+    CHECK(HENCODER_u32GetErrorCount(0) == Local_u32ExpectedErrors, "random walk: %lu errors instead of %lu",
+          (unsigned long)HENCODER_u32GetErrorCount(0), (unsigned long)Local_u32ExpectedErrors);
+}
+
+static void Test_voidSetPosition(void) {
+    const HENCODER_Config_t *Local_pConfig = &Global_Config[0];
+    u16 Local_u16Lines = EXTI_LINE_MASK(Local_pConfig->PinA) | EXTI_LINE_MASK(Local_pConfig->PinB);
+
+    HENCODER_voidSetPosition(0, -1000);
+    CHECK(HENCODER_s32GetPosition(0) == -1000, "position not replaced");
+    CHECK((Host_u16Imr & Local_u16Lines) == Local_u16Lines, "lines left masked");
+
+    Host_voidMove(0, (u8)(Host_u8GetAB(0) ^ ((Global_u8Gray[Host_u8GetAB(0)] & 1U) ? 1U : 2U)));
+    CHECK((HENCODER_s32GetPosition(0) == -999) || (HENCODER_s32GetPosition(0) == -1001), "no count after the new position");
+
+    // A line throttled meanwhile stays masked
+    MEXTI_voidDisableInterruptMask(EXTI_LINE_MASK(Local_pConfig->PinB));
+    HENCODER_voidSetPosition(0, 0);
+    CHECK((Host_u16Imr & Local_u16Lines) == EXTI_LINE_MASK(Local_pConfig->PinA), "throttled line unmasked");
+    MEXTI_voidEnableInterruptMask(Local_u16Lines);
+
+    CHECK(HENCODER_s32GetPosition(HENCODERS_NUMBER) == 0, "position of a missing encoder");
+}
+
+static void Test_voidVelocity(void) {
+    static const u8 Local_u8Forward[4] = { 2, 3, 1, 0 };
+    u32 Local_u32Edge;
+    u32 Local_u32LastEdge;
+    u8 Local_u8Phase;
+
+    CHECK(HENCODER_s32GetVelocity(0) == 0, "velocity without a time base");
+
+    // Start the walk from 00 so the forward table applies
+    Host_voidMove(0, 1);
+    Host_voidMove(0, 0);
+    Host_u32Time = 1000;
+    HENCODER_voidSetTimeBase(Host_u32GetTime, 1000000UL);
+
+    // 10 counts forward, one every 100 us
+    for (Local_u32Edge = 0; Local_u32Edge < 10; Local_u32Edge++) {
+        Host_u32Time += 100;
+        Local_u8Phase = (u8)(Local_u32Edge & 3U);
+        Host_voidMove(0, Local_u8Forward[Local_u8Phase]);
+    }
+    CHECK(HENCODER_s32GetVelocity(0) == 10000, "forward velocity %ld", (long)HENCODER_s32GetVelocity(0));
+    Local_u32LastEdge = Host_u32Time;
+
+    // Unchanged until the timeout, then zero
+    Host_u32Time += (HENCODER_VELOCITY_TIMEOUT_MS * 1000UL) / 2;
+    CHECK(HENCODER_s32GetVelocity(0) == 10000, "velocity dropped before the timeout");
+    Host_u32Time += HENCODER_VELOCITY_TIMEOUT_MS * 1000UL;
+    CHECK(HENCODER_s32GetVelocity(0) == 0, "velocity kept after the timeout");
+
+    // 2 counts back, measured from the last edge before the stop
+    Host_u32Time += 500;
+    Host_voidMove(0, Local_u8Forward[(Local_u8Phase + 3) & 3]);
+    Host_u32Time += 500;
+    Host_voidMove(0, Local_u8Forward[(Local_u8Phase + 2) & 3]);
+    CHECK(HENCODER_s32GetVelocity(0) == (s32)((-2 * 1000000L) / (s32)(Host_u32Time - Local_u32LastEdge)),
+          "backward velocity %ld", (long)HENCODER_s32GetVelocity(0));
+
+    // Then between consecutive estimates: 1 count back over 250 us
+    Host_u32Time += 250;
+    Host_voidMove(0, Local_u8Forward[(Local_u8Phase + 1) & 3]);
+    CHECK(HENCODER_s32GetVelocity(0) == -4000, "backward velocity %ld", (long)HENCODER_s32GetVelocity(0));
+}
+
+int main(void) {
+    HENCODER_voidInit();
+    Host_u32UnmaskedReads = 0;
+
+    Test_voidTable();
+    Test_voidCycles();
+    Test_voidRandomWalk();
+    Test_voidSetPosition();
+    Test_voidVelocity();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
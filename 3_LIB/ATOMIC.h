@@ -0,0 +1,293 @@
+#ifndef _ATOMIC_H_
+#define _ATOMIC_H_
+
+/* Lock-free access to words shared between ISRs and thread code.
+ * On the Cortex-M4 the read-modify-write operations are LDREX/STREX loops:
+ * an exception taken between the two clears the exclusive monitor, the
+ * STREX fails and the loop retries, so no interrupt is ever disabled.
+ * The host build (unit tests on a PC) uses the GCC __atomic builtins.
+ *
+ * On the target every operation is a full compiler barrier: accesses before
+ * it are done before it and accesses after it are not moved ahead. The
+ * target is a single core, so that also orders them against any ISR.
+ * On the host the loads are acquire and the stores release, which costs no
+ * fence on x86, and the read-modify-writes are sequentially consistent.
+ *
+ * On top of the words:
+ * ST_EventFlags_t  a group of event bits set by any context and taken,
+ *                  test-and-clear, by the waiter.
+ * ST_SeqCount_t    sequence counter letting readers take a consistent copy
+ *                  of data larger than a word (ST_SeqU64_t for 64-bit values)
+ *                  without blocking the writer. */
+
+#if defined(__arm__)
+#define ATOMIC_FENCE()		__atomic_signal_fence(__ATOMIC_SEQ_CST)
+#else
+#define ATOMIC_FENCE()		__atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+typedef struct {
+	volatile u32 Flags;
+} ST_EventFlags_t;
+
+typedef struct {
+	volatile u32 Sequence;	/* odd while a write is in progress */
+} ST_SeqCount_t;
+
+typedef struct {
+	ST_SeqCount_t Seq;
+	volatile u32  Low;
+	volatile u32  High;
+} ST_SeqU64_t;
+
+#define ATOMIC_EVENT_FLAGS_INIT		{ 0 }
+#define ATOMIC_SEQ_U64_INIT			{ { 0 }, 0, 0 }
+
+
+/****************************************************/
+/* Words                                            */
+/****************************************************/
+
+#if defined(__arm__)
+
+/* Aligned word loads and stores are single accesses, only the ordering matters */
+static inline u32 ATOMIC_u32Load(const volatile u32 *Ptr) {
+	u32 Local_u32Value;
+
+	ATOMIC_FENCE();
+	Local_u32Value = *Ptr;
+	ATOMIC_FENCE();
+	return Local_u32Value;
+}
+
+static inline void ATOMIC_voidStore(volatile u32 *Ptr, u32 Value) {
+	ATOMIC_FENCE();
+	*Ptr = Value;
+	ATOMIC_FENCE();
+}
+
+static inline void *ATOMIC_pvLoad(void *const volatile *Ptr) {
+	void *Local_pvValue;
+
+	ATOMIC_FENCE();
+	Local_pvValue = *Ptr;
+	ATOMIC_FENCE();
+	return Local_pvValue;
+}
+
+static inline void ATOMIC_voidStorePtr(void *volatile *Ptr, void *Value) {
+	ATOMIC_FENCE();
+	*Ptr = Value;
+	ATOMIC_FENCE();
+}
+
+static inline u32 ATOMIC_u32LoadExclusive(volatile u32 *Ptr) {
+	u32 Local_u32Value;
+
+	__asm__ volatile ("ldrex %0, [%1]" : "=r" (Local_u32Value) : "r" (Ptr) : "memory");
+	return Local_u32Value;
+}
+
+/* Returns 0 if the store happened, 1 if the reservation was lost */
+static inline u32 ATOMIC_u32StoreExclusive(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Failed;
+
+	__asm__ volatile ("strex %0, %2, [%1]" : "=&r" (Local_u32Failed) : "r" (Ptr), "r" (Value) : "memory");
+	return Local_u32Failed;
+}
+
+/* Read-modify-write loop: OLD receives the value the word held, NEW_VALUE
+ * is computed from it and stored if no exception ran in between */
+#define ATOMIC_RMW(PTR, OLD, NEW_VALUE) \
+	do { \
+		(OLD) = ATOMIC_u32LoadExclusive(PTR); \
+	} while (ATOMIC_u32StoreExclusive(PTR, (NEW_VALUE)) != 0)
+
+/* Stores Desired if the word equals *Expected and returns TRUE,
+ * otherwise copies the word into *Expected and returns FALSE */
+static inline u8 ATOMIC_u8CompareExchange(volatile u32 *Ptr, u32 *Expected, u32 Desired) {
+	u32 Local_u32Old;
+
+	do {
+		Local_u32Old = ATOMIC_u32LoadExclusive(Ptr);
+		if (Local_u32Old != *Expected) {
+			__asm__ volatile ("clrex" : : : "memory");
+			*Expected = Local_u32Old;
+			return FALSE;
+		}
+	} while (ATOMIC_u32StoreExclusive(Ptr, Desired) != 0);
+	return TRUE;
+}
+
+/* Pointers are words on the target */
+static inline void *ATOMIC_pvExchange(void *volatile *Ptr, void *Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW((volatile u32 *)Ptr, Local_u32Old, (u32)Value);
+	return (void *)Local_u32Old;
+}
+
+#else
+
+static inline u32 ATOMIC_u32Load(const volatile u32 *Ptr) {
+	return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void ATOMIC_voidStore(volatile u32 *Ptr, u32 Value) {
+	__atomic_store_n(Ptr, Value, __ATOMIC_RELEASE);
+}
+
+static inline void *ATOMIC_pvLoad(void *const volatile *Ptr) {
+	return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void ATOMIC_voidStorePtr(void *volatile *Ptr, void *Value) {
+	__atomic_store_n(Ptr, Value, __ATOMIC_RELEASE);
+}
+
+/* Compare-and-swap loop with the same shape as the target one. u32 may be
+ * wider than 32 bits on the host: the new value is wrapped to 32 bits so
+ * the word holds what the target would */
+#define ATOMIC_RMW(PTR, OLD, NEW_VALUE) \
+	do { \
+		(OLD) = __atomic_load_n(PTR, __ATOMIC_RELAXED); \
+	} while (!__atomic_compare_exchange_n(PTR, &(OLD), (NEW_VALUE) & 0xFFFFFFFFUL, 1, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+
+static inline u8 ATOMIC_u8CompareExchange(volatile u32 *Ptr, u32 *Expected, u32 Desired) {
+	return __atomic_compare_exchange_n(Ptr, Expected, Desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? TRUE : FALSE;
+}
+
+static inline void *ATOMIC_pvExchange(void *volatile *Ptr, void *Value) {
+	return __atomic_exchange_n(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+#endif
+
+/* Each returns the value the word held before */
+static inline u32 ATOMIC_u32FetchAdd(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW(Ptr, Local_u32Old, Local_u32Old + Value);
+	return Local_u32Old;
+}
+
+static inline u32 ATOMIC_u32FetchSub(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW(Ptr, Local_u32Old, Local_u32Old - Value);
+	return Local_u32Old;
+}
+
+static inline u32 ATOMIC_u32FetchOr(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW(Ptr, Local_u32Old, Local_u32Old | Value);
+	return Local_u32Old;
+}
+
+static inline u32 ATOMIC_u32FetchAnd(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW(Ptr, Local_u32Old, Local_u32Old & Value);
+	return Local_u32Old;
+}
+
+static inline u32 ATOMIC_u32Exchange(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old;
+
+	ATOMIC_RMW(Ptr, Local_u32Old, Value);
+	return Local_u32Old;
+}
+
+/* Raises the word to Value if it is lower, returns the resulting maximum */
+static inline u32 ATOMIC_u32Max(volatile u32 *Ptr, u32 Value) {
+	u32 Local_u32Old = ATOMIC_u32Load(Ptr);
+
+	while ((Value > Local_u32Old) && (ATOMIC_u8CompareExchange(Ptr, &Local_u32Old, Value) == FALSE)) {
+	}
+	return (Value > Local_u32Old) ? Value : Local_u32Old;
+}
+
+
+/****************************************************/
+/* Event flags                                      */
+/****************************************************/
+
+static inline void ATOMIC_voidFlagsSet(ST_EventFlags_t *Group, u32 Mask) {
+	(void)ATOMIC_u32FetchOr(&Group->Flags, Mask);
+}
+
+static inline void ATOMIC_voidFlagsClear(ST_EventFlags_t *Group, u32 Mask) {
+	(void)ATOMIC_u32FetchAnd(&Group->Flags, ~Mask);
+}
+
+static inline u32 ATOMIC_u32FlagsGet(const ST_EventFlags_t *Group) {
+	return ATOMIC_u32Load(&Group->Flags);
+}
+
+/* Clears the flags of Mask and returns those of them that were set */
+static inline u32 ATOMIC_u32FlagsTakeAny(ST_EventFlags_t *Group, u32 Mask) {
+	return ATOMIC_u32FetchAnd(&Group->Flags, ~Mask) & Mask;
+}
+
+/* Clears the flags of Mask only if all of them are set, returns TRUE if so */
+static inline u8 ATOMIC_u8FlagsTakeAll(ST_EventFlags_t *Group, u32 Mask) {
+	u32 Local_u32Flags = ATOMIC_u32Load(&Group->Flags);
+
+	while ((Local_u32Flags & Mask) == Mask) {
+		if (ATOMIC_u8CompareExchange(&Group->Flags, &Local_u32Flags, Local_u32Flags & ~Mask) == TRUE) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+
+/****************************************************/
+/* Sequence counters                                */
+/****************************************************/
+
+/* One writer at a time, and readers must not preempt it: a reader running
+ * above the writer's priority would retry forever. Write from the ISR and
+ * read from thread code (or lower priority ISRs), not the other way round.
+ * The fences keep the data accesses inside the odd window: a release store
+ * alone would let the data stores move ahead of the odd sequence, and an
+ * acquire load alone would let the data loads move after the re-check */
+static inline void ATOMIC_voidSeqWriteBegin(ST_SeqCount_t *Seq) {
+	ATOMIC_voidStore(&Seq->Sequence, (Seq->Sequence + 1) & 0xFFFFFFFFUL);
+	ATOMIC_FENCE();
+}
+
+static inline void ATOMIC_voidSeqWriteEnd(ST_SeqCount_t *Seq) {
+	ATOMIC_voidStore(&Seq->Sequence, (Seq->Sequence + 1) & 0xFFFFFFFFUL);
+}
+
+/* Reader: copy the data between Begin and Retry, start over while Retry is TRUE */
+static inline u32 ATOMIC_u32SeqReadBegin(const ST_SeqCount_t *Seq) {
+	return ATOMIC_u32Load(&Seq->Sequence);
+}
+
+static inline u8 ATOMIC_u8SeqReadRetry(const ST_SeqCount_t *Seq, u32 Begin) {
+	ATOMIC_FENCE();
+	return (((Begin & 1UL) != 0) || (ATOMIC_u32Load(&Seq->Sequence) != Begin)) ? TRUE : FALSE;
+}
+
+static inline void ATOMIC_voidSeqStore64(ST_SeqU64_t *Value, u64 Data) {
+	ATOMIC_voidSeqWriteBegin(&Value->Seq);
+	Value->Low = (u32)(Data & 0xFFFFFFFFUL);
+	Value->High = (u32)(Data >> 32);
+	ATOMIC_voidSeqWriteEnd(&Value->Seq);
+}
+
+static inline u64 ATOMIC_u64SeqLoad64(const ST_SeqU64_t *Value) {
+	u32 Local_u32Begin, Local_u32Low, Local_u32High;
+
+	do {
+		Local_u32Begin = ATOMIC_u32SeqReadBegin(&Value->Seq);
+		Local_u32Low = Value->Low;
+		Local_u32High = Value->High;
+	} while (ATOMIC_u8SeqReadRetry(&Value->Seq, Local_u32Begin) == TRUE);
+	return ((u64)Local_u32High << 32) | Local_u32Low;
+}
+
+#endif
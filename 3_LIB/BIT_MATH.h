@@ -23,5 +23,29 @@
 #define WRT_GROUP_OF_BITS(REG, START_BIT_NO, VAL, BITS_GROUP)	( (REG) = ( (REG) & ~( (BITS_GROUP) << (START_BIT_NO) ) ) | ( (VAL) << (START_BIT_NO) ) )
 
 
+
+/* Bit-banding (Cortex-M4)
+ * Every bit of the SRAM (0x20000000 - 0x200FFFFF) and peripheral (0x40000000 - 0x400FFFFF)
+ * regions has a word alias at BASE + 0x02000000 + (OFFSET * 32) + (BIT * 4).
+ * Storing 0 or 1 to the alias writes that bit alone in one bus access, and a load
+ * returns it as 0 or 1, so single bits can be changed without a read-modify-write
+ * that an interrupt could split. Not available for the private peripheral bus
+ * (NVIC, SCB, SysTick at 0xE0000000): use the set/clear registers there.
+ * ADDR ==> address of the register or variable (e.g. &EXTI->IMR)
+ * Reg  ==> the register itself, as for SET_BIT */
+#define BITBAND_ALIAS(ADDR, BITNUM)		( ((u32)(ADDR) & 0xF0000000UL) + 0x02000000UL + (((u32)(ADDR) & 0x000FFFFFUL) << 5) + ((u32)(BITNUM) << 2) )
+
+#define BITBAND(ADDR, BITNUM)			( *(volatile u32 *)BITBAND_ALIAS(ADDR, BITNUM) )
+
+#define BITBAND_SET_BIT(Reg, bitnum)	( BITBAND(&(Reg), bitnum) = 1 )
+
+#define BITBAND_CLR_BIT(Reg, bitnum)	( BITBAND(&(Reg), bitnum) = 0 )
+
+#define BITBAND_GET_BIT(Reg, bitnum)	( BITBAND(&(Reg), bitnum) )
+
+/* Read then write of the alias: the other bits of the register are never written */
+#define BITBAND_TOGGLE_BIT(Reg, bitnum)	( BITBAND(&(Reg), bitnum) ^= 1 )
+
+
  
 #endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+
+#ifndef _CALLBACK_H_
+#define _CALLBACK_H_
+
+/* Callback carrying a context pointer, so one handler serves many instances.
+ * Tables of callbacks are kept dense: entries [0, Count) are valid and are
+ * invoked in subscription order.
+ * Add writes the entry before publishing the new count, so a table can grow
+ * while the interrupt using it is live. Remove compacts the table and must
+ * be called with that interrupt disabled or masked. */
+
+typedef void (*CallBackFn_t)(void *pvContext);
+
+typedef struct {
+	CallBackFn_t pfHandler;
+	void *       pvContext;
+} ST_CallBack_t;
+
+
+/* Holder of a bare void (*)(void) for the legacy registration APIs.
+ * ISO C has no conversion between function and object pointers, so the
+ * context of the trampoline is the holder, not the function itself */
+typedef struct {
+	void (*pfBare)(void);
+} ST_BareCallBack_t;
+
+/* Trampoline running the function of the ST_BareCallBack_t given as context */
+static inline void CALLBACK_voidBare(void *pvContext) {
+	((const ST_BareCallBack_t *)pvContext)->pfBare();
+}
+
+/* Appends a callback to a table, an identical entry is not added twice
+ * Returns STD_OK, or STD_NOK if the table is full or the handler is NULL */
+static inline u8 CALLBACK_u8Add(ST_CallBack_t *Table, volatile u8 *Count, u8 MaxCount,
+                                CallBackFn_t pfHandler, void *pvContext) {
+	u8 Local_u8Idx;
+
+	if (pfHandler == NULL) {
+		return STD_NOK;
+	}
+	for (Local_u8Idx = 0; Local_u8Idx < *Count; Local_u8Idx++) {
+		if ((Table[Local_u8Idx].pfHandler == pfHandler) && (Table[Local_u8Idx].pvContext == pvContext)) {
+			return STD_OK;
+		}
+	}
+	if (*Count >= MaxCount) {
+		return STD_NOK;
+	}
+	Table[*Count].pfHandler = pfHandler;
+	Table[*Count].pvContext = pvContext;
+	__asm__ volatile ("" ::: "memory");	/* entry is complete before it is published */
+	(*Count)++;
+	return STD_OK;
+}
+
+/* Removes a callback from a table, the following entries move down one slot
+ * Returns STD_OK, or STD_NOK if the entry was not found */
+static inline u8 CALLBACK_u8Remove(ST_CallBack_t *Table, volatile u8 *Count,
+                                   CallBackFn_t pfHandler, void *pvContext) {
+	u8 Local_u8Idx;
+
+	for (Local_u8Idx = 0; Local_u8Idx < *Count; Local_u8Idx++) {
+		if ((Table[Local_u8Idx].pfHandler == pfHandler) && (Table[Local_u8Idx].pvContext == pvContext)) {
+			for (; (Local_u8Idx + 1) < *Count; Local_u8Idx++) {
+				Table[Local_u8Idx] = Table[Local_u8Idx + 1];
+			}
+			(*Count)--;
+			return STD_OK;
+		}
+	}
+	return STD_NOK;
+}
+
+/* Invokes all the callbacks of a table in order */
+static inline void CALLBACK_voidInvokeAll(const ST_CallBack_t *Table, u8 Count) {
+	u8 Local_u8Idx;
+
+	for (Local_u8Idx = 0; Local_u8Idx < Count; Local_u8Idx++) {
+		Table[Local_u8Idx].pfHandler(Table[Local_u8Idx].pvContext);
+	}
+}
+
+#endif
@@ -0,0 +1,550 @@
+#ifndef _DSP_H_
+#define _DSP_H_
+
+/* Fixed-point block processing for the sensor pipelines.
+ * q15: 1.15 fraction in a s16, q31: 1.31 fraction in a s32.
+ * Products accumulate in 64 bits and are saturated only when the result is
+ * stored, so long filters neither wrap nor lose precision on the way.
+ *
+ * The Q15 kernels process two samples per instruction with the Cortex-M4 DSP
+ * extension (SMLALD: dual 16x16 multiply with 64-bit accumulate, QADD16:
+ * dual saturating add) when the compiler targets it (__ARM_FEATURE_DSP).
+ * Elsewhere the same instructions are emulated in C. Each SIMD kernel has a
+ * plain C reference (suffix Ref) computing the same result sample by sample;
+ * both must match bit for bit.
+ *
+ * FIR coefficients are stored in reverse time order, b[NumTaps-1] first and
+ * b[0] last (the CMSIS-DSP layout), so a window of the state lines up with
+ * them. Biquad coefficients are {b0, b1, b2, a1, a2} per stage with the
+ * feedback ones negated: y = b0.x + b1.x1 + b2.x2 + a1.y1 + a2.y2, scaled
+ * down by 2^PostShift so gains up to 2^PostShift fit the format. */
+
+typedef s16 q15;
+typedef s32 q31;
+typedef s64 q63;
+
+#define DSP_Q15_MAX		((s32)0x7FFF)
+#define DSP_Q15_MIN		(-(s32)0x8000)
+#define DSP_Q31_MAX		((s64)0x7FFFFFFFL)
+#define DSP_Q31_MIN		(-(s64)0x7FFFFFFFL - 1)
+
+/* Rounded conversion of a constant in [-1, 1) */
+#define DSP_Q15(X)		((q15)(((X) * 32768.0) + (((X) >= 0) ? 0.5 : -0.5)))
+#define DSP_Q31(X)		((q31)(((X) * 2147483648.0) + (((X) >= 0) ? 0.5 : -0.5)))
+
+typedef struct {
+	const q15 *Coeffs;		/* NumTaps, time reversed */
+	q15 *      State;		/* NumTaps - 1 + longest block */
+	u32        NumTaps;
+} ST_DspFirQ15_t;
+
+typedef struct {
+	const q31 *Coeffs;		/* NumTaps, time reversed */
+	q31 *      State;		/* NumTaps - 1 + longest block */
+	u32        NumTaps;
+} ST_DspFirQ31_t;
+
+typedef struct {
+	const q15 *Coeffs;		/* NumTaps, time reversed */
+	q15 *      State;		/* NumTaps - 1 + longest block */
+	u32        NumTaps;
+	u32        Factor;		/* one output every Factor inputs */
+} ST_DspFirDecimQ15_t;
+
+typedef struct {
+	const q15 *Coeffs;		/* 5 per stage */
+	q15 *      State;		/* 4 per stage: x1, x2, y1, y2 */
+	u32        NumStages;
+	u32        PostShift;
+} ST_DspBiquadQ15_t;
+
+typedef struct {
+	const q31 *Coeffs;		/* 5 per stage */
+	q31 *      State;		/* 4 per stage: x1, x2, y1, y2 */
+	u32        NumStages;
+	u32        PostShift;
+} ST_DspBiquadQ31_t;
+
+typedef struct {
+	q15 * Window;			/* Length last samples */
+	u32   Length;			/* 1 to 65536 */
+	u32   Index;
+	s32   Sum;
+} ST_DspMovingAvgQ15_t;
+
+typedef struct {
+	q15 Min;
+	q15 Max;
+	u32 MinIndex;
+	u32 MaxIndex;
+	q15 Mean;
+	q63 Power;				/* sum of squares, Q30 */
+} ST_DspStatsQ15_t;
+
+
+/****************************************************/
+/* Saturation and SIMD helpers                      */
+/****************************************************/
+
+static inline q15 DSP_q15Saturate(s64 Value) {
+	return (q15)((Value > DSP_Q15_MAX) ? DSP_Q15_MAX : ((Value < DSP_Q15_MIN) ? DSP_Q15_MIN : Value));
+}
+
+static inline q31 DSP_q31Saturate(s64 Value) {
+	return (q31)((Value > DSP_Q31_MAX) ? DSP_Q31_MAX : ((Value < DSP_Q31_MIN) ? DSP_Q31_MIN : Value));
+}
+
+#if defined(__ARM_FEATURE_DSP)
+
+/* Two consecutive samples in one word, the first in the low half.
+ * Unaligned word loads are allowed on the M4 */
+static inline u32 DSP_u32Read2(const q15 *Src) {
+	u32 Local_u32Pair;
+
+	__builtin_memcpy(&Local_u32Pair, Src, 4);
+	return Local_u32Pair;
+}
+
+static inline void DSP_voidWrite2(q15 *Dst, u32 Pair) {
+	__builtin_memcpy(Dst, &Pair, 4);
+}
+
+/* Acc + X.lo * Y.lo + X.hi * Y.hi */
+static inline s64 DSP_s64Smlald(u32 X, u32 Y, s64 Acc) {
+	__asm__ ("smlald %Q0, %R0, %1, %2" : "+r" (Acc) : "r" (X), "r" (Y));
+	return Acc;
+}
+
+/* Saturating add of both halves */
+static inline u32 DSP_u32Qadd16(u32 X, u32 Y) {
+	u32 Local_u32Sum;
+
+	__asm__ ("qadd16 %0, %1, %2" : "=r" (Local_u32Sum) : "r" (X), "r" (Y));
+	return Local_u32Sum;
+}
+
+/* Saturating 32-bit add */
+static inline q31 DSP_q31Qadd(q31 X, q31 Y) {
+	q31 Local_q31Sum;
+
+	__asm__ ("qadd %0, %1, %2" : "=r" (Local_q31Sum) : "r" (X), "r" (Y));
+	return Local_q31Sum;
+}
+
+#else
+
+static inline u32 DSP_u32Read2(const q15 *Src) {
+	return ((u32)(u16)Src[0]) | ((u32)(u16)Src[1] << 16);
+}
+
+static inline void DSP_voidWrite2(q15 *Dst, u32 Pair) {
+	Dst[0] = (q15)(u16)(Pair & 0xFFFFUL);
+	Dst[1] = (q15)(u16)((Pair >> 16) & 0xFFFFUL);
+}
+
+static inline s64 DSP_s64Smlald(u32 X, u32 Y, s64 Acc) {
+	return Acc + ((s32)(s16)(u16)(X & 0xFFFFUL) * (s32)(s16)(u16)(Y & 0xFFFFUL))
+	           + ((s32)(s16)(u16)((X >> 16) & 0xFFFFUL) * (s32)(s16)(u16)((Y >> 16) & 0xFFFFUL));
+}
+
+static inline u32 DSP_u32Qadd16(u32 X, u32 Y) {
+	q15 Local_q15Low = DSP_q15Saturate((s32)(s16)(u16)(X & 0xFFFFUL) + (s32)(s16)(u16)(Y & 0xFFFFUL));
+	q15 Local_q15High = DSP_q15Saturate((s32)(s16)(u16)((X >> 16) & 0xFFFFUL) + (s32)(s16)(u16)((Y >> 16) & 0xFFFFUL));
+
+	return (u32)(u16)Local_q15Low | ((u32)(u16)Local_q15High << 16);
+}
+
+static inline q31 DSP_q31Qadd(q31 X, q31 Y) {
+	return DSP_q31Saturate((s64)X + (s64)Y);
+}
+
+#endif
+
+
+/****************************************************/
+/* Vectors                                          */
+/****************************************************/
+
+/* Dst[i] = sat(A[i] + B[i]), Dst may be A or B */
+static inline void DSP_voidAddQ15(const q15 *A, const q15 *B, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; (Local_u32Idx + 1) < Length; Local_u32Idx += 2) {
+		DSP_voidWrite2(&Dst[Local_u32Idx], DSP_u32Qadd16(DSP_u32Read2(&A[Local_u32Idx]), DSP_u32Read2(&B[Local_u32Idx])));
+	}
+	if (Local_u32Idx < Length) {
+		Dst[Local_u32Idx] = DSP_q15Saturate((s32)A[Local_u32Idx] + B[Local_u32Idx]);
+	}
+}
+
+static inline void DSP_voidAddQ15Ref(const q15 *A, const q15 *B, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q15Saturate((s32)A[Local_u32Idx] + B[Local_u32Idx]);
+	}
+}
+
+static inline void DSP_voidAddQ31(const q31 *A, const q31 *B, q31 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q31Qadd(A[Local_u32Idx], B[Local_u32Idx]);
+	}
+}
+
+/* Dst[i] = sat(Src[i] * Scale * 2^Shift), Scale in Q15, Shift 0 to 15 */
+static inline void DSP_voidScaleQ15(const q15 *Src, q15 Scale, u32 Shift, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q15Saturate(((s32)Src[Local_u32Idx] * Scale) >> (15 - Shift));
+	}
+}
+
+static inline void DSP_voidScaleQ31(const q31 *Src, q31 Scale, u32 Shift, q31 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q31Saturate(((s64)Src[Local_u32Idx] * Scale) >> (31 - Shift));
+	}
+}
+
+/* Sum of A[i] * B[i] in Q30 */
+static inline q63 DSP_q63DotQ15(const q15 *A, const q15 *B, u32 Length) {
+	q63 Local_q63Acc = 0;
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; (Local_u32Idx + 3) < Length; Local_u32Idx += 4) {
+		Local_q63Acc = DSP_s64Smlald(DSP_u32Read2(&A[Local_u32Idx]), DSP_u32Read2(&B[Local_u32Idx]), Local_q63Acc);
+		Local_q63Acc = DSP_s64Smlald(DSP_u32Read2(&A[Local_u32Idx + 2]), DSP_u32Read2(&B[Local_u32Idx + 2]), Local_q63Acc);
+	}
+	for (; Local_u32Idx < Length; Local_u32Idx++) {
+		Local_q63Acc += (s32)A[Local_u32Idx] * B[Local_u32Idx];
+	}
+	return Local_q63Acc;
+}
+
+static inline q63 DSP_q63DotQ15Ref(const q15 *A, const q15 *B, u32 Length) {
+	q63 Local_q63Acc = 0;
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Local_q63Acc += (s32)A[Local_u32Idx] * B[Local_u32Idx];
+	}
+	return Local_q63Acc;
+}
+
+
+/****************************************************/
+/* Statistics                                       */
+/****************************************************/
+
+/* Extremes (first occurrence), mean rounded toward minus infinity, and power.
+ * Length must not be 0 */
+static inline void DSP_voidStatsQ15(const q15 *Src, u32 Length, ST_DspStatsQ15_t *Stats) {
+	s64 Local_s64Sum = 0;
+	u32 Local_u32Idx;
+
+	Stats->Min = Src[0];
+	Stats->Max = Src[0];
+	Stats->MinIndex = 0;
+	Stats->MaxIndex = 0;
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		if (Src[Local_u32Idx] < Stats->Min) {
+			Stats->Min = Src[Local_u32Idx];
+			Stats->MinIndex = Local_u32Idx;
+		} else if (Src[Local_u32Idx] > Stats->Max) {
+			Stats->Max = Src[Local_u32Idx];
+			Stats->MaxIndex = Local_u32Idx;
+		}
+		Local_s64Sum += Src[Local_u32Idx];
+	}
+	Stats->Mean = (q15)((Local_s64Sum >= 0) ? (Local_s64Sum / (s64)Length)
+	                                        : -((-Local_s64Sum + (s64)Length - 1) / (s64)Length));
+	Stats->Power = DSP_q63DotQ15(Src, Src, Length);
+}
+
+static inline void DSP_voidStatsQ15Ref(const q15 *Src, u32 Length, ST_DspStatsQ15_t *Stats) {
+	DSP_voidStatsQ15(Src, Length, Stats);
+	Stats->Power = DSP_q63DotQ15Ref(Src, Src, Length);
+}
+
+/* Running mean over the last Length samples, the window starts zeroed.
+ * Returns STD_NOK if Length is out of range */
+static inline u8 DSP_u8MovingAvgInitQ15(ST_DspMovingAvgQ15_t *Avg, q15 *Window, u32 Length) {
+	u32 Local_u32Idx;
+
+	if ((Length == 0) || (Length > 65536UL)) {
+		return STD_NOK;
+	}
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Window[Local_u32Idx] = 0;
+	}
+	Avg->Window = Window;
+	Avg->Length = Length;
+	Avg->Index = 0;
+	Avg->Sum = 0;
+	return STD_OK;
+}
+
+static inline void DSP_voidMovingAvgQ15(ST_DspMovingAvgQ15_t *Avg, const q15 *Src, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Avg->Sum += (s32)Src[Local_u32Idx] - Avg->Window[Avg->Index];
+		Avg->Window[Avg->Index] = Src[Local_u32Idx];
+		if (++Avg->Index == Avg->Length) {
+			Avg->Index = 0;
+		}
+		Dst[Local_u32Idx] = (q15)(Avg->Sum / (s32)Avg->Length);
+	}
+}
+
+
+/****************************************************/
+/* FIR filters and decimation                       */
+/****************************************************/
+
+/* State must hold NumTaps - 1 + the longest block processed; it starts zeroed */
+static inline void DSP_voidFirInitQ15(ST_DspFirQ15_t *Fir, const q15 *Coeffs, q15 *State, u32 NumTaps) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; (Local_u32Idx + 1) < NumTaps; Local_u32Idx++) {
+		State[Local_u32Idx] = 0;
+	}
+	Fir->Coeffs = Coeffs;
+	Fir->State = State;
+	Fir->NumTaps = NumTaps;
+}
+
+/* Appends a block behind the history kept in State */
+static inline void DSP_voidHistoryPushQ15(q15 *State, u32 NumTaps, const q15 *Src, u32 Length) {
+	__builtin_memcpy(&State[NumTaps - 1], Src, Length * sizeof(q15));
+}
+
+/* Keeps the last NumTaps - 1 samples as the history of the next block */
+static inline void DSP_voidHistoryShiftQ15(q15 *State, u32 NumTaps, u32 Length) {
+	__builtin_memmove(State, &State[Length], (NumTaps - 1) * sizeof(q15));
+}
+
+static inline void DSP_voidFirQ15(ST_DspFirQ15_t *Fir, const q15 *Src, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	DSP_voidHistoryPushQ15(Fir->State, Fir->NumTaps, Src, Length);
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q15Saturate(DSP_q63DotQ15(&Fir->State[Local_u32Idx], Fir->Coeffs, Fir->NumTaps) >> 15);
+	}
+	DSP_voidHistoryShiftQ15(Fir->State, Fir->NumTaps, Length);
+}
+
+static inline void DSP_voidFirQ15Ref(ST_DspFirQ15_t *Fir, const q15 *Src, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	DSP_voidHistoryPushQ15(Fir->State, Fir->NumTaps, Src, Length);
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Dst[Local_u32Idx] = DSP_q15Saturate(DSP_q63DotQ15Ref(&Fir->State[Local_u32Idx], Fir->Coeffs, Fir->NumTaps) >> 15);
+	}
+	DSP_voidHistoryShiftQ15(Fir->State, Fir->NumTaps, Length);
+}
+
+static inline void DSP_voidFirInitQ31(ST_DspFirQ31_t *Fir, const q31 *Coeffs, q31 *State, u32 NumTaps) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; (Local_u32Idx + 1) < NumTaps; Local_u32Idx++) {
+		State[Local_u32Idx] = 0;
+	}
+	Fir->Coeffs = Coeffs;
+	Fir->State = State;
+	Fir->NumTaps = NumTaps;
+}
+
+/* Q31 has no dual multiply: one SMLAL per tap. The 2.62 accumulator has no
+ * guard bits, scale the input down by log2(NumTaps) bits */
+static inline void DSP_voidFirQ31(ST_DspFirQ31_t *Fir, const q31 *Src, q31 *Dst, u32 Length) {
+	u32 Local_u32Idx, Local_u32Tap;
+	q63 Local_q63Acc;
+
+	__builtin_memcpy(&Fir->State[Fir->NumTaps - 1], Src, Length * sizeof(q31));
+	for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+		Local_q63Acc = 0;
+		for (Local_u32Tap = 0; Local_u32Tap < Fir->NumTaps; Local_u32Tap++) {
+			Local_q63Acc += (s64)Fir->State[Local_u32Idx + Local_u32Tap] * Fir->Coeffs[Local_u32Tap];
+		}
+		Dst[Local_u32Idx] = DSP_q31Saturate(Local_q63Acc >> 31);
+	}
+	__builtin_memmove(Fir->State, &Fir->State[Length], (Fir->NumTaps - 1) * sizeof(q31));
+}
+
+/* Returns STD_NOK if Factor is 0 */
+static inline u8 DSP_u8FirDecimInitQ15(ST_DspFirDecimQ15_t *Decim, const q15 *Coeffs, q15 *State,
+                                       u32 NumTaps, u32 Factor) {
+	u32 Local_u32Idx;
+
+	if (Factor == 0) {
+		return STD_NOK;
+	}
+	for (Local_u32Idx = 0; (Local_u32Idx + 1) < NumTaps; Local_u32Idx++) {
+		State[Local_u32Idx] = 0;
+	}
+	Decim->Coeffs = Coeffs;
+	Decim->State = State;
+	Decim->NumTaps = NumTaps;
+	Decim->Factor = Factor;
+	return STD_OK;
+}
+
+/* Filters and keeps every Factor-th output: Length must be a multiple of
+ * Factor and Dst receives Length / Factor samples. Only the kept outputs
+ * are computed */
+static inline void DSP_voidFirDecimQ15(ST_DspFirDecimQ15_t *Decim, const q15 *Src, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	DSP_voidHistoryPushQ15(Decim->State, Decim->NumTaps, Src, Length);
+	for (Local_u32Idx = Decim->Factor - 1; Local_u32Idx < Length; Local_u32Idx += Decim->Factor) {
+		*Dst++ = DSP_q15Saturate(DSP_q63DotQ15(&Decim->State[Local_u32Idx], Decim->Coeffs, Decim->NumTaps) >> 15);
+	}
+	DSP_voidHistoryShiftQ15(Decim->State, Decim->NumTaps, Length);
+}
+
+static inline void DSP_voidFirDecimQ15Ref(ST_DspFirDecimQ15_t *Decim, const q15 *Src, q15 *Dst, u32 Length) {
+	u32 Local_u32Idx;
+
+	DSP_voidHistoryPushQ15(Decim->State, Decim->NumTaps, Src, Length);
+	for (Local_u32Idx = Decim->Factor - 1; Local_u32Idx < Length; Local_u32Idx += Decim->Factor) {
+		*Dst++ = DSP_q15Saturate(DSP_q63DotQ15Ref(&Decim->State[Local_u32Idx], Decim->Coeffs, Decim->NumTaps) >> 15);
+	}
+	DSP_voidHistoryShiftQ15(Decim->State, Decim->NumTaps, Length);
+}
+
+
+/****************************************************/
+/* Biquad cascades (direct form I)                  */
+/****************************************************/
+
+/* State must hold 4 samples per stage; it starts zeroed. PostShift 0 to 15 */
+static inline void DSP_voidBiquadInitQ15(ST_DspBiquadQ15_t *Biquad, const q15 *Coeffs, q15 *State,
+                                         u32 NumStages, u32 PostShift) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < (NumStages * 4); Local_u32Idx++) {
+		State[Local_u32Idx] = 0;
+	}
+	Biquad->Coeffs = Coeffs;
+	Biquad->State = State;
+	Biquad->NumStages = NumStages;
+	Biquad->PostShift = PostShift;
+}
+
+/* Each stage runs over the whole block, in place in Dst. The history pairs
+ * (x1, x2) and (y1, y2) stay packed in registers across the block */
+static inline void DSP_voidBiquadQ15(ST_DspBiquadQ15_t *Biquad, const q15 *Src, q15 *Dst, u32 Length) {
+	const q15 *Local_pCoeffs = Biquad->Coeffs;
+	q15 *Local_pState = Biquad->State;
+	const q15 *Local_pIn = Src;
+	u32 Local_u32Stage, Local_u32Idx, Local_u32B12, Local_u32A12, Local_u32X, Local_u32Y;
+	q15 Local_q15In, Local_q15Out;
+
+	for (Local_u32Stage = 0; Local_u32Stage < Biquad->NumStages; Local_u32Stage++) {
+		Local_u32B12 = DSP_u32Read2(&Local_pCoeffs[1]);
+		Local_u32A12 = DSP_u32Read2(&Local_pCoeffs[3]);
+		Local_u32X = DSP_u32Read2(&Local_pState[0]);
+		Local_u32Y = DSP_u32Read2(&Local_pState[2]);
+
+		for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+			Local_q15In = Local_pIn[Local_u32Idx];
+			Local_q15Out = DSP_q15Saturate(DSP_s64Smlald(Local_u32Y, Local_u32A12,
+			                               DSP_s64Smlald(Local_u32X, Local_u32B12, (s32)Local_pCoeffs[0] * Local_q15In))
+			                               >> (15 - Biquad->PostShift));
+			Local_u32X = ((Local_u32X << 16) | (u16)Local_q15In) & 0xFFFFFFFFUL;
+			Local_u32Y = ((Local_u32Y << 16) | (u16)Local_q15Out) & 0xFFFFFFFFUL;
+			Dst[Local_u32Idx] = Local_q15Out;
+		}
+
+		DSP_voidWrite2(&Local_pState[0], Local_u32X);
+		DSP_voidWrite2(&Local_pState[2], Local_u32Y);
+		Local_pCoeffs += 5;
+		Local_pState += 4;
+		Local_pIn = Dst;
+	}
+}
+
+static inline void DSP_voidBiquadQ15Ref(ST_DspBiquadQ15_t *Biquad, const q15 *Src, q15 *Dst, u32 Length) {
+	const q15 *Local_pCoeffs = Biquad->Coeffs;
+	q15 *Local_pState = Biquad->State;
+	const q15 *Local_pIn = Src;
+	u32 Local_u32Stage, Local_u32Idx;
+	q15 Local_q15In;
+	s64 Local_s64Acc;
+
+	for (Local_u32Stage = 0; Local_u32Stage < Biquad->NumStages; Local_u32Stage++) {
+		for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+			Local_q15In = Local_pIn[Local_u32Idx];
+			Local_s64Acc = (s32)Local_pCoeffs[0] * Local_q15In
+			             + (s32)Local_pCoeffs[1] * Local_pState[0] + (s32)Local_pCoeffs[2] * Local_pState[1]
+			             + (s32)Local_pCoeffs[3] * Local_pState[2] + (s32)Local_pCoeffs[4] * Local_pState[3];
+			Local_pState[1] = Local_pState[0];
+			Local_pState[0] = Local_q15In;
+			Local_pState[3] = Local_pState[2];
+			Local_pState[2] = DSP_q15Saturate(Local_s64Acc >> (15 - Biquad->PostShift));
+			Dst[Local_u32Idx] = Local_pState[2];
+		}
+		Local_pCoeffs += 5;
+		Local_pState += 4;
+		Local_pIn = Dst;
+	}
+}
+
+/* PostShift 0 to 31 */
+static inline void DSP_voidBiquadInitQ31(ST_DspBiquadQ31_t *Biquad, const q31 *Coeffs, q31 *State,
+                                         u32 NumStages, u32 PostShift) {
+	u32 Local_u32Idx;
+
+	for (Local_u32Idx = 0; Local_u32Idx < (NumStages * 4); Local_u32Idx++) {
+		State[Local_u32Idx] = 0;
+	}
+	Biquad->Coeffs = Coeffs;
+	Biquad->State = State;
+	Biquad->NumStages = NumStages;
+	Biquad->PostShift = PostShift;
+}
+
+/* The five Q62 products must fit the 64-bit accumulator: keep the
+ * coefficients scaled so that |b0| + |b1| + |b2| + |a1| + |a2| < 2 */
+static inline void DSP_voidBiquadQ31(ST_DspBiquadQ31_t *Biquad, const q31 *Src, q31 *Dst, u32 Length) {
+	const q31 *Local_pCoeffs = Biquad->Coeffs;
+	q31 *Local_pState = Biquad->State;
+	const q31 *Local_pIn = Src;
+	u32 Local_u32Stage, Local_u32Idx;
+	q31 Local_q31In, Local_q31X1, Local_q31X2, Local_q31Y1, Local_q31Y2;
+	s64 Local_s64Acc;
+
+	for (Local_u32Stage = 0; Local_u32Stage < Biquad->NumStages; Local_u32Stage++) {
+		Local_q31X1 = Local_pState[0];
+		Local_q31X2 = Local_pState[1];
+		Local_q31Y1 = Local_pState[2];
+		Local_q31Y2 = Local_pState[3];
+
+		for (Local_u32Idx = 0; Local_u32Idx < Length; Local_u32Idx++) {
+			Local_q31In = Local_pIn[Local_u32Idx];
+			Local_s64Acc = (s64)Local_pCoeffs[0] * Local_q31In
+			             + (s64)Local_pCoeffs[1] * Local_q31X1 + (s64)Local_pCoeffs[2] * Local_q31X2
+			             + (s64)Local_pCoeffs[3] * Local_q31Y1 + (s64)Local_pCoeffs[4] * Local_q31Y2;
+			Local_q31X2 = Local_q31X1;
+			Local_q31X1 = Local_q31In;
+			Local_q31Y2 = Local_q31Y1;
+			Local_q31Y1 = DSP_q31Saturate(Local_s64Acc >> (31 - Biquad->PostShift));
+			Dst[Local_u32Idx] = Local_q31Y1;
+		}
+
+		Local_pState[0] = Local_q31X1;
+		Local_pState[1] = Local_q31X2;
+		Local_pState[2] = Local_q31Y1;
+		Local_pState[3] = Local_q31Y2;
+		Local_pCoeffs += 5;
+		Local_pState += 4;
+		Local_pIn = Dst;
+	}
+}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef _POOL_H_
+#define _POOL_H_
+
+/* Fixed-size block pools, the replacement for malloc on the target.
+ * Alloc and free are O(1) and lock-free, callable from any ISR priority and
+ * from threads: the free list head is swapped with compare-and-swap
+ * (LDREX/STREX on the Cortex-M4). The head packs the index of the first free
+ * block with a tag bumped on every update, so a pop that was preempted by a
+ * pop-and-push of the same block fails its swap instead of corrupting the list.
+ *
+ * A pool needs no init call: blocks never handed out yet are carved off the
+ * storage in order, and only freed blocks go through the list, so a pool
+ * defined with POOL_DEFINE is ready before main runs.
+ *
+ * Several pools of growing block sizes form a set (size classes): an alloc
+ * takes the smallest class that fits and falls back to the larger ones, and
+ * a free finds the owning pool from the block address. */
+
+#include "ATOMIC.h"
+
+#define POOL_MAX_BLOCKS			0xFFFFUL
+
+/* Block sizes are rounded up to whole words so every block is word aligned */
+#define POOL_BLOCK_WORDS(SIZE)	(((SIZE) + 3UL) / 4UL)
+
+/* Free list head: tag in the upper half, first free block index + 1 in the
+ * lower half (0 means empty) */
+#define POOL_HEAD_INDEX(HEAD)	((HEAD) & 0xFFFFUL)
+#define POOL_HEAD_TAG(HEAD)		(((HEAD) >> 16) & 0xFFFFUL)
+#define POOL_HEAD(TAG, INDEX)	((((TAG) & 0xFFFFUL) << 16) | ((INDEX) & 0xFFFFUL))
+
+typedef struct {
+	u32 *        Storage;
+	u32          BlockWords;	/* block size in words */
+	u32          BlockCount;
+	volatile u32 FreeHead;		/* see POOL_HEAD */
+	volatile u32 Carved;		/* blocks taken off the storage so far */
+	volatile u32 Used;			/* blocks currently handed out */
+	volatile u32 HighWater;		/* most blocks ever handed out at once */
+	volatile u32 Failures;		/* allocs that found the pool empty */
+} ST_Pool_t;
+
+typedef struct {
+	u32 BlockSize;
+	u32 BlockCount;
+	u32 Used;
+	u32 HighWater;
+	u32 Failures;
+} ST_PoolStats_t;
+
+/* Size classes, ordered by growing block size */
+typedef struct {
+	ST_Pool_t *const *Pools;
+	u32               Count;
+} ST_PoolSet_t;
+
+/* Compile-time rejection of pools the free list cannot index */
+#define POOL_CHECK(SIZE, COUNT) \
+	(sizeof(char[(((COUNT) > 0) && ((COUNT) <= POOL_MAX_BLOCKS) && ((SIZE) > 0)) ? 1 : -1]) * 0)
+
+#define POOL_INITIALIZER(STORAGE, SIZE, COUNT) \
+	{ (STORAGE), POOL_BLOCK_WORDS(SIZE) + POOL_CHECK(SIZE, COUNT), (COUNT), 0, 0, 0, 0, 0 }
+
+/* Defines pool NAME of COUNT blocks of SIZE bytes with its storage, e.g. at
+ * file scope:  POOL_DEFINE(APP_PacketPool, 64, 16);
+ * Modules sharing it see it through POOL_DECLARE(APP_PacketPool); */
+#define POOL_DEFINE(NAME, SIZE, COUNT) \
+	static u32 NAME##_Storage[POOL_BLOCK_WORDS(SIZE) * (COUNT)]; \
+	ST_Pool_t NAME = POOL_INITIALIZER(NAME##_Storage, SIZE, COUNT)
+
+#define POOL_DECLARE(NAME)		extern ST_Pool_t NAME
+
+/* Defines set NAME over the listed pools, smallest block size first:
+ * POOL_SET_DEFINE(APP_Buffers, &APP_SmallPool, &APP_LargePool); */
+#define POOL_SET_DEFINE(NAME, ...) \
+	static ST_Pool_t *const NAME##_Pools[] = { __VA_ARGS__ }; \
+	ST_PoolSet_t NAME = { NAME##_Pools, sizeof(NAME##_Pools) / sizeof(NAME##_Pools[0]) }
+
+#define POOL_SET_DECLARE(NAME)	extern ST_PoolSet_t NAME
+
+
+/****************************************************/
+/* Single pool                                      */
+/****************************************************/
+
+/* Runtime counterpart of POOL_DEFINE for storage of POOL_BLOCK_WORDS(BlockSize)
+ * * BlockCount words. Returns STD_NOK if the sizes are out of range. Not safe
+ * against concurrent use of the same pool */
+static inline u8 POOL_u8Init(ST_Pool_t *Pool, u32 *Storage, u32 BlockSize, u32 BlockCount) {
+	if ((BlockSize == 0) || (BlockCount == 0) || (BlockCount > POOL_MAX_BLOCKS)) {
+		return STD_NOK;
+	}
+	Pool->Storage = Storage;
+	Pool->BlockWords = POOL_BLOCK_WORDS(BlockSize);
+	Pool->BlockCount = BlockCount;
+	Pool->FreeHead = 0;
+	Pool->Carved = 0;
+	Pool->Used = 0;
+	Pool->HighWater = 0;
+	Pool->Failures = 0;
+	return STD_OK;
+}
+
+static inline u32 POOL_u32BlockSize(const ST_Pool_t *Pool) {
+	return Pool->BlockWords * 4UL;
+}
+
+/* TRUE if Block lies in the pool storage */
+static inline u8 POOL_u8Owns(const ST_Pool_t *Pool, const void *Block) {
+	const u32 *Local_pu32Block = (const u32 *)Block;
+
+	return ((Local_pu32Block >= Pool->Storage) &&
+	        (Local_pu32Block < &Pool->Storage[Pool->BlockWords * Pool->BlockCount])) ? TRUE : FALSE;
+}
+
+/* Counts a handed out block and raises the high-water mark if needed */
+static inline void POOL_voidCountAlloc(ST_Pool_t *Pool) {
+	(void)ATOMIC_u32Max(&Pool->HighWater, ATOMIC_u32FetchAdd(&Pool->Used, 1) + 1);
+}
+
+/* Returns a block of at least POOL_u32BlockSize bytes, or NULL if none is free */
+static inline void *POOL_pvAlloc(ST_Pool_t *Pool) {
+	u32 Local_u32Head, Local_u32Index, Local_u32Next, Local_u32Carved;
+	u32 *Local_pu32Block;
+
+	/* Recycled blocks first: each holds the list index of the next one */
+	Local_u32Head = ATOMIC_u32Load(&Pool->FreeHead);
+	while (POOL_HEAD_INDEX(Local_u32Head) != 0) {
+		Local_u32Index = POOL_HEAD_INDEX(Local_u32Head) - 1;
+		Local_pu32Block = &Pool->Storage[Local_u32Index * Pool->BlockWords];
+		/* May read a block another context took meanwhile; the tag then
+		 * differs and the swap below fails */
+		Local_u32Next = POOL_HEAD_INDEX(ATOMIC_u32Load(Local_pu32Block));
+		if (ATOMIC_u8CompareExchange(&Pool->FreeHead, &Local_u32Head,
+		                             POOL_HEAD(POOL_HEAD_TAG(Local_u32Head) + 1, Local_u32Next)) == TRUE) {
+			POOL_voidCountAlloc(Pool);
+			return Local_pu32Block;
+		}
+	}
+
+	/* Then blocks never handed out yet */
+	Local_u32Carved = ATOMIC_u32Load(&Pool->Carved);
+	while (Local_u32Carved < Pool->BlockCount) {
+		if (ATOMIC_u8CompareExchange(&Pool->Carved, &Local_u32Carved, Local_u32Carved + 1) == TRUE) {
+			POOL_voidCountAlloc(Pool);
+			return &Pool->Storage[Local_u32Carved * Pool->BlockWords];
+		}
+	}
+
+	(void)ATOMIC_u32FetchAdd(&Pool->Failures, 1);
+	return NULL;
+}
+
+/* Gives back a block obtained from POOL_pvAlloc on the same pool */
+static inline void POOL_voidFree(ST_Pool_t *Pool, void *Block) {
+	u32 *Local_pu32Block = (u32 *)Block;
+	u32 Local_u32Index = (u32)(Local_pu32Block - Pool->Storage) / Pool->BlockWords;
+	u32 Local_u32Head;
+
+	/* Uncounted first, so Used never exceeds the blocks really out */
+	(void)ATOMIC_u32FetchSub(&Pool->Used, 1);
+
+	Local_u32Head = ATOMIC_u32Load(&Pool->FreeHead);
+	do {
+		ATOMIC_voidStore(Local_pu32Block, POOL_HEAD_INDEX(Local_u32Head));
+	} while (ATOMIC_u8CompareExchange(&Pool->FreeHead, &Local_u32Head,
+	                                  POOL_HEAD(POOL_HEAD_TAG(Local_u32Head) + 1, Local_u32Index + 1)) == FALSE);
+}
+
+static inline void POOL_voidGetStats(const ST_Pool_t *Pool, ST_PoolStats_t *Stats) {
+	Stats->BlockSize = POOL_u32BlockSize(Pool);
+	Stats->BlockCount = Pool->BlockCount;
+	Stats->Used = Pool->Used;
+	Stats->HighWater = Pool->HighWater;
+	Stats->Failures = Pool->Failures;
+}
+
+/* Restarts the high-water mark from the current use and clears the failures */
+static inline void POOL_voidResetStats(ST_Pool_t *Pool) {
+	ATOMIC_voidStore(&Pool->HighWater, ATOMIC_u32Load(&Pool->Used));
+	ATOMIC_voidStore(&Pool->Failures, 0);
+}
+
+
+/****************************************************/
+/* Size classes                                     */
+/****************************************************/
+
+/* Returns a block of at least Size bytes from the smallest class that has
+ * one free, or NULL. Every class found empty on the way counts a failure */
+static inline void *POOL_pvSetAlloc(const ST_PoolSet_t *Set, u32 Size) {
+	u32 Local_u32Class;
+	void *Local_pvBlock;
+
+	for (Local_u32Class = 0; Local_u32Class < Set->Count; Local_u32Class++) {
+		if (POOL_u32BlockSize(Set->Pools[Local_u32Class]) >= Size) {
+			Local_pvBlock = POOL_pvAlloc(Set->Pools[Local_u32Class]);
+			if (Local_pvBlock != NULL) {
+				return Local_pvBlock;
+			}
+		}
+	}
+	return NULL;
+}
+
+/* Returns the pool of the set that owns Block, or NULL */
+static inline ST_Pool_t *POOL_pSetOwner(const ST_PoolSet_t *Set, const void *Block) {
+	u32 Local_u32Class;
+
+	for (Local_u32Class = 0; Local_u32Class < Set->Count; Local_u32Class++) {
+		if (POOL_u8Owns(Set->Pools[Local_u32Class], Block) == TRUE) {
+			return Set->Pools[Local_u32Class];
+		}
+	}
+	return NULL;
+}
+
+/* Gives back a block from POOL_pvSetAlloc, returns STD_NOK if no pool owns it */
+static inline u8 POOL_u8SetFree(const ST_PoolSet_t *Set, void *Block) {
+	ST_Pool_t *Local_pPool = POOL_pSetOwner(Set, Block);
+
+	if (Local_pPool == NULL) {
+		return STD_NOK;
+	}
+	POOL_voidFree(Local_pPool, Block);
+	return STD_OK;
+}
+
+#endif
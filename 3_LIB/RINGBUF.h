@@ -0,0 +1,332 @@
+
+#ifndef _RINGBUF_H_
+#define _RINGBUF_H_
+
+/* Lock-free byte ring buffers between ISRs and thread code.
+ * The capacity is a power of two and the indices run freely (wrapping at
+ * 2^32), so used = Head - Tail and a full buffer needs no spare slot.
+ *
+ * ST_RingBuf_t     one producer and one consumer (e.g. an ISR and the main
+ *                  loop): plain loads and stores, each index has one writer.
+ * ST_MpscRingBuf_t several producers (ISRs of any priority and threads) and
+ *                  one consumer: space is claimed with compare-and-swap
+ *                  (LDREX/STREX on the Cortex-M4) and published once no
+ *                  producer is still copying into it, so a preempting ISR
+ *                  never waits for the producer it interrupted.
+ *
+ * Both offer single bytes, batches, and zero-copy access: Reserve/Commit
+ * hands the producer a contiguous free region, Peek/Consume hands the
+ * consumer a contiguous filled one. */
+
+#include "ATOMIC.h"
+
+/* Ordering of the data against the index that publishes it */
+#define RINGBUF_FENCE()		ATOMIC_FENCE()
+
+typedef struct {
+	u8 *         Buffer;
+	u32          Mask;		/* capacity - 1 */
+	volatile u32 Head;		/* bytes written, producer only */
+	volatile u32 Tail;		/* bytes read, consumer only */
+} ST_RingBuf_t;
+
+typedef struct {
+	u8 *         Buffer;
+	u32          Mask;		/* capacity - 1 */
+	volatile u32 Reserved;	/* bytes claimed by the producers */
+	volatile u32 Head;		/* bytes published to the consumer */
+	volatile u32 Writers;	/* producers between claim and publish */
+	volatile u32 Tail;		/* bytes read, consumer only */
+} ST_MpscRingBuf_t;
+
+
+/* Copies Length bytes into the ring at index Index, wrapping at the end */
+static inline void RINGBUF_voidCopyIn(u8 *Buffer, u32 Mask, u32 Index, const u8 *Data, u32 Length) {
+	u32 Local_u32Offset = Index & Mask;
+	u32 Local_u32First = Mask + 1 - Local_u32Offset;
+
+	if (Local_u32First > Length) {
+		Local_u32First = Length;
+	}
+	__builtin_memcpy(&Buffer[Local_u32Offset], Data, Local_u32First);
+	__builtin_memcpy(Buffer, &Data[Local_u32First], Length - Local_u32First);
+}
+
+/* Copies Length bytes out of the ring from index Index, wrapping at the end */
+static inline void RINGBUF_voidCopyOut(const u8 *Buffer, u32 Mask, u32 Index, u8 *Data, u32 Length) {
+	u32 Local_u32Offset = Index & Mask;
+	u32 Local_u32First = Mask + 1 - Local_u32Offset;
+
+	if (Local_u32First > Length) {
+		Local_u32First = Length;
+	}
+	__builtin_memcpy(Data, &Buffer[Local_u32Offset], Local_u32First);
+	__builtin_memcpy(&Data[Local_u32First], Buffer, Length - Local_u32First);
+}
+
+
+/****************************************************/
+/* Single producer, single consumer                 */
+/****************************************************/
+
+/* Returns STD_OK, or STD_NOK if Capacity is not a power of two */
+static inline u8 RINGBUF_u8Init(ST_RingBuf_t *Ring, u8 *Buffer, u32 Capacity) {
+	if ((Capacity == 0) || ((Capacity & (Capacity - 1)) != 0)) {
+		return STD_NOK;
+	}
+	Ring->Buffer = Buffer;
+	Ring->Mask = Capacity - 1;
+	Ring->Head = 0;
+	Ring->Tail = 0;
+	return STD_OK;
+}
+
+static inline u32 RINGBUF_u32Used(const ST_RingBuf_t *Ring) {
+	return (Ring->Head - Ring->Tail) & 0xFFFFFFFFUL;
+}
+
+static inline u32 RINGBUF_u32Free(const ST_RingBuf_t *Ring) {
+	return Ring->Mask + 1 - RINGBUF_u32Used(Ring);
+}
+
+/* Producer: returns STD_OK, or STD_NOK if full */
+static inline u8 RINGBUF_u8Push(ST_RingBuf_t *Ring, u8 Data) {
+	u32 Local_u32Head = Ring->Head;
+
+	if (((Local_u32Head - Ring->Tail) & 0xFFFFFFFFUL) > Ring->Mask) {
+		return STD_NOK;
+	}
+	Ring->Buffer[Local_u32Head & Ring->Mask] = Data;
+	RINGBUF_FENCE();
+	Ring->Head = (Local_u32Head + 1) & 0xFFFFFFFFUL;
+	return STD_OK;
+}
+
+/* Consumer: returns STD_OK, or STD_NOK if empty */
+static inline u8 RINGBUF_u8Pop(ST_RingBuf_t *Ring, u8 *Data) {
+	u32 Local_u32Tail = Ring->Tail;
+
+	if (Ring->Head == Local_u32Tail) {
+		return STD_NOK;
+	}
+	RINGBUF_FENCE();
+	*Data = Ring->Buffer[Local_u32Tail & Ring->Mask];
+	RINGBUF_FENCE();
+	Ring->Tail = (Local_u32Tail + 1) & 0xFFFFFFFFUL;
+	return STD_OK;
+}
+
+/* Producer: writes as many bytes as fit, returns how many */
+static inline u32 RINGBUF_u32Write(ST_RingBuf_t *Ring, const u8 *Data, u32 Length) {
+	u32 Local_u32Head = Ring->Head;
+	u32 Local_u32Free = Ring->Mask + 1 - ((Local_u32Head - Ring->Tail) & 0xFFFFFFFFUL);
+
+	if (Length > Local_u32Free) {
+		Length = Local_u32Free;
+	}
+	RINGBUF_FENCE();
+	RINGBUF_voidCopyIn(Ring->Buffer, Ring->Mask, Local_u32Head, Data, Length);
+	RINGBUF_FENCE();
+	Ring->Head = (Local_u32Head + Length) & 0xFFFFFFFFUL;
+	return Length;
+}
+
+/* Consumer: reads up to Length bytes, returns how many */
+static inline u32 RINGBUF_u32Read(ST_RingBuf_t *Ring, u8 *Data, u32 Length) {
+	u32 Local_u32Tail = Ring->Tail;
+	u32 Local_u32Used = (Ring->Head - Local_u32Tail) & 0xFFFFFFFFUL;
+
+	if (Length > Local_u32Used) {
+		Length = Local_u32Used;
+	}
+	RINGBUF_FENCE();
+	RINGBUF_voidCopyOut(Ring->Buffer, Ring->Mask, Local_u32Tail, Data, Length);
+	RINGBUF_FENCE();
+	Ring->Tail = (Local_u32Tail + Length) & 0xFFFFFFFFUL;
+	return Length;
+}
+
+/* Producer: contiguous free region at the head, returns its length (0 if full).
+ * Fill up to that many bytes in place, then publish them with RINGBUF_voidCommit */
+static inline u32 RINGBUF_u32Reserve(ST_RingBuf_t *Ring, u8 **Region) {
+	u32 Local_u32Head = Ring->Head;
+	u32 Local_u32Free = Ring->Mask + 1 - ((Local_u32Head - Ring->Tail) & 0xFFFFFFFFUL);
+	u32 Local_u32ToEnd = Ring->Mask + 1 - (Local_u32Head & Ring->Mask);
+
+	*Region = &Ring->Buffer[Local_u32Head & Ring->Mask];
+	RINGBUF_FENCE();
+	return (Local_u32Free < Local_u32ToEnd) ? Local_u32Free : Local_u32ToEnd;
+}
+
+static inline void RINGBUF_voidCommit(ST_RingBuf_t *Ring, u32 Length) {
+	RINGBUF_FENCE();
+	Ring->Head = (Ring->Head + Length) & 0xFFFFFFFFUL;
+}
+
+/* Consumer: contiguous filled region at the tail, returns its length (0 if empty).
+ * Process up to that many bytes in place, then free them with RINGBUF_voidConsume */
+static inline u32 RINGBUF_u32Peek(ST_RingBuf_t *Ring, const u8 **Region) {
+	u32 Local_u32Tail = Ring->Tail;
+	u32 Local_u32Used = (Ring->Head - Local_u32Tail) & 0xFFFFFFFFUL;
+	u32 Local_u32ToEnd = Ring->Mask + 1 - (Local_u32Tail & Ring->Mask);
+
+	*Region = &Ring->Buffer[Local_u32Tail & Ring->Mask];
+	RINGBUF_FENCE();
+	return (Local_u32Used < Local_u32ToEnd) ? Local_u32Used : Local_u32ToEnd;
+}
+
+static inline void RINGBUF_voidConsume(ST_RingBuf_t *Ring, u32 Length) {
+	RINGBUF_FENCE();
+	Ring->Tail = (Ring->Tail + Length) & 0xFFFFFFFFUL;
+}
+
+
+/****************************************************/
+/* Multiple producers, single consumer              */
+/****************************************************/
+
+/* Returns STD_OK, or STD_NOK if Capacity is not a power of two */
+static inline u8 RINGBUF_u8MpscInit(ST_MpscRingBuf_t *Ring, u8 *Buffer, u32 Capacity) {
+	if ((Capacity == 0) || ((Capacity & (Capacity - 1)) != 0)) {
+		return STD_NOK;
+	}
+	Ring->Buffer = Buffer;
+	Ring->Mask = Capacity - 1;
+	Ring->Reserved = 0;
+	Ring->Head = 0;
+	Ring->Writers = 0;
+	Ring->Tail = 0;
+	return STD_OK;
+}
+
+static inline u32 RINGBUF_u32MpscUsed(const ST_MpscRingBuf_t *Ring) {
+	return (Ring->Head - Ring->Tail) & 0xFFFFFFFFUL;
+}
+
+/* Producer: claims Length bytes, or as many as fit contiguously when
+ * Contiguous is TRUE (all or nothing otherwise). Must be followed by
+ * RINGBUF_voidMpscPublish, whether or not anything was claimed.
+ * Returns the number of bytes claimed and their start index in *Index */
+static inline u32 RINGBUF_u32MpscClaim(ST_MpscRingBuf_t *Ring, u32 Length, u8 Contiguous, u32 *Index) {
+	u32 Local_u32Reserved, Local_u32Free, Local_u32ToEnd, Local_u32Length;
+
+	/* Counted as a writer before claiming, so nobody publishes the claim early */
+	(void)ATOMIC_u32FetchAdd(&Ring->Writers, 1);
+
+	Local_u32Reserved = ATOMIC_u32Load(&Ring->Reserved);
+	do {
+		Local_u32Length = Length;
+		Local_u32Free = Ring->Mask + 1 - ((Local_u32Reserved - Ring->Tail) & 0xFFFFFFFFUL);
+		if (Contiguous == TRUE) {
+			Local_u32ToEnd = Ring->Mask + 1 - (Local_u32Reserved & Ring->Mask);
+			if (Local_u32Length > Local_u32ToEnd) {
+				Local_u32Length = Local_u32ToEnd;
+			}
+			if (Local_u32Length > Local_u32Free) {
+				Local_u32Length = Local_u32Free;
+			}
+		} else if (Local_u32Length > Local_u32Free) {
+			Local_u32Length = 0;
+		}
+		if (Local_u32Length == 0) {
+			break;
+		}
+	} while (ATOMIC_u8CompareExchange(&Ring->Reserved, &Local_u32Reserved,
+	                                  (Local_u32Reserved + Local_u32Length) & 0xFFFFFFFFUL) == FALSE);
+
+	*Index = Local_u32Reserved;
+	return Local_u32Length;
+}
+
+/* Producer: ends a claim. The last producer out publishes everything claimed
+ * before it left; if more was claimed meanwhile it goes round again */
+static inline void RINGBUF_voidMpscPublish(ST_MpscRingBuf_t *Ring) {
+	u32 Local_u32Reserved, Local_u32Head;
+
+	while (1) {
+		Local_u32Reserved = ATOMIC_u32Load(&Ring->Reserved);
+		if (ATOMIC_u32FetchSub(&Ring->Writers, 1) != 1) {
+			return;		/* a producer still inside publishes for us */
+		}
+
+		/* Head only moves forward: a late publisher must not move it back */
+		Local_u32Head = ATOMIC_u32Load(&Ring->Head);
+		while ((((Local_u32Reserved - Local_u32Head) & 0xFFFFFFFFUL) - 1) <= Ring->Mask) {
+			if (ATOMIC_u8CompareExchange(&Ring->Head, &Local_u32Head, Local_u32Reserved) == TRUE) {
+				break;
+			}
+		}
+
+		if (ATOMIC_u32Load(&Ring->Reserved) == Local_u32Reserved) {
+			return;
+		}
+		(void)ATOMIC_u32FetchAdd(&Ring->Writers, 1);
+	}
+}
+
+/* Producer: writes all Length bytes or none, returns STD_OK or STD_NOK */
+static inline u8 RINGBUF_u8MpscWrite(ST_MpscRingBuf_t *Ring, const u8 *Data, u32 Length) {
+	u32 Local_u32Index;
+	u32 Local_u32Length = RINGBUF_u32MpscClaim(Ring, Length, FALSE, &Local_u32Index);
+
+	RINGBUF_voidCopyIn(Ring->Buffer, Ring->Mask, Local_u32Index, Data, Local_u32Length);
+	RINGBUF_voidMpscPublish(Ring);
+	return ((Local_u32Length == Length) && (Length != 0)) ? STD_OK : STD_NOK;
+}
+
+static inline u8 RINGBUF_u8MpscPush(ST_MpscRingBuf_t *Ring, u8 Data) {
+	return RINGBUF_u8MpscWrite(Ring, &Data, 1);
+}
+
+/* Producer: claims a contiguous free region of up to Length bytes, returns its
+ * length (0 if full). Fill it, then call RINGBUF_voidMpscCommit in any case */
+static inline u32 RINGBUF_u32MpscReserve(ST_MpscRingBuf_t *Ring, u32 Length, u8 **Region) {
+	u32 Local_u32Index;
+	u32 Local_u32Length = RINGBUF_u32MpscClaim(Ring, Length, TRUE, &Local_u32Index);
+
+	*Region = &Ring->Buffer[Local_u32Index & Ring->Mask];
+	return Local_u32Length;
+}
+
+static inline void RINGBUF_voidMpscCommit(ST_MpscRingBuf_t *Ring) {
+	RINGBUF_voidMpscPublish(Ring);
+}
+
+/* Consumer side, same contract as the single producer buffer */
+static inline u8 RINGBUF_u8MpscPop(ST_MpscRingBuf_t *Ring, u8 *Data) {
+	u32 Local_u32Tail = Ring->Tail;
+
+	if (ATOMIC_u32Load(&Ring->Head) == Local_u32Tail) {
+		return STD_NOK;
+	}
+	*Data = Ring->Buffer[Local_u32Tail & Ring->Mask];
+	ATOMIC_voidStore(&Ring->Tail, (Local_u32Tail + 1) & 0xFFFFFFFFUL);
+	return STD_OK;
+}
+
+static inline u32 RINGBUF_u32MpscRead(ST_MpscRingBuf_t *Ring, u8 *Data, u32 Length) {
+	u32 Local_u32Tail = Ring->Tail;
+	u32 Local_u32Used = (ATOMIC_u32Load(&Ring->Head) - Local_u32Tail) & 0xFFFFFFFFUL;
+
+	if (Length > Local_u32Used) {
+		Length = Local_u32Used;
+	}
+	RINGBUF_voidCopyOut(Ring->Buffer, Ring->Mask, Local_u32Tail, Data, Length);
+	ATOMIC_voidStore(&Ring->Tail, (Local_u32Tail + Length) & 0xFFFFFFFFUL);
+	return Length;
+}
+
+static inline u32 RINGBUF_u32MpscPeek(ST_MpscRingBuf_t *Ring, const u8 **Region) {
+	u32 Local_u32Tail = Ring->Tail;
+	u32 Local_u32Used = (ATOMIC_u32Load(&Ring->Head) - Local_u32Tail) & 0xFFFFFFFFUL;
+	u32 Local_u32ToEnd = Ring->Mask + 1 - (Local_u32Tail & Ring->Mask);
+
+	*Region = &Ring->Buffer[Local_u32Tail & Ring->Mask];
+	return (Local_u32Used < Local_u32ToEnd) ? Local_u32Used : Local_u32ToEnd;
+}
+
+static inline void RINGBUF_voidMpscConsume(ST_MpscRingBuf_t *Ring, u32 Length) {
+	ATOMIC_voidStore(&Ring->Tail, (Ring->Tail + Length) & 0xFFFFFFFFUL);
+}
+
+#endif
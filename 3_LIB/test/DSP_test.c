@@ -0,0 +1,385 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : DSP_test.c                       */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of DSP.h, built with the Makefile next to it. The host compiler
+ * does not define __ARM_FEATURE_DSP, so this runs the C emulation of the
+ * SIMD helpers (SMLALD, QADD16, QADD, the packed reads and writes).
+ *
+ * Every helper is checked against plain integer arithmetic over all the
+ * combinations of the edge values (0x8000, 0x7FFF, 0, +/-1 and the halves),
+ * then the SIMD kernels are checked bit for bit against their Ref versions
+ * on random blocks salted with full scale samples and odd lengths.
+ * The inline assembly itself is not covered, it only builds for the M4.
+ *
+ * Then the FIR, biquad and dot product kernels are timed against their Ref
+ * versions on BENCH_BLOCK sample blocks and printed in samples per second.
+ * On the host the SIMD kernels run the C emulation, so the ratio printed
+ * here says nothing about the M4; it only tracks that neither path gets
+ * slower from one change to the next. */
+
+#include "STD_TYPES.h"
+#include "DSP.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define TEST_BLOCK          67
+#define TEST_TAPS           13
+#define TEST_RUNS           200
+
+#define BENCH_BLOCK         256
+#define BENCH_TAPS          32
+#define BENCH_STAGES        4
+#define BENCH_SECONDS       0.2
+
+static const s16 Global_s16Edges[] = {
+    (s16)0x8000, (s16)0x8001, -16384, -2, -1, 0, 1, 2, 16383, 16384, 0x7FFE, 0x7FFF
+};
+#define TEST_EDGES          (sizeof(Global_s16Edges) / sizeof(Global_s16Edges[0]))
+
+static const s64 Global_s64Edges31[] = {
+    -2147483647LL - 1, -2147483647LL, -1073741824LL, -1, 0, 1, 1073741824LL, 2147483646LL, 2147483647LL
+};
+#define TEST_EDGES31        (sizeof(Global_s64Edges31) / sizeof(Global_s64Edges31[0]))
+
+static u32 Global_u32Failures = 0;
+static u32 Global_u32Seed = 1;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* Plain clamp, kept apart from DSP_q15Saturate / DSP_q31Saturate under test */
+static s64 Test_s64Clamp(s64 Copy_s64Value, s64 Copy_s64Min, s64 Copy_s64Max)
+{
+    if (Copy_s64Value > Copy_s64Max)
+    {
+        return Copy_s64Max;
+    }
+    if (Copy_s64Value < Copy_s64Min)
+    {
+        return Copy_s64Min;
+    }
+    return Copy_s64Value;
+}
+
+static u32 Test_u32Pack(s16 Copy_s16Low, s16 Copy_s16High)
+{
+    return (u32)(u16)Copy_s16Low | ((u32)(u16)Copy_s16High << 16);
+}
+
+static s16 Test_s16Random(void)
+{
+    Global_u32Seed = (Global_u32Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    switch ((Global_u32Seed >> 8) & 0xF)
+    {
+    case 0:  return (s16)0x8000;
+    case 1:  return 0x7FFF;
+    default: return (s16)(Global_u32Seed >> 16);
+    }
+}
+
+static void Test_voidHelpers(void)
+{
+    u32 Local_u32A, Local_u32B, Local_u32C, Local_u32D;
+    u32 Local_u32X, Local_u32Y, Local_u32Sum;
+    s64 Local_s64Expected, Local_s64Value;
+    q15 Local_q15Pair[2];
+
+    for (Local_u32A = 0; Local_u32A < TEST_EDGES; Local_u32A++)
+    {
+        for (Local_u32B = 0; Local_u32B < TEST_EDGES; Local_u32B++)
+        {
+            s16 Local_s16XLow = Global_s16Edges[Local_u32A];
+            s16 Local_s16XHigh = Global_s16Edges[Local_u32B];
+
+            /* Packing round trip, the sign of both halves survives */
+            Local_u32X = Test_u32Pack(Local_s16XLow, Local_s16XHigh);
+            Local_q15Pair[0] = Local_s16XLow;
+            Local_q15Pair[1] = Local_s16XHigh;
+            CHECK(DSP_u32Read2(Local_q15Pair) == Local_u32X, "Read2(%d, %d)", Local_s16XLow, Local_s16XHigh);
+            Local_q15Pair[0] = 0;
+            Local_q15Pair[1] = 0;
+            DSP_voidWrite2(Local_q15Pair, Local_u32X);
+            CHECK((Local_q15Pair[0] == Local_s16XLow) && (Local_q15Pair[1] == Local_s16XHigh),
+                  "Write2(%d, %d) gave (%d, %d)", Local_s16XLow, Local_s16XHigh, Local_q15Pair[0], Local_q15Pair[1]);
+
+            for (Local_u32C = 0; Local_u32C < TEST_EDGES; Local_u32C++)
+            {
+                for (Local_u32D = 0; Local_u32D < TEST_EDGES; Local_u32D++)
+                {
+                    s16 Local_s16YLow = Global_s16Edges[Local_u32C];
+                    s16 Local_s16YHigh = Global_s16Edges[Local_u32D];
+
+                    Local_u32Y = Test_u32Pack(Local_s16YLow, Local_s16YHigh);
+
+                    /* 0x8000 * 0x8000 twice is +2^31, it must not wrap */
+                    Local_s64Expected = 1000LL + ((s64)Local_s16XLow * Local_s16YLow) + ((s64)Local_s16XHigh * Local_s16YHigh);
+                    Local_s64Value = DSP_s64Smlald(Local_u32X, Local_u32Y, 1000LL);
+                    CHECK(Local_s64Value == Local_s64Expected, "Smlald(%d, %d, %d, %d) = %lld, expected %lld",
+                          Local_s16XLow, Local_s16XHigh, Local_s16YLow, Local_s16YHigh, Local_s64Value, Local_s64Expected);
+
+                    Local_u32Sum = DSP_u32Qadd16(Local_u32X, Local_u32Y);
+                    CHECK(Local_u32Sum == Test_u32Pack((s16)Test_s64Clamp((s64)Local_s16XLow + Local_s16YLow, -32768, 32767),
+                                                       (s16)Test_s64Clamp((s64)Local_s16XHigh + Local_s16YHigh, -32768, 32767)),
+                          "Qadd16(%d, %d, %d, %d) = 0x%08lx", Local_s16XLow, Local_s16XHigh, Local_s16YLow, Local_s16YHigh,
+                          (unsigned long)Local_u32Sum);
+                }
+            }
+        }
+    }
+
+    for (Local_u32A = 0; Local_u32A < TEST_EDGES31; Local_u32A++)
+    {
+        for (Local_u32B = 0; Local_u32B < TEST_EDGES31; Local_u32B++)
+        {
+            Local_s64Expected = Test_s64Clamp(Global_s64Edges31[Local_u32A] + Global_s64Edges31[Local_u32B], -2147483647LL - 1, 2147483647LL);
+            Local_s64Value = DSP_q31Qadd((q31)Global_s64Edges31[Local_u32A], (q31)Global_s64Edges31[Local_u32B]);
+            CHECK(Local_s64Value == Local_s64Expected, "Qadd(%lld, %lld) = %lld", Global_s64Edges31[Local_u32A],
+                  Global_s64Edges31[Local_u32B], Local_s64Value);
+        }
+    }
+
+    /* Saturation exactly at, one past and far past both bounds */
+    {
+        static const s64 Local_s64Values[] = {
+            -9223372036854775807LL - 1, -4294967296LL, -2147483649LL, -2147483647LL - 1, -32769, -32768, -32767,
+            -1, 0, 1, 32766, 32767, 32768, 2147483647LL, 2147483648LL, 4294967296LL, 9223372036854775807LL
+        };
+
+        for (Local_u32A = 0; Local_u32A < (sizeof(Local_s64Values) / sizeof(Local_s64Values[0])); Local_u32A++)
+        {
+            Local_s64Value = Local_s64Values[Local_u32A];
+            CHECK(DSP_q15Saturate(Local_s64Value) == Test_s64Clamp(Local_s64Value, -32768, 32767),
+                  "q15Saturate(%lld) = %d", Local_s64Value, DSP_q15Saturate(Local_s64Value));
+            CHECK((s64)DSP_q31Saturate(Local_s64Value) == Test_s64Clamp(Local_s64Value, -2147483647LL - 1, 2147483647LL),
+                  "q31Saturate(%lld) = %lld", Local_s64Value, (s64)DSP_q31Saturate(Local_s64Value));
+        }
+    }
+}
+
+static u8 Test_u8Same(const q15 *Copy_pq15A, const q15 *Copy_pq15B, u32 Copy_u32Length)
+{
+    u32 Local_u32Idx;
+
+    for (Local_u32Idx = 0; Local_u32Idx < Copy_u32Length; Local_u32Idx++)
+    {
+        if (Copy_pq15A[Local_u32Idx] != Copy_pq15B[Local_u32Idx])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void Test_voidKernels(void)
+{
+    /* 3 stages, the last one with a gain above 1 to reach saturation */
+    static const q15 Local_q15Biquad[15] = {
+        8192, 16384, 8192, 29491, -13107,
+        (s16)0x8000, 0x7FFF, (s16)0x8000, 0x7FFF, (s16)0x8000,
+        0x7FFF, 0x7FFF, 0x7FFF, 0, 0
+    };
+    q15 Local_q15A[TEST_BLOCK + 1], Local_q15B[TEST_BLOCK + 1], Local_q15Coeffs[TEST_TAPS];
+    q15 Local_q15Out[TEST_BLOCK], Local_q15OutRef[TEST_BLOCK];
+    q15 Local_q15State[TEST_TAPS - 1 + TEST_BLOCK], Local_q15StateRef[TEST_TAPS - 1 + TEST_BLOCK];
+    q15 Local_q15DecimState[TEST_TAPS - 1 + TEST_BLOCK], Local_q15DecimStateRef[TEST_TAPS - 1 + TEST_BLOCK];
+    q15 Local_q15BiquadState[12], Local_q15BiquadStateRef[12];
+    ST_DspFirQ15_t Local_Fir, Local_FirRef;
+    ST_DspFirDecimQ15_t Local_Decim, Local_DecimRef;
+    ST_DspBiquadQ15_t Local_Biquad, Local_BiquadRef;
+    ST_DspStatsQ15_t Local_Stats, Local_StatsRef;
+    u32 Local_u32Run, Local_u32Idx, Local_u32Length, Local_u32Offset;
+
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TAPS; Local_u32Idx++)
+    {
+        Local_q15Coeffs[Local_u32Idx] = Test_s16Random();
+    }
+    DSP_voidFirInitQ15(&Local_Fir, Local_q15Coeffs, Local_q15State, TEST_TAPS);
+    DSP_voidFirInitQ15(&Local_FirRef, Local_q15Coeffs, Local_q15StateRef, TEST_TAPS);
+    (void)DSP_u8FirDecimInitQ15(&Local_Decim, Local_q15Coeffs, Local_q15DecimState, TEST_TAPS, 3);
+    (void)DSP_u8FirDecimInitQ15(&Local_DecimRef, Local_q15Coeffs, Local_q15DecimStateRef, TEST_TAPS, 3);
+    DSP_voidBiquadInitQ15(&Local_Biquad, Local_q15Biquad, Local_q15BiquadState, 3, 1);
+    DSP_voidBiquadInitQ15(&Local_BiquadRef, Local_q15Biquad, Local_q15BiquadStateRef, 3, 1);
+
+    for (Local_u32Run = 0; Local_u32Run < TEST_RUNS; Local_u32Run++)
+    {
+        /* Odd lengths leave a tail sample, an offset of 1 makes the pairs unaligned */
+        Local_u32Length = 1 + (Local_u32Run % TEST_BLOCK);
+        Local_u32Offset = Local_u32Run & 1;
+        for (Local_u32Idx = 0; Local_u32Idx < (TEST_BLOCK + 1); Local_u32Idx++)
+        {
+            Local_q15A[Local_u32Idx] = Test_s16Random();
+            Local_q15B[Local_u32Idx] = Test_s16Random();
+        }
+
+        DSP_voidAddQ15(&Local_q15A[Local_u32Offset], &Local_q15B[Local_u32Offset], Local_q15Out, Local_u32Length);
+        DSP_voidAddQ15Ref(&Local_q15A[Local_u32Offset], &Local_q15B[Local_u32Offset], Local_q15OutRef, Local_u32Length);
+        CHECK(Test_u8Same(Local_q15Out, Local_q15OutRef, Local_u32Length), "AddQ15, run %lu", (unsigned long)Local_u32Run);
+
+        CHECK(DSP_q63DotQ15(&Local_q15A[Local_u32Offset], &Local_q15B[Local_u32Offset], Local_u32Length)
+              == DSP_q63DotQ15Ref(&Local_q15A[Local_u32Offset], &Local_q15B[Local_u32Offset], Local_u32Length),
+              "DotQ15, run %lu", (unsigned long)Local_u32Run);
+
+        DSP_voidStatsQ15(&Local_q15A[Local_u32Offset], Local_u32Length, &Local_Stats);
+        DSP_voidStatsQ15Ref(&Local_q15A[Local_u32Offset], Local_u32Length, &Local_StatsRef);
+        CHECK((Local_Stats.Power == Local_StatsRef.Power) && (Local_Stats.Mean == Local_StatsRef.Mean),
+              "StatsQ15, run %lu", (unsigned long)Local_u32Run);
+
+        /* The filters keep their history, the blocks chain across the runs */
+        DSP_voidFirQ15(&Local_Fir, Local_q15A, Local_q15Out, Local_u32Length);
+        DSP_voidFirQ15Ref(&Local_FirRef, Local_q15A, Local_q15OutRef, Local_u32Length);
+        CHECK(Test_u8Same(Local_q15Out, Local_q15OutRef, Local_u32Length), "FirQ15, run %lu", (unsigned long)Local_u32Run);
+
+        DSP_voidFirDecimQ15(&Local_Decim, Local_q15B, Local_q15Out, (Local_u32Length / 3) * 3);
+        DSP_voidFirDecimQ15Ref(&Local_DecimRef, Local_q15B, Local_q15OutRef, (Local_u32Length / 3) * 3);
+        CHECK(Test_u8Same(Local_q15Out, Local_q15OutRef, Local_u32Length / 3), "FirDecimQ15, run %lu", (unsigned long)Local_u32Run);
+
+        DSP_voidBiquadQ15(&Local_Biquad, Local_q15A, Local_q15Out, Local_u32Length);
+        DSP_voidBiquadQ15Ref(&Local_BiquadRef, Local_q15A, Local_q15OutRef, Local_u32Length);
+        CHECK(Test_u8Same(Local_q15Out, Local_q15OutRef, Local_u32Length)
+              && Test_u8Same(Local_q15BiquadState, Local_q15BiquadStateRef, 12), "BiquadQ15, run %lu", (unsigned long)Local_u32Run);
+    }
+}
+
+/****************************************************/
+/* Timing                                           */
+/****************************************************/
+
+typedef enum {
+    BENCH_FIR,
+    BENCH_BIQUAD,
+    BENCH_DOT
+} Bench_Kernel_e;
+
+static q15 Global_q15BenchIn[BENCH_BLOCK];
+static q15 Global_q15BenchOut[BENCH_BLOCK];
+static q15 Global_q15BenchTaps[BENCH_TAPS];
+static q15 Global_q15BenchFirState[BENCH_TAPS - 1 + BENCH_BLOCK];
+static q15 Global_q15BenchBiquadState[BENCH_STAGES * 4];
+static ST_DspFirQ15_t Global_BenchFir;
+static ST_DspBiquadQ15_t Global_BenchBiquad;
+
+/* Keeps the results alive so the timed loops are not optimized out, and
+ * hides the block length from the compiler as a run-time length would be */
+static volatile q63 Global_q63BenchSink;
+static volatile u32 Global_u32BenchLength = BENCH_BLOCK;
+
+static f64 Bench_f64Seconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return (f64)Local_Time.tv_sec + ((f64)Local_Time.tv_nsec * 1e-9);
+}
+
+/* Runs Copy_u32Blocks blocks of one kernel, the SIMD or the Ref version */
+static void Bench_voidBlocks(Bench_Kernel_e Copy_Kernel, u8 Copy_u8Ref, u32 Copy_u32Blocks)
+{
+    u32 Local_u32Block, Local_u32Length = Global_u32BenchLength;
+    q63 Local_q63Sum = 0;
+
+    for (Local_u32Block = 0; Local_u32Block < Copy_u32Blocks; Local_u32Block++)
+    {
+        switch (Copy_Kernel)
+        {
+        case BENCH_FIR:
+            if (Copy_u8Ref == TRUE)
+            {
+                DSP_voidFirQ15Ref(&Global_BenchFir, Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            else
+            {
+                DSP_voidFirQ15(&Global_BenchFir, Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            Local_q63Sum += Global_q15BenchOut[Local_u32Block % Local_u32Length];
+            break;
+        case BENCH_BIQUAD:
+            if (Copy_u8Ref == TRUE)
+            {
+                DSP_voidBiquadQ15Ref(&Global_BenchBiquad, Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            else
+            {
+                DSP_voidBiquadQ15(&Global_BenchBiquad, Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            Local_q63Sum += Global_q15BenchOut[Local_u32Block % Local_u32Length];
+            break;
+        default:
+            if (Copy_u8Ref == TRUE)
+            {
+                Local_q63Sum += DSP_q63DotQ15Ref(Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            else
+            {
+                Local_q63Sum += DSP_q63DotQ15(Global_q15BenchIn, Global_q15BenchOut, Local_u32Length);
+            }
+            break;
+        }
+    }
+    Global_q63BenchSink = Local_q63Sum;
+}
+
+/* Doubles the block count until the run lasts BENCH_SECONDS, returns samples per second */
+static f64 Bench_f64Rate(Bench_Kernel_e Copy_Kernel, u8 Copy_u8Ref)
+{
+    u32 Local_u32Blocks = 16;
+    f64 Local_f64Start, Local_f64Time;
+
+    for (;;)
+    {
+        Local_f64Start = Bench_f64Seconds();
+        Bench_voidBlocks(Copy_Kernel, Copy_u8Ref, Local_u32Blocks);
+        Local_f64Time = Bench_f64Seconds() - Local_f64Start;
+        if (Local_f64Time >= BENCH_SECONDS)
+        {
+            return ((f64)Local_u32Blocks * BENCH_BLOCK) / Local_f64Time;
+        }
+        Local_u32Blocks *= 2;
+    }
+}
+
+static void Bench_voidKernels(void)
+{
+    static const char *const Local_pcNames[] = { "FIR 32 taps", "biquad 4 stages", "dot product" };
+    static const q15 Local_q15Stage[5] = { 8192, 16384, 8192, 29491, -13107 };
+    q15 Local_q15Biquad[BENCH_STAGES * 5];
+    u32 Local_u32Idx;
+    f64 Local_f64Simd, Local_f64Ref;
+
+    for (Local_u32Idx = 0; Local_u32Idx < BENCH_BLOCK; Local_u32Idx++)
+    {
+        Global_q15BenchIn[Local_u32Idx] = Test_s16Random();
+        Global_q15BenchOut[Local_u32Idx] = Test_s16Random();
+    }
+    for (Local_u32Idx = 0; Local_u32Idx < BENCH_TAPS; Local_u32Idx++)
+    {
+        Global_q15BenchTaps[Local_u32Idx] = Test_s16Random() / BENCH_TAPS;
+    }
+    for (Local_u32Idx = 0; Local_u32Idx < (BENCH_STAGES * 5); Local_u32Idx++)
+    {
+        Local_q15Biquad[Local_u32Idx] = Local_q15Stage[Local_u32Idx % 5];
+    }
+    DSP_voidFirInitQ15(&Global_BenchFir, Global_q15BenchTaps, Global_q15BenchFirState, BENCH_TAPS);
+    DSP_voidBiquadInitQ15(&Global_BenchBiquad, Local_q15Biquad, Global_q15BenchBiquadState, BENCH_STAGES, 1);
+
+    for (Local_u32Idx = BENCH_FIR; Local_u32Idx <= BENCH_DOT; Local_u32Idx++)
+    {
+        Local_f64Simd = Bench_f64Rate((Bench_Kernel_e)Local_u32Idx, FALSE);
+        Local_f64Ref = Bench_f64Rate((Bench_Kernel_e)Local_u32Idx, TRUE);
+        printf("%-16s %7.1f Msamples/s, Ref %7.1f Msamples/s (x%.2f)\n", Local_pcNames[Local_u32Idx],
+               Local_f64Simd * 1e-6, Local_f64Ref * 1e-6, Local_f64Simd / Local_f64Ref);
+    }
+}
+
+int main(void)
+{
+    Test_voidHelpers();
+    Test_voidKernels();
+    Bench_voidKernels();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : POOL_bench.c                     */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host benchmark of POOL.h against malloc/free, built with the Makefile next
+ * to it. The same random workload (allocs and frees interleaved, up to
+ * BENCH_LIVE blocks of 8 to 256 bytes alive) runs on malloc, on one pool of
+ * the largest size, and on a pool set of four size classes. Each block is
+ * stamped while alive and checked on free, so a block handed out twice fails
+ * the run. A step is one draw, free, alloc and stamp.
+ *
+ * Two passes per allocator. The throughput pass times batches of
+ * BENCH_BATCH steps between two clock reads and divides, so the clock costs
+ * nothing per step; it prints the mean over the run and the best batch. The
+ * latency pass times every step alone, takes off the cost of an empty pair
+ * of clock reads, and prints percentiles of the rest. On the host the top
+ * percentiles also hold scheduler preemption, and the numbers that matter
+ * are the target ones.
+ *
+ * Measured on the development PC (x86-64, gcc -O2), three runs, per step:
+ *   malloc     mean 33-48 ns, best batch 18-25 ns, p50 32-36 ns, p99 161-197 ns
+ *   pool       mean 57-58 ns, best batch 48-51 ns, p50 57-67 ns, p99 173-196 ns
+ *   pool set   mean 52-63 ns, best batch 44-49 ns, p50 66-74 ns, p99 138-200 ns
+ * On the PC the pool loses to malloc: each step pays four or five locked
+ * read-modify-writes (the free list CAS both ways, the use count, the high
+ * water mark) where glibc's thread cache takes none. On the target those
+ * are LDREX/STREX loops of a few cycles and malloc has no thread cache. */
+
+#include "STD_TYPES.h"
+#include "POOL.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_LIVE          256
+#define BENCH_OPS           2000000UL
+#define BENCH_BATCH         1000UL
+#define BENCH_SAMPLES       1000000UL
+#define BENCH_MAX_SIZE      256
+
+POOL_DEFINE(Bench_Pool, BENCH_MAX_SIZE, BENCH_LIVE);
+
+POOL_DEFINE(Bench_Pool32, 32, BENCH_LIVE);
+POOL_DEFINE(Bench_Pool64, 64, BENCH_LIVE);
+POOL_DEFINE(Bench_Pool128, 128, BENCH_LIVE);
+POOL_DEFINE(Bench_Pool256, 256, BENCH_LIVE);
+POOL_SET_DEFINE(Bench_Set, &Bench_Pool32, &Bench_Pool64, &Bench_Pool128, &Bench_Pool256);
+
+typedef enum {
+    BENCH_MALLOC,
+    BENCH_POOL,
+    BENCH_POOL_SET
+} Bench_Allocator_e;
+
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static u64 Bench_u64Nanoseconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return ((u64)Local_Time.tv_sec * 1000000000ULL) + (u64)Local_Time.tv_nsec;
+}
+
+static void *Bench_pvAlloc(Bench_Allocator_e Copy_Allocator, u32 Copy_u32Size)
+{
+    switch (Copy_Allocator)
+    {
+    case BENCH_MALLOC:  return malloc(Copy_u32Size);
+    case BENCH_POOL:    return POOL_pvAlloc(&Bench_Pool);
+    default:            return POOL_pvSetAlloc(&Bench_Set, Copy_u32Size);
+    }
+}
+
+static void Bench_voidFree(Bench_Allocator_e Copy_Allocator, void *pvBlock)
+{
+    switch (Copy_Allocator)
+    {
+    case BENCH_MALLOC:  free(pvBlock); break;
+    case BENCH_POOL:    POOL_voidFree(&Bench_Pool, pvBlock); break;
+    default:            (void)POOL_u8SetFree(&Bench_Set, pvBlock); break;
+    }
+}
+
+static u32 *Global_pu32Live[BENCH_LIVE];
+static u32 Global_u32Seed;
+static u32 Global_u32Samples[BENCH_SAMPLES];
+static u32 Global_u32ClockCost;
+
+/* Gives every live block back and restarts the workload */
+static void Bench_voidReset(Bench_Allocator_e Copy_Allocator)
+{
+    u32 Local_u32Slot;
+
+    for (Local_u32Slot = 0; Local_u32Slot < BENCH_LIVE; Local_u32Slot++)
+    {
+        if (Global_pu32Live[Local_u32Slot] != NULL)
+        {
+            Bench_voidFree(Copy_Allocator, Global_pu32Live[Local_u32Slot]);
+            Global_pu32Live[Local_u32Slot] = NULL;
+        }
+    }
+    Global_u32Seed = 1;
+}
+
+/* One step of the workload, STD_NOK if the alloc failed */
+static u8 Bench_u8Step(Bench_Allocator_e Copy_Allocator, const char *Copy_pcName)
+{
+    u32 Local_u32Slot, Local_u32Size;
+
+    Global_u32Seed = (Global_u32Seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    Local_u32Slot = (Global_u32Seed >> 16) % BENCH_LIVE;
+    Local_u32Size = 8 + ((Global_u32Seed >> 8) % (BENCH_MAX_SIZE - 7));
+
+    if (Global_pu32Live[Local_u32Slot] != NULL)
+    {
+        CHECK(Global_pu32Live[Local_u32Slot][0] == Local_u32Slot, "%s: block of slot %lu overwritten", Copy_pcName, (unsigned long)Local_u32Slot);
+        Bench_voidFree(Copy_Allocator, Global_pu32Live[Local_u32Slot]);
+    }
+    Global_pu32Live[Local_u32Slot] = (u32 *)Bench_pvAlloc(Copy_Allocator, Local_u32Size);
+    if (Global_pu32Live[Local_u32Slot] == NULL)
+    {
+        CHECK(0, "%s: alloc of %lu bytes failed", Copy_pcName, (unsigned long)Local_u32Size);
+        return STD_NOK;
+    }
+    Global_pu32Live[Local_u32Slot][0] = Local_u32Slot;
+    return STD_OK;
+}
+
+static int Bench_iCompare(const void *pvLeft, const void *pvRight)
+{
+    u32 Local_u32Left = *(const u32 *)pvLeft, Local_u32Right = *(const u32 *)pvRight;
+
+    return (Local_u32Left > Local_u32Right) - (Local_u32Left < Local_u32Right);
+}
+
+/* Sorts the samples and returns the one at Copy_u32PerMille of them */
+static u32 Bench_u32Percentile(u32 Copy_u32PerMille)
+{
+    return Global_u32Samples[((BENCH_SAMPLES - 1) * Copy_u32PerMille) / 1000];
+}
+
+/* Median of empty pairs of clock reads, taken off every latency sample */
+static void Bench_voidMeasureClock(void)
+{
+    u32 Local_u32Idx;
+    u64 Local_u64Start;
+
+    for (Local_u32Idx = 0; Local_u32Idx < BENCH_SAMPLES; Local_u32Idx++)
+    {
+        Local_u64Start = Bench_u64Nanoseconds();
+        Global_u32Samples[Local_u32Idx] = (u32)(Bench_u64Nanoseconds() - Local_u64Start);
+    }
+    qsort(Global_u32Samples, BENCH_SAMPLES, sizeof(Global_u32Samples[0]), Bench_iCompare);
+    Global_u32ClockCost = Bench_u32Percentile(500);
+    printf("clock read pair: %lu ns, taken off the latencies\n", (unsigned long)Global_u32ClockCost);
+}
+
+static void Bench_voidRun(Bench_Allocator_e Copy_Allocator, const char *Copy_pcName)
+{
+    u32 Local_u32Op, Local_u32Idx, Local_u32Time;
+    u64 Local_u64Start, Local_u64Time, Local_u64Total = 0, Local_u64Best = ~0ULL;
+
+    /* Throughput: batches of steps, the clock read once per batch */
+    Bench_voidReset(Copy_Allocator);
+    for (Local_u32Op = 0; Local_u32Op < BENCH_OPS; Local_u32Op += BENCH_BATCH)
+    {
+        Local_u64Start = Bench_u64Nanoseconds();
+        for (Local_u32Idx = 0; Local_u32Idx < BENCH_BATCH; Local_u32Idx++)
+        {
+            if (Bench_u8Step(Copy_Allocator, Copy_pcName) != STD_OK)
+            {
+                return;
+            }
+        }
+        Local_u64Time = Bench_u64Nanoseconds() - Local_u64Start;
+
+        Local_u64Total += Local_u64Time;
+        if (Local_u64Time < Local_u64Best)
+        {
+            Local_u64Best = Local_u64Time;
+        }
+    }
+
+    /* Latency: every step timed alone */
+    Bench_voidReset(Copy_Allocator);
+    for (Local_u32Idx = 0; Local_u32Idx < BENCH_SAMPLES; Local_u32Idx++)
+    {
+        Local_u64Start = Bench_u64Nanoseconds();
+        if (Bench_u8Step(Copy_Allocator, Copy_pcName) != STD_OK)
+        {
+            return;
+        }
+        Local_u32Time = (u32)(Bench_u64Nanoseconds() - Local_u64Start);
+        Global_u32Samples[Local_u32Idx] = (Local_u32Time > Global_u32ClockCost) ? (Local_u32Time - Global_u32ClockCost) : 0;
+    }
+    Bench_voidReset(Copy_Allocator);
+    qsort(Global_u32Samples, BENCH_SAMPLES, sizeof(Global_u32Samples[0]), Bench_iCompare);
+
+    printf("%-10s alloc + free: mean %5.1f ns, best batch %5.1f ns | p50 %lu, p99 %lu, p99.9 %lu, max %lu ns\n", Copy_pcName,
+           (f64)Local_u64Total / (f64)BENCH_OPS, (f64)Local_u64Best / (f64)BENCH_BATCH,
+           (unsigned long)Bench_u32Percentile(500), (unsigned long)Bench_u32Percentile(990),
+           (unsigned long)Bench_u32Percentile(999), (unsigned long)Global_u32Samples[BENCH_SAMPLES - 1]);
+}
+
+int main(void)
+{
+    ST_PoolStats_t Local_Stats;
+
+    Bench_voidMeasureClock();
+    Bench_voidRun(BENCH_MALLOC, "malloc");
+    Bench_voidRun(BENCH_POOL, "pool");
+    Bench_voidRun(BENCH_POOL_SET, "pool set");
+
+    /* Every block given back, the marks stay at the peak */
+    POOL_voidGetStats(&Bench_Pool, &Local_Stats);
+    CHECK((Local_Stats.Used == 0) && (Local_Stats.HighWater <= BENCH_LIVE) && (Local_Stats.Failures == 0),
+          "pool stats: used %lu, high water %lu, failures %lu", (unsigned long)Local_Stats.Used,
+          (unsigned long)Local_Stats.HighWater, (unsigned long)Local_Stats.Failures);
+    POOL_voidGetStats(&Bench_Pool32, &Local_Stats);
+    CHECK(Local_Stats.Used == 0, "pool set: %lu blocks of 32 bytes still used", (unsigned long)Local_Stats.Used);
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,393 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : RINGBUF_test.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host stress test and throughput run of RINGBUF.h, built with the Makefile
+ * next to it. Threads stand in for the ISRs and the main loop.
+ *
+ * SPSC: one producer streams a counting byte sequence through every producer
+ * call (push, write, reserve/commit), one consumer checks it through every
+ * consumer call (pop, read, peek/consume).
+ * MPSC: several producers send 8-byte records (producer, sequence, check)
+ * through write and reserve/commit, the consumer checks that every producer's
+ * records arrive whole and in order.
+ * Both start with the indices just below 2^32 so the run crosses the wrap.
+ * A thread finding the ring full or empty yields, so the run also completes
+ * on a single core, where it interleaves much like ISRs preempting code. */
+
+#include "STD_TYPES.h"
+#include "RINGBUF.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_CAPACITY       1024UL
+#define TEST_INDEX_START    0xFFFFF000UL
+#define SPSC_BYTES          4000000UL
+#define MPSC_PRODUCERS      4
+#define MPSC_RECORDS        250000UL
+#define MPSC_RECORD_SIZE    8
+#define BENCH_BYTES         100000000UL
+#define BENCH_BLOCK         64
+
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static u8 Global_u8Buffer[TEST_CAPACITY];
+static ST_RingBuf_t Global_Spsc;
+static ST_MpscRingBuf_t Global_Mpsc;
+
+/* Every producer has its own generator, rand() is not thread safe */
+static u32 Test_u32Random(u32 *Copy_pu32State)
+{
+    *Copy_pu32State = (*Copy_pu32State * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return *Copy_pu32State >> 16;
+}
+
+static f64 Bench_f64Seconds(void)
+{
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return (f64)Local_Time.tv_sec + ((f64)Local_Time.tv_nsec * 1e-9);
+}
+
+/****************************************************/
+/* SPSC                                             */
+/****************************************************/
+
+static void *Spsc_pvProducer(void *pvArg)
+{
+    u32 Local_u32Seed = 1;
+    u32 Local_u32Sent = 0;
+    u32 Local_u32Length, Local_u32Idx;
+    u8 Local_u8Block[64];
+    u8 *Local_pu8Region;
+
+    (void)pvArg;
+    while (Local_u32Sent < SPSC_BYTES)
+    {
+        if (RINGBUF_u32Free(&Global_Spsc) == 0)
+        {
+            sched_yield();
+        }
+        switch (Test_u32Random(&Local_u32Seed) % 3)
+        {
+        case 0:
+            if (RINGBUF_u8Push(&Global_Spsc, (u8)Local_u32Sent) == STD_OK)
+            {
+                Local_u32Sent++;
+            }
+            break;
+        case 1:
+            Local_u32Length = 1 + (Test_u32Random(&Local_u32Seed) % sizeof(Local_u8Block));
+            for (Local_u32Idx = 0; Local_u32Idx < Local_u32Length; Local_u32Idx++)
+            {
+                Local_u8Block[Local_u32Idx] = (u8)(Local_u32Sent + Local_u32Idx);
+            }
+            Local_u32Sent += RINGBUF_u32Write(&Global_Spsc, Local_u8Block, Local_u32Length);
+            break;
+        default:
+            Local_u32Length = RINGBUF_u32Reserve(&Global_Spsc, &Local_pu8Region);
+            if (Local_u32Length > (SPSC_BYTES - Local_u32Sent))
+            {
+                Local_u32Length = SPSC_BYTES - Local_u32Sent;
+            }
+            for (Local_u32Idx = 0; Local_u32Idx < Local_u32Length; Local_u32Idx++)
+            {
+                Local_pu8Region[Local_u32Idx] = (u8)(Local_u32Sent + Local_u32Idx);
+            }
+            RINGBUF_voidCommit(&Global_Spsc, Local_u32Length);
+            Local_u32Sent += Local_u32Length;
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void *Spsc_pvConsumer(void *pvArg)
+{
+    u32 Local_u32Seed = 2;
+    u32 Local_u32Received = 0;
+    u32 Local_u32Errors = 0;
+    u32 Local_u32Length, Local_u32Idx;
+    u8 Local_u8Block[64];
+    const u8 *Local_pu8Region;
+
+    (void)pvArg;
+    while (Local_u32Received < SPSC_BYTES)
+    {
+        if (RINGBUF_u32Used(&Global_Spsc) == 0)
+        {
+            sched_yield();
+        }
+        switch (Test_u32Random(&Local_u32Seed) % 3)
+        {
+        case 0:
+            if (RINGBUF_u8Pop(&Global_Spsc, Local_u8Block) == STD_OK)
+            {
+                Local_u32Errors += (Local_u8Block[0] != (u8)Local_u32Received);
+                Local_u32Received++;
+            }
+            break;
+        case 1:
+            Local_u32Length = RINGBUF_u32Read(&Global_Spsc, Local_u8Block, 1 + (Test_u32Random(&Local_u32Seed) % sizeof(Local_u8Block)));
+            for (Local_u32Idx = 0; Local_u32Idx < Local_u32Length; Local_u32Idx++)
+            {
+                Local_u32Errors += (Local_u8Block[Local_u32Idx] != (u8)(Local_u32Received + Local_u32Idx));
+            }
+            Local_u32Received += Local_u32Length;
+            break;
+        default:
+            Local_u32Length = RINGBUF_u32Peek(&Global_Spsc, &Local_pu8Region);
+            for (Local_u32Idx = 0; Local_u32Idx < Local_u32Length; Local_u32Idx++)
+            {
+                Local_u32Errors += (Local_pu8Region[Local_u32Idx] != (u8)(Local_u32Received + Local_u32Idx));
+            }
+            RINGBUF_voidConsume(&Global_Spsc, Local_u32Length);
+            Local_u32Received += Local_u32Length;
+            break;
+        }
+    }
+    CHECK(Local_u32Errors == 0, "SPSC: %lu bytes out of sequence", (unsigned long)Local_u32Errors);
+    return NULL;
+}
+
+static void Test_voidSpsc(void)
+{
+    pthread_t Local_Producer, Local_Consumer;
+
+    RINGBUF_u8Init(&Global_Spsc, Global_u8Buffer, TEST_CAPACITY);
+    Global_Spsc.Head = TEST_INDEX_START;
+    Global_Spsc.Tail = TEST_INDEX_START;
+
+    pthread_create(&Local_Producer, NULL, Spsc_pvProducer, NULL);
+    pthread_create(&Local_Consumer, NULL, Spsc_pvConsumer, NULL);
+    pthread_join(Local_Producer, NULL);
+    pthread_join(Local_Consumer, NULL);
+    CHECK(RINGBUF_u32Used(&Global_Spsc) == 0, "SPSC: %lu bytes left", (unsigned long)RINGBUF_u32Used(&Global_Spsc));
+}
+
+/****************************************************/
+/* MPSC                                             */
+/****************************************************/
+
+/* Record: producer, sequence (4 bytes), sequence check (3 bytes) */
+static void Mpsc_voidMakeRecord(u8 *Copy_pu8Record, u8 Copy_u8Producer, u32 Copy_u32Seq)
+{
+    Copy_pu8Record[0] = Copy_u8Producer;
+    Copy_pu8Record[1] = (u8)Copy_u32Seq;
+    Copy_pu8Record[2] = (u8)(Copy_u32Seq >> 8);
+    Copy_pu8Record[3] = (u8)(Copy_u32Seq >> 16);
+    Copy_pu8Record[4] = (u8)(Copy_u32Seq >> 24);
+    Copy_pu8Record[5] = (u8)~Copy_pu8Record[1];
+    Copy_pu8Record[6] = (u8)~Copy_pu8Record[2];
+    Copy_pu8Record[7] = (u8)(Copy_u8Producer ^ 0xA5);
+}
+
+static void *Mpsc_pvProducer(void *pvArg)
+{
+    u8 Local_u8Producer = (u8)(long)pvArg;
+    u32 Local_u32Seed = 100 + Local_u8Producer;
+    u32 Local_u32Seq = 0;
+    u8 Local_u8Record[MPSC_RECORD_SIZE];
+    u8 *Local_pu8Region;
+    u32 Local_u32Length;
+
+    while (Local_u32Seq < MPSC_RECORDS)
+    {
+        Mpsc_voidMakeRecord(Local_u8Record, Local_u8Producer, Local_u32Seq);
+        if ((Test_u32Random(&Local_u32Seed) & 1) != 0)
+        {
+            if (RINGBUF_u8MpscWrite(&Global_Mpsc, Local_u8Record, MPSC_RECORD_SIZE) == STD_OK)
+            {
+                Local_u32Seq++;
+            }
+            else
+            {
+                sched_yield();
+            }
+        }
+        else
+        {
+            /* Records tile the ring, so a contiguous claim is the whole record or nothing */
+            Local_u32Length = RINGBUF_u32MpscReserve(&Global_Mpsc, MPSC_RECORD_SIZE, &Local_pu8Region);
+            if (Local_u32Length == MPSC_RECORD_SIZE)
+            {
+                if ((Test_u32Random(&Local_u32Seed) % 8) == 0)
+                {
+                    sched_yield();  // preempted between claim and publish
+                }
+                __builtin_memcpy(Local_pu8Region, Local_u8Record, MPSC_RECORD_SIZE);
+                Local_u32Seq++;
+            }
+            RINGBUF_voidMpscCommit(&Global_Mpsc);
+            if (Local_u32Length == 0)
+            {
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void Test_voidMpsc(void)
+{
+    pthread_t Local_Producers[MPSC_PRODUCERS];
+    u32 Local_u32Next[MPSC_PRODUCERS] = { 0 };
+    u32 Local_u32Records = 0;
+    u32 Local_u32Errors = 0;
+    u8 Local_u8Record[MPSC_RECORD_SIZE];
+    u8 Local_u8Expected[MPSC_RECORD_SIZE];
+    long Local_Idx;
+
+    RINGBUF_u8MpscInit(&Global_Mpsc, Global_u8Buffer, TEST_CAPACITY);
+    Global_Mpsc.Reserved = TEST_INDEX_START;
+    Global_Mpsc.Head = TEST_INDEX_START;
+    Global_Mpsc.Tail = TEST_INDEX_START;
+
+    for (Local_Idx = 0; Local_Idx < MPSC_PRODUCERS; Local_Idx++)
+    {
+        pthread_create(&Local_Producers[Local_Idx], NULL, Mpsc_pvProducer, (void *)Local_Idx);
+    }
+
+    while (Local_u32Records < (MPSC_PRODUCERS * MPSC_RECORDS))
+    {
+        if (RINGBUF_u32MpscUsed(&Global_Mpsc) < MPSC_RECORD_SIZE)
+        {
+            sched_yield();
+            continue;
+        }
+        RINGBUF_u32MpscRead(&Global_Mpsc, Local_u8Record, MPSC_RECORD_SIZE);
+        if (Local_u8Record[0] >= MPSC_PRODUCERS)
+        {
+            Local_u32Errors++;
+        }
+        else
+        {
+            Mpsc_voidMakeRecord(Local_u8Expected, Local_u8Record[0], Local_u32Next[Local_u8Record[0]]++);
+            Local_u32Errors += (__builtin_memcmp(Local_u8Record, Local_u8Expected, MPSC_RECORD_SIZE) != 0);
+        }
+        Local_u32Records++;
+    }
+
+    for (Local_Idx = 0; Local_Idx < MPSC_PRODUCERS; Local_Idx++)
+    {
+        pthread_join(Local_Producers[Local_Idx], NULL);
+    }
+    CHECK(Local_u32Errors == 0, "MPSC: %lu records torn or out of order", (unsigned long)Local_u32Errors);
+    CHECK(RINGBUF_u32MpscUsed(&Global_Mpsc) == 0, "MPSC: %lu bytes left", (unsigned long)RINGBUF_u32MpscUsed(&Global_Mpsc));
+    CHECK(Global_Mpsc.Writers == 0, "MPSC: %lu writers left", (unsigned long)Global_Mpsc.Writers);
+}
+
+/****************************************************/
+/* THROUGHPUT                                       */
+/****************************************************/
+
+static void *Bench_pvSpscProducer(void *pvArg)
+{
+    static const u8 Local_u8Block[BENCH_BLOCK];
+    u32 Local_u32Sent = 0;
+
+    (void)pvArg;
+    while (Local_u32Sent < BENCH_BYTES)
+    {
+        if (RINGBUF_u32Write(&Global_Spsc, Local_u8Block, BENCH_BLOCK) == 0)
+        {
+            sched_yield();
+        }
+        else
+        {
+            Local_u32Sent += BENCH_BLOCK;
+        }
+    }
+    return NULL;
+}
+
+static void *Bench_pvMpscProducer(void *pvArg)
+{
+    static const u8 Local_u8Block[BENCH_BLOCK];
+    u32 Local_u32Sent = 0;
+
+    (void)pvArg;
+    while (Local_u32Sent < (BENCH_BYTES / MPSC_PRODUCERS))
+    {
+        if (RINGBUF_u8MpscWrite(&Global_Mpsc, Local_u8Block, BENCH_BLOCK) == STD_OK)
+        {
+            Local_u32Sent += BENCH_BLOCK;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void Bench_voidThroughput(void)
+{
+    pthread_t Local_Producers[MPSC_PRODUCERS];
+    u8 Local_u8Block[BENCH_BLOCK * 4];
+    u32 Local_u32Received = 0;
+    u32 Local_u32Length;
+    f64 Local_f64Start, Local_f64Spsc, Local_f64Mpsc;
+    long Local_Idx;
+
+    RINGBUF_u8Init(&Global_Spsc, Global_u8Buffer, TEST_CAPACITY);
+    Local_f64Start = Bench_f64Seconds();
+    pthread_create(&Local_Producers[0], NULL, Bench_pvSpscProducer, NULL);
+    while (Local_u32Received < BENCH_BYTES)
+    {
+        Local_u32Length = RINGBUF_u32Read(&Global_Spsc, Local_u8Block, sizeof(Local_u8Block));
+        if (Local_u32Length == 0)
+        {
+            sched_yield();
+        }
+        Local_u32Received += Local_u32Length;
+    }
+    pthread_join(Local_Producers[0], NULL);
+    Local_f64Spsc = Bench_f64Seconds() - Local_f64Start;
+
+    RINGBUF_u8MpscInit(&Global_Mpsc, Global_u8Buffer, TEST_CAPACITY);
+    Local_u32Received = 0;
+    Local_f64Start = Bench_f64Seconds();
+    for (Local_Idx = 0; Local_Idx < MPSC_PRODUCERS; Local_Idx++)
+    {
+        pthread_create(&Local_Producers[Local_Idx], NULL, Bench_pvMpscProducer, NULL);
+    }
+    while (Local_u32Received < BENCH_BYTES)
+    {
+        Local_u32Length = RINGBUF_u32MpscRead(&Global_Mpsc, Local_u8Block, sizeof(Local_u8Block));
+        if (Local_u32Length == 0)
+        {
+            sched_yield();
+        }
+        Local_u32Received += Local_u32Length;
+    }
+    for (Local_Idx = 0; Local_Idx < MPSC_PRODUCERS; Local_Idx++)
+    {
+        pthread_join(Local_Producers[Local_Idx], NULL);
+    }
+    Local_f64Mpsc = Bench_f64Seconds() - Local_f64Start;
+
+    printf("%lu-byte ring, %u-byte blocks: SPSC %.0f MB/s, MPSC (%u producers) %.0f MB/s\n",
+           (unsigned long)TEST_CAPACITY, BENCH_BLOCK, (f64)BENCH_BYTES / Local_f64Spsc / 1e6,
+           MPSC_PRODUCERS, (f64)BENCH_BYTES / Local_f64Mpsc / 1e6);
+}
+
+int main(void)
+{
+    Test_voidSpsc();
+    Test_voidMpsc();
+    Bench_voidThroughput();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : STIMER_config.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef STIMER_CONFIG_H_
+#define STIMER_CONFIG_H_
+
+/* Number of wheel levels, from 1 to 5
+ * Each level has 64 slots, the wheel spans 64^STIMER_LEVELS ticks directly;
+ * longer timeouts are parked in the last level and cascaded again. */
+#define STIMER_LEVELS       4
+
+#endif /* STIMER_CONFIG_H_ */
@@ -0,0 +1,81 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : STIMER_interface.h               */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef STIMER_INTERFACE_H_
+#define STIMER_INTERFACE_H_
+
+/**
+ * @brief Software timer object, allocated by the user (static or inside the
+ *        owning driver instance) and only handled through the STIMER APIs.
+ *        It must be zero-initialized before its first use.
+ */
+typedef struct STIMER_Timer_s
+{
+    struct STIMER_Timer_s  *Next;       /**< Next timer in the same wheel slot */
+    struct STIMER_Timer_s **PrevNext;   /**< Link pointing to this timer, NULL when not armed */
+    u32          Expiry;                /**< Absolute expiry tick */
+    u32          Period;                /**< Reload in ticks, 0 for one-shot */
+    CallBackFn_t pfHandler;             /**< Expiry callback (CALLBACK.h) */
+    void        *pvContext;             /**< Context passed to the callback */
+} STIMER_Timer_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Initializes the timing wheel and subscribes it to the SysTick interrupt,
+ *        one wheel tick per SysTick interrupt. SysTick must be running
+ *        (e.g. SysTick_voidStartFreeRunning).
+ */
+void STIMER_voidInit(void);
+
+/**
+ * @brief Arms a timer, re-arms it if it is already running. O(1).
+ * @param Copy_pTimer Timer object.
+ * @param Copy_u32Ticks Ticks until the first expiry (0 is handled as 1).
+ * @param Copy_u32Period Ticks between the next expiries, 0 for a one-shot timer.
+ * @param pfHandler Callback run from the SysTick interrupt on expiry.
+ * @param pvContext Context passed to the callback.
+ */
+void STIMER_voidStart(STIMER_Timer_t *Copy_pTimer, u32 Copy_u32Ticks, u32 Copy_u32Period,
+                      CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Cancels a timer, does nothing if it is not armed. O(1).
+ *        Safe from the callback of any timer, including its own.
+ * @param Copy_pTimer Timer object.
+ */
+void STIMER_voidStop(STIMER_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Checks whether a timer is armed.
+ * @param Copy_pTimer Timer object.
+ * @return TRUE if the timer is armed, FALSE otherwise.
+ */
+u8 STIMER_u8IsActive(const STIMER_Timer_t *Copy_pTimer);
+
+/**
+ * @brief Gets the current wheel tick (wraps after 2^32 ticks).
+ * @return The wheel tick count.
+ */
+u32 STIMER_u32GetTick(void);
+
+/**
+ * @brief Gets a lower bound of the ticks until the next timer expiry, from the
+ *        occupancy bitmaps of the wheel levels (a slot of an upper level
+ *        counts as due when it cascades).
+ * @return Ticks until the next expiry, 0xFFFFFFFF if no timer is armed.
+ */
+u32 STIMER_u32GetTicksToNextExpiry(void);
+
+/**
+ * @brief Idles the core until the next timer expiry or interrupt with the
+ *        SysTick interrupt suppressed (SysTick_voidTicklessIdle).
+ *        Call it from the idle branch of the main loop.
+ */
+void STIMER_voidIdle(void);
+
+#endif /* STIMER_INTERFACE_H_ */
@@ -0,0 +1,28 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : STIMER_private.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef STIMER_PRIVATE_H_
+#define STIMER_PRIVATE_H_
+
+/* Slots of one level */
+#define STIMER_SLOT_BITS            6
+#define STIMER_SLOTS                (1UL << STIMER_SLOT_BITS)
+#define STIMER_SLOT_MASK            (STIMER_SLOTS - 1)
+
+/* Bit position of the slot index of a level inside a tick value */
+#define STIMER_LEVEL_SHIFT(LEVEL)   ((LEVEL) * STIMER_SLOT_BITS)
+
+/* Slot of a tick value at a given level */
+#define STIMER_SLOT(TICK, LEVEL)    ( ((TICK) >> STIMER_LEVEL_SHIFT(LEVEL)) & STIMER_SLOT_MASK )
+
+/* Ticks spanned by the levels up to and including LEVEL */
+#define STIMER_LEVEL_SPAN(LEVEL)    ( 1ULL << STIMER_LEVEL_SHIFT((LEVEL) + 1) )
+
+/* Returned when no timer is armed */
+#define STIMER_NO_EXPIRY            (0xFFFFFFFFUL)
+
+#endif /* STIMER_PRIVATE_H_ */
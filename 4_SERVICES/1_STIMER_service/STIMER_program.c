@@ -0,0 +1,281 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : STIMER_program.c                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "NVIC_interface.h"
+#include "MSYSTICK_interface.h"
+
+/****************************************************/
+/* STIMER Directives                                */
+/****************************************************/
+#include "STIMER_interface.h"
+#include "STIMER_config.h"
+#include "STIMER_private.h"
+
+#if (STIMER_LEVELS < 1) || (STIMER_LEVELS > 5)
+#error "STIMER_LEVELS must be from 1 to 5"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static STIMER_Timer_t *Global_pSlots[STIMER_LEVELS][STIMER_SLOTS]; // Head of the timer list of each slot
+static u64 Global_u64Occupied[STIMER_LEVELS];                      // Non-empty slots of each level (bit n <=> slot n)
+static volatile u32 Global_u32Now = 0;                             // Current wheel tick
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Links a timer in the slot matching its expiry.
+ *        The level is the lowest one whose span covers the remaining time, so
+ *        the slot is reached (directly or by cascade) no later than the expiry.
+ *        Interrupts must be disabled or the caller must be the tick itself.
+ * @param Copy_pTimer: Timer with its Expiry set.
+ */
+static void STIMER_voidLink(STIMER_Timer_t *Copy_pTimer) {
+    u32 Local_u32Delta = Copy_pTimer->Expiry - Global_u32Now;
+    u32 Local_u32SlotTick = Copy_pTimer->Expiry;
+    u8 Local_u8Level = 0;
+    u8 Local_u8Slot;
+    STIMER_Timer_t **Local_ppHead;
+
+    while ((Local_u8Level < (STIMER_LEVELS - 1)) && ((u64)Local_u32Delta >= STIMER_LEVEL_SPAN(Local_u8Level))) {
+        Local_u8Level++;
+    }
+    if ((u64)Local_u32Delta >= STIMER_LEVEL_SPAN(Local_u8Level)) {
+        // Beyond the wheel: park in the last slot reached, it is cascaded again from there
+        Local_u32SlotTick = Global_u32Now + (u32)(STIMER_LEVEL_SPAN(Local_u8Level) - 1);
+    }
+
+    Local_u8Slot = (u8)STIMER_SLOT(Local_u32SlotTick, Local_u8Level);
+    Local_ppHead = &Global_pSlots[Local_u8Level][Local_u8Slot];
+
+    Copy_pTimer->Next = *Local_ppHead;
+    if (*Local_ppHead != NULL) {
+        (*Local_ppHead)->PrevNext = &Copy_pTimer->Next;
+    }
+    Copy_pTimer->PrevNext = Local_ppHead;
+    *Local_ppHead = Copy_pTimer;
+    Global_u64Occupied[Local_u8Level] |= (1ULL << Local_u8Slot);
+}
+
+/**
+ * @brief Unlinks an armed timer from its list.
+ *        The occupancy bit is refreshed lazily: a slot found empty is cleared
+ *        the next time it is served.
+ * @param Copy_pTimer: Armed timer.
+ */
+static inline void STIMER_voidUnlink(STIMER_Timer_t *Copy_pTimer) {
+    *Copy_pTimer->PrevNext = Copy_pTimer->Next;
+    if (Copy_pTimer->Next != NULL) {
+        Copy_pTimer->Next->PrevNext = Copy_pTimer->PrevNext;
+    }
+    Copy_pTimer->PrevNext = NULL;
+}
+
+/**
+ * @brief Detaches the whole list of a slot in O(1).
+ * @param Copy_u8Level: Wheel level.
+ * @param Copy_u8Slot: Slot in the level.
+ * @param Copy_ppList: Receives the list, its first timer now links from it.
+ */
+static inline void STIMER_voidDetachSlot(u8 Copy_u8Level, u8 Copy_u8Slot, STIMER_Timer_t **Copy_ppList) {
+    *Copy_ppList = Global_pSlots[Copy_u8Level][Copy_u8Slot];
+    Global_pSlots[Copy_u8Level][Copy_u8Slot] = NULL;
+    Global_u64Occupied[Copy_u8Level] &= ~(1ULL << Copy_u8Slot);
+    if (*Copy_ppList != NULL) {
+        (*Copy_ppList)->PrevNext = Copy_ppList;
+    }
+}
+
+/**
+ * @brief Moves the timers of the current slot of a level down the wheel.
+ * @param Copy_u8Level: Level to cascade (1 or more).
+ */
+static void STIMER_voidCascade(u8 Copy_u8Level) {
+    STIMER_Timer_t *Local_pList;
+    STIMER_Timer_t *Local_pTimer;
+
+    STIMER_voidDetachSlot(Copy_u8Level, (u8)STIMER_SLOT(Global_u32Now, Copy_u8Level), &Local_pList);
+    while (Local_pList != NULL) {
+        Local_pTimer = Local_pList;
+        STIMER_voidUnlink(Local_pTimer);
+        STIMER_voidLink(Local_pTimer);
+    }
+}
+
+/**
+ * @brief Advances the wheel one tick.
+ *        Higher levels are cascaded when the lower ones wrap, then all the
+ *        timers of the current level 0 slot expire as one batch. A callback
+ *        may start or stop any timer, including those of the same batch.
+ */
+static void STIMER_voidStep(void) {
+    STIMER_Timer_t *Local_pList;
+    STIMER_Timer_t *Local_pTimer;
+    u8 Local_u8Level;
+    u32 Local_u32Now = Global_u32Now + 1;
+
+    Global_u32Now = Local_u32Now;
+
+    for (Local_u8Level = 1; Local_u8Level < STIMER_LEVELS; Local_u8Level++) {
+        if ((Local_u32Now & ((1UL << STIMER_LEVEL_SHIFT(Local_u8Level)) - 1)) != 0) {
+            break;
+        }
+        STIMER_voidCascade(Local_u8Level);
+    }
+
+    STIMER_voidDetachSlot(0, (u8)STIMER_SLOT(Local_u32Now, 0), &Local_pList);
+    while (Local_pList != NULL) {
+        Local_pTimer = Local_pList;
+        STIMER_voidUnlink(Local_pTimer);
+
+        if (Local_pTimer->Expiry != Local_u32Now) {
+            // Parked beyond the wheel range and not due yet
+            STIMER_voidLink(Local_pTimer);
+            continue;
+        }
+        if (Local_pTimer->Period != 0) {
+            // Re-armed before the callback, which may still stop it
+            Local_pTimer->Expiry += Local_pTimer->Period;
+            STIMER_voidLink(Local_pTimer);
+        }
+        Local_pTimer->pfHandler(Local_pTimer->pvContext);
+    }
+}
+
+/**
+ * @brief Advances the wheel by the periods of the SysTick interrupt, subscribed
+ *        to it. After tickless idle these are many: the ticks before the next
+ *        slot to serve only move the time, so they are skipped in one step and
+ *        just the ticks that serve a slot are stepped through.
+ * @param pvContext: Not used.
+ */
+static void STIMER_voidTick(void *pvContext) {
+    u32 Local_u32Periods = SysTick_u32GetElapsedPeriods();
+    u32 Local_u32Skip;
+
+    (void)pvContext;
+    while (Local_u32Periods != 0) {
+        Local_u32Skip = STIMER_u32GetTicksToNextExpiry() - 1;
+        if (Local_u32Skip >= Local_u32Periods) {
+            Global_u32Now += Local_u32Periods;
+            break;
+        }
+        Global_u32Now += Local_u32Skip;
+        Local_u32Periods -= Local_u32Skip + 1;
+        STIMER_voidStep();
+    }
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+void STIMER_voidInit(void) {
+    u8 Local_u8Level;
+    u8 Local_u8Slot;
+
+    for (Local_u8Level = 0; Local_u8Level < STIMER_LEVELS; Local_u8Level++) {
+        for (Local_u8Slot = 0; Local_u8Slot < STIMER_SLOTS; Local_u8Slot++) {
+            Global_pSlots[Local_u8Level][Local_u8Slot] = NULL;
+        }
+        Global_u64Occupied[Local_u8Level] = 0;
+    }
+    Global_u32Now = 0;
+
+    SysTick_u8Subscribe(STIMER_voidTick, NULL);
+}
+
+void STIMER_voidStart(STIMER_Timer_t *Copy_pTimer, u32 Copy_u32Ticks, u32 Copy_u32Period,
+                      CallBackFn_t pfHandler, void *pvContext) {
+    u32 Local_u32State;
+
+    if ((Copy_pTimer == NULL) || (pfHandler == NULL)) {
+        return;
+    }
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Copy_pTimer->PrevNext != NULL) {
+        STIMER_voidUnlink(Copy_pTimer);
+    }
+    Copy_pTimer->Period = Copy_u32Period;
+    Copy_pTimer->pfHandler = pfHandler;
+    Copy_pTimer->pvContext = pvContext;
+    Copy_pTimer->Expiry = Global_u32Now + ((Copy_u32Ticks != 0) ? Copy_u32Ticks : 1);
+    STIMER_voidLink(Copy_pTimer);
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+}
+
+void STIMER_voidStop(STIMER_Timer_t *Copy_pTimer) {
+    u32 Local_u32State;
+
+    if (Copy_pTimer == NULL) {
+        return;
+    }
+
+    Local_u32State = MNVIC_u32DisableInterrupts();
+    if (Copy_pTimer->PrevNext != NULL) {
+        STIMER_voidUnlink(Copy_pTimer);
+    }
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+}
+
+u8 STIMER_u8IsActive(const STIMER_Timer_t *Copy_pTimer) {
+    return ((Copy_pTimer != NULL) && (Copy_pTimer->PrevNext != NULL)) ? TRUE : FALSE;
+}
+
+u32 STIMER_u32GetTick(void) {
+    return Global_u32Now;
+}
+
+u32 STIMER_u32GetTicksToNextExpiry(void) {
+    u32 Local_u32Now = Global_u32Now;
+    u32 Local_u32Best = STIMER_NO_EXPIRY;
+    u8 Local_u8Level;
+
+    for (Local_u8Level = 0; Local_u8Level < STIMER_LEVELS; Local_u8Level++) {
+        u64 Local_u64Occupied = Global_u64Occupied[Local_u8Level];
+        u8 Local_u8Shift = STIMER_LEVEL_SHIFT(Local_u8Level);
+        u8 Local_u8Start;
+        u32 Local_u32Steps, Local_u32Ticks;
+
+        if (Local_u64Occupied == 0) {
+            continue;
+        }
+
+        // Rotate so bit 0 is the slot after the current one, the first set bit gives the distance
+        Local_u8Start = (u8)((STIMER_SLOT(Local_u32Now, Local_u8Level) + 1) & STIMER_SLOT_MASK);
+        if (Local_u8Start != 0) {
+            Local_u64Occupied = (Local_u64Occupied >> Local_u8Start) | (Local_u64Occupied << (STIMER_SLOTS - Local_u8Start));
+        }
+        Local_u32Steps = (u32)__builtin_ctzll(Local_u64Occupied) + 1;
+
+        // Ticks until the slot is served: aligned start of the slot minus now
+        Local_u32Ticks = (((Local_u32Now >> Local_u8Shift) + Local_u32Steps) << Local_u8Shift) - Local_u32Now;
+        if (Local_u32Ticks < Local_u32Best) {
+            Local_u32Best = Local_u32Ticks;
+        }
+    }
+
+    return Local_u32Best;
+}
+
+void STIMER_voidIdle(void) {
+    SysTick_voidTicklessIdle(STIMER_u32GetTicksToNextExpiry);
+}
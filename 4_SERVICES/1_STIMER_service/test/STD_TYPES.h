@@ -0,0 +1,30 @@
+#ifndef _STD_TYPES_H_ 
+#define _STD_TYPES_H_ 
+
+/* 3_LIB/STD_TYPES.h with the widths of the target: the host long is 64
+ * bits, and the tick arithmetic of the wheel relies on u32 wrapping at 2^32 */
+
+typedef unsigned  char         u8 ; 
+typedef signed    char         s8 ; 
+
+typedef unsigned  short       u16 ; 
+typedef signed    short       s16 ; 
+
+typedef unsigned  int         u32 ; 
+typedef signed    int         s32 ; 
+
+typedef unsigned  long long   u64 ; 
+typedef signed    long long   s64 ; 
+
+typedef float                 f32 ; 
+typedef double                f64 ;
+
+#define TRUE                     1
+#define FALSE                    0
+
+#define STD_OK 1
+#define STD_NOK 0
+
+#define  NULL                    (void *)0   /* NULL --> void pointer point to zero */
+
+#endif
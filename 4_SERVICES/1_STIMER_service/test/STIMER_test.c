@@ -0,0 +1,290 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : STIMER_test.c                    */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the timer wheel, built with the Makefile next to it.
+ *
+ * The service is compiled in with the NVIC and SysTick drivers stubbed, the
+ * SysTick interrupt being a direct call of the subscribed tick with a number
+ * of elapsed periods. Every timer records the tick it must fire at and checks
+ * it in its callback. What runs on the host is:
+ * - insertion on every level and expiry at the exact tick, in tick order;
+ * - cancellation, from thread code and from the callback of another timer
+ *   of the same batch, and periodic timers stopping themselves;
+ * - timeouts beyond the span of the wheel, parked and cascaded again;
+ * - the wrap of the tick at 2^32 (u32 has the target width here, see the
+ *   STD_TYPES.h next to this file);
+ * - many periods per interrupt as after tickless idle, with the time to
+ *   the next expiry never above the real one. */
+
+#include "STD_TYPES.h"
+#include "CALLBACK.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "STIMER_program.c"
+
+/****************************************************/
+/* STUBS                                            */
+/****************************************************/
+static CallBackFn_t Host_pfTick = NULL;     // subscribed SysTick callback
+static u32 Host_u32Periods = 1;             // periods of the interrupt being handled
+
+u32 MNVIC_u32DisableInterrupts(void) {
+    return 0;
+}
+
+void MNVIC_voidRestoreInterrupts(u32 Copy_u32State) {
+    (void)Copy_u32State;
+}
+
+u8 SysTick_u8Subscribe(CallBackFn_t pfHandler, void *pvContext) {
+    (void)pvContext;
+    Host_pfTick = pfHandler;
+    return STD_OK;
+}
+
+u32 SysTick_u32GetElapsedPeriods(void) {
+    return Host_u32Periods;
+}
+
+void SysTick_voidTicklessIdle(u32 (*pfGetIdlePeriods)(void)) {
+    (void)pfGetIdlePeriods;
+}
+
+/* One SysTick interrupt accounting Copy_u32Periods periods */
+static void Host_voidInterrupt(u32 Copy_u32Periods) {
+    Host_u32Periods = Copy_u32Periods;
+    Host_pfTick(NULL);
+}
+
+/****************************************************/
+/* HELPERS                                          */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#define TEST_TIMERS     2000
+
+typedef struct {
+    STIMER_Timer_t Timer;
+    u32 Due;            // tick of the next expiry
+    u32 Period;         // expected reload, 0 for one-shot
+    u32 Fired;          // expiries seen
+    u32 Limit;          // a periodic timer stops itself after this many expiries
+    u8  Cancelled;      // must not fire any more
+    void *Victim;       // Test_Timer_t cancelled from this callback
+} Test_Timer_t;
+
+static Test_Timer_t Global_Timers[TEST_TIMERS];
+static u32 Global_u32LastFire = 0;          // ticks elapsed from the test start at the last expiry
+static u32 Global_u32Start = 0;             // wheel tick at the test start
+static u32 Global_u32Fires = 0;
+
+static u32 Test_u32Random(void) {
+    return ((u32)rand() << 16) ^ (u32)rand();
+}
+
+static void Test_voidExpired(void *pvContext) {
+    Test_Timer_t *Local_pTest = (Test_Timer_t *)pvContext;
+    u32 Local_u32Now = STIMER_u32GetTick();
+    u32 Local_u32Elapsed = Local_u32Now - Global_u32Start;
+
+    CHECK(Local_pTest->Cancelled == FALSE, "cancelled timer %ld fired", (long)(Local_pTest - Global_Timers));
+    CHECK(Local_u32Now == Local_pTest->Due, "timer %ld fired at %u instead of %u",
+          (long)(Local_pTest - Global_Timers), Local_u32Now, Local_pTest->Due);
+    CHECK(Local_u32Elapsed >= Global_u32LastFire, "expiry out of order at %u", Local_u32Now);
+    Global_u32LastFire = Local_u32Elapsed;
+    Global_u32Fires++;
+    Local_pTest->Fired++;
+
+    if (Local_pTest->Victim != NULL) {
+        // Stop another timer, possibly one of the same batch
+        ((Test_Timer_t *)Local_pTest->Victim)->Cancelled = TRUE;
+        STIMER_voidStop(&((Test_Timer_t *)Local_pTest->Victim)->Timer);
+    }
+    if (Local_pTest->Period != 0) {
+        Local_pTest->Due += Local_pTest->Period;
+        if (Local_pTest->Fired == Local_pTest->Limit) {
+            Local_pTest->Cancelled = TRUE;
+            STIMER_voidStop(&Local_pTest->Timer);
+        }
+    }
+}
+
+/* Arms a timer and records when it must fire */
+static void Test_voidStart(Test_Timer_t *Copy_pTest, u32 Copy_u32Ticks, u32 Copy_u32Period, u32 Copy_u32Limit) {
+    Copy_pTest->Due = STIMER_u32GetTick() + ((Copy_u32Ticks != 0) ? Copy_u32Ticks : 1);
+    Copy_pTest->Period = Copy_u32Period;
+    Copy_pTest->Fired = 0;
+    Copy_pTest->Limit = Copy_u32Limit;
+    Copy_pTest->Cancelled = FALSE;
+    Copy_pTest->Victim = NULL;
+    STIMER_voidStart(&Copy_pTest->Timer, Copy_u32Ticks, Copy_u32Period, Test_voidExpired, Copy_pTest);
+}
+
+/* Restarts the wheel at a given tick with no timer armed */
+static void Test_voidReset(u32 Copy_u32Now) {
+    u32 Local_u32Idx;
+
+    STIMER_voidInit();
+    Global_u32Now = Copy_u32Now;
+    Global_u32Start = Copy_u32Now;
+    Global_u32LastFire = 0;
+    Global_u32Fires = 0;
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        Global_Timers[Local_u32Idx].Timer.PrevNext = NULL;
+        Global_Timers[Local_u32Idx].Timer.Next = NULL;
+    }
+}
+
+/* Smallest tick distance to a timer still due */
+static u32 Test_u32NextDue(void) {
+    u32 Local_u32Best = STIMER_NO_EXPIRY;
+    u32 Local_u32Idx;
+
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        if (STIMER_u8IsActive(&Global_Timers[Local_u32Idx].Timer) == TRUE) {
+            u32 Local_u32Left = Global_Timers[Local_u32Idx].Due - STIMER_u32GetTick();
+            if (Local_u32Left < Local_u32Best) {
+                Local_u32Best = Local_u32Left;
+            }
+        }
+    }
+    return Local_u32Best;
+}
+
+/* Runs interrupts of up to Copy_u32MaxPeriods periods until the wheel is
+ * empty, checking the next expiry bound before each one if asked (slow) */
+static void Test_voidRunOut(u32 Copy_u32MaxPeriods, u8 Copy_u8CheckBound) {
+    while (STIMER_u32GetTicksToNextExpiry() != STIMER_NO_EXPIRY) {
+        if (Copy_u8CheckBound == TRUE) {
+            CHECK(STIMER_u32GetTicksToNextExpiry() <= Test_u32NextDue(), "next expiry bound %u above %u",
+                  STIMER_u32GetTicksToNextExpiry(), Test_u32NextDue());
+        }
+        Host_voidInterrupt((Copy_u32MaxPeriods == 1) ? 1 : (1 + (Test_u32Random() % Copy_u32MaxPeriods)));
+    }
+    CHECK(Test_u32NextDue() == STIMER_NO_EXPIRY, "timer armed in an empty wheel");
+}
+
+/****************************************************/
+/* TESTS                                            */
+/****************************************************/
+
+static void Test_voidExpiryOrder(void) {
+    u32 Local_u32Idx;
+
+    Test_voidReset(0);
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        // Every level of the wheel: up to 64, 64^2, 64^3 and 64^4 ticks
+        Test_voidStart(&Global_Timers[Local_u32Idx], Test_u32Random() % (64UL << (6 * (Local_u32Idx % 4))), 0, 0);
+    }
+    CHECK(STIMER_u32GetTicksToNextExpiry() <= Test_u32NextDue(), "first expiry bound");
+    Test_voidRunOut(1, FALSE);
+    CHECK(Global_u32Fires == TEST_TIMERS, "%u expiries of %u", Global_u32Fires, TEST_TIMERS);
+    CHECK(STIMER_u32GetTicksToNextExpiry() == STIMER_NO_EXPIRY, "empty wheel has an expiry");
+}
+
+static void Test_voidCancel(void) {
+    u32 Local_u32Idx, Local_u32Fired = 0, Local_u32Killed = 0;
+
+    Test_voidReset(12345);
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        Test_voidStart(&Global_Timers[Local_u32Idx], Test_u32Random() % 5000, 0, 0);
+    }
+    // A third stopped now, a third of the rest stopped by the callback of another
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx += 3) {
+        Global_Timers[Local_u32Idx].Cancelled = TRUE;
+        STIMER_voidStop(&Global_Timers[Local_u32Idx].Timer);
+        CHECK(STIMER_u8IsActive(&Global_Timers[Local_u32Idx].Timer) == FALSE, "stopped timer still active");
+        STIMER_voidStop(&Global_Timers[Local_u32Idx].Timer);
+    }
+    for (Local_u32Idx = 1; (Local_u32Idx + 1) < TEST_TIMERS; Local_u32Idx += 3) {
+        Test_Timer_t *Local_pVictim = &Global_Timers[Local_u32Idx + 1];
+        // Same expiry as the victim half of the time: restarted last, the
+        // killer runs first and stops a timer of the batch being served
+        if ((Local_u32Idx & 2) != 0) {
+            Test_voidStart(&Global_Timers[Local_u32Idx], Local_pVictim->Due - STIMER_u32GetTick(), 0, 0);
+        }
+        if (Global_Timers[Local_u32Idx].Due <= Local_pVictim->Due) {
+            Global_Timers[Local_u32Idx].Victim = Local_pVictim;
+        }
+    }
+
+    Test_voidRunOut(1, FALSE);
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        const Test_Timer_t *Local_pTest = &Global_Timers[Local_u32Idx];
+        if (Local_pTest->Cancelled == FALSE) {
+            CHECK(Local_pTest->Fired == 1, "timer %u fired %u times", Local_u32Idx, Local_pTest->Fired);
+        } else if ((Local_u32Idx % 3) == 0) {
+            CHECK(Local_pTest->Fired == 0, "timer %u stopped before the run fired", Local_u32Idx);
+        } else if (Local_pTest->Fired == 0) {
+            Local_u32Killed++;
+        }
+        Local_u32Fired += Local_pTest->Fired;
+    }
+    CHECK(Global_u32Fires == Local_u32Fired, "%u expiries for %u recorded", Global_u32Fires, Local_u32Fired);
+    CHECK(Local_u32Killed != 0, "no timer stopped from a callback");
+}
+
+static void Test_voidPeriodic(void) {
+    Test_voidReset(0);
+    Test_voidStart(&Global_Timers[0], 10, 7, 100);
+    Test_voidStart(&Global_Timers[1], 1, 1, 1000);
+    Test_voidStart(&Global_Timers[2], 5000, 4096, 20);
+    Test_voidRunOut(1, FALSE);
+    CHECK((Global_Timers[0].Fired == 100) && (Global_Timers[1].Fired == 1000) && (Global_Timers[2].Fired == 20),
+          "periodic expiries %u %u %u", Global_Timers[0].Fired, Global_Timers[1].Fired, Global_Timers[2].Fired);
+}
+
+static void Test_voidBeyondWheel(void) {
+    Test_voidReset(777);
+    Test_voidStart(&Global_Timers[0], (u32)STIMER_LEVEL_SPAN(STIMER_LEVELS - 1) - 1, 0, 0);
+    Test_voidStart(&Global_Timers[1], (u32)STIMER_LEVEL_SPAN(STIMER_LEVELS - 1), 0, 0);
+    Test_voidStart(&Global_Timers[2], (u32)STIMER_LEVEL_SPAN(STIMER_LEVELS - 1) + 12345, 0, 0);
+    Test_voidStart(&Global_Timers[3], 0x80000000UL, 0, 0);
+    Test_voidStart(&Global_Timers[4], 0xFFFFFFFFUL, 0, 0);
+    Test_voidRunOut(0xFFFFFFFFUL, TRUE);
+    CHECK(Global_u32Fires == 5, "%u of 5 long timeouts", Global_u32Fires);
+}
+
+static void Test_voidWrap(void) {
+    u32 Local_u32Idx;
+
+    Test_voidReset(0xFFFFFFFFUL - 100000UL);
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        Test_voidStart(&Global_Timers[Local_u32Idx], Test_u32Random() % 300000UL, ((Local_u32Idx % 10) == 0) ? 999 : 0, 50);
+    }
+    Test_voidRunOut(1, FALSE);
+    CHECK(STIMER_u32GetTick() < 0x80000000UL, "tick did not wrap: %u", STIMER_u32GetTick());
+    CHECK(Global_u32Fires == (TEST_TIMERS + ((TEST_TIMERS / 10) * 49)), "%u expiries across the wrap", Global_u32Fires);
+}
+
+static void Test_voidTickless(void) {
+    u32 Local_u32Idx;
+
+    Test_voidReset(0xFFFFFFFFUL - 5000UL);
+    for (Local_u32Idx = 0; Local_u32Idx < TEST_TIMERS; Local_u32Idx++) {
+        Test_voidStart(&Global_Timers[Local_u32Idx], Test_u32Random() % (64UL << (6 * (Local_u32Idx % 4))),
+                       ((Local_u32Idx % 7) == 0) ? (1 + (Test_u32Random() % 3000)) : 0, 10);
+    }
+    Test_voidRunOut(700, TRUE);
+    CHECK(Global_u32Fires == (TEST_TIMERS + (((TEST_TIMERS + 6) / 7) * 9)), "%u expiries in tickless runs", Global_u32Fires);
+}
+
+int main(void) {
+    Test_voidExpiryOrder();
+    Test_voidCancel();
+    Test_voidPeriodic();
+    Test_voidBeyondWheel();
+    Test_voidWrap();
+    Test_voidTickless();
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    return (Global_u32Failures == 0) ? 0 : 1;
+}
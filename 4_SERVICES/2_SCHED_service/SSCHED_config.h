@@ -0,0 +1,14 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SSCHED_config.h                  */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SSCHED_CONFIG_H_
+#define SSCHED_CONFIG_H_
+
+/* Number of tasks (and priority levels), from 1 to 32 */
+#define SSCHED_MAX_TASKS        8
+
+#endif /* SSCHED_CONFIG_H_ */
@@ -0,0 +1,67 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SSCHED_interface.h               */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SSCHED_INTERFACE_H_
+#define SSCHED_INTERFACE_H_
+
+/**
+ * @brief Task body, runs to completion each time the task is ready.
+ * @param pvContext Context given at task creation.
+ * @param Copy_u32Events Events signaled since the previous run (never 0).
+ */
+typedef void (*SSCHED_TaskFn_t)(void *pvContext, u32 Copy_u32Events);
+
+/**
+ * @brief Run-time statistics of a task, measured with the DWT cycle counter.
+ */
+typedef struct
+{
+    u32 Runs;           /**< Number of runs */
+    u32 LastCycles;     /**< Cycles of the last run */
+    u32 MaxCycles;      /**< Longest run in cycles */
+    u64 TotalCycles;    /**< Cycles of all the runs */
+} SSCHED_TaskStats_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Creates a task. Each priority holds one task, 0 is the highest.
+ * @param Copy_u8Priority Priority from 0 to SSCHED_MAX_TASKS - 1.
+ * @param pfTask Task body.
+ * @param pvContext Context passed to the task.
+ * @return STD_OK, or STD_NOK if the priority is out of range or already used.
+ */
+u8 SSCHED_u8CreateTask(u8 Copy_u8Priority, SSCHED_TaskFn_t pfTask, void *pvContext);
+
+/**
+ * @brief Makes a task ready with a set of events. Lock-free, safe from any
+ *        interrupt and from tasks; events signaled before the task runs merge.
+ * @param Copy_u8Priority Priority of the task.
+ * @param Copy_u32Events Events to post, must not be 0.
+ */
+void SSCHED_voidSignal(u8 Copy_u8Priority, u32 Copy_u32Events);
+
+/**
+ * @brief Sets the function called to idle when no task is ready, with
+ *        interrupts disabled (e.g. STIMER_voidIdle). WFI is used if NULL.
+ * @param pfIdle Idle function.
+ */
+void SSCHED_voidSetIdleHook(void (*pfIdle)(void));
+
+/**
+ * @brief Runs the scheduler, never returns. MDWT_voidInit must be called before.
+ */
+void SSCHED_voidRun(void);
+
+/**
+ * @brief Gets the run-time statistics of a task.
+ * @param Copy_u8Priority Priority of the task.
+ * @param Copy_pStats Receives the statistics.
+ */
+void SSCHED_voidGetTaskStats(u8 Copy_u8Priority, SSCHED_TaskStats_t *Copy_pStats);
+
+#endif /* SSCHED_INTERFACE_H_ */
@@ -0,0 +1,26 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SSCHED_private.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SSCHED_PRIVATE_H_
+#define SSCHED_PRIVATE_H_
+
+/* Ready bitmap: priority 0 is bit 31 so a count of leading zeros gives the
+ * highest ready priority in one instruction */
+#define SSCHED_READY_BIT(PRIO)      (0x80000000UL >> (PRIO))
+
+/**
+ * @brief Task control block.
+ */
+typedef struct
+{
+    SSCHED_TaskFn_t     pfTask;     /**< Task body, NULL if the slot is free */
+    void               *pvContext;  /**< Task context */
+    volatile u32        Events;     /**< Events posted and not consumed yet */
+    SSCHED_TaskStats_t  Stats;      /**< Run-time statistics */
+} SSCHED_Task_t;
+
+#endif /* SSCHED_PRIVATE_H_ */
@@ -0,0 +1,124 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SSCHED_program.c                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "ATOMIC.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "NVIC_interface.h"
+#include "MDWT_interface.h"
+
+/****************************************************/
+/* SCHEDULER Directives                             */
+/****************************************************/
+#include "SSCHED_interface.h"
+#include "SSCHED_config.h"
+#include "SSCHED_private.h"
+
+#if (SSCHED_MAX_TASKS < 1) || (SSCHED_MAX_TASKS > 32)
+#error "SSCHED_MAX_TASKS must be from 1 to 32"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static SSCHED_Task_t Global_Tasks[SSCHED_MAX_TASKS];
+static volatile u32 Global_u32Ready = 0;        // Ready bitmap (SSCHED_READY_BIT)
+static void (*Global_pfIdle)(void) = NULL;      // Idle hook, WFI if NULL
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+u8 SSCHED_u8CreateTask(u8 Copy_u8Priority, SSCHED_TaskFn_t pfTask, void *pvContext) {
+    SSCHED_Task_t *Local_pTask;
+
+    if ((Copy_u8Priority >= SSCHED_MAX_TASKS) || (pfTask == NULL) || (Global_Tasks[Copy_u8Priority].pfTask != NULL)) {
+        return STD_NOK;
+    }
+
+    Local_pTask = &Global_Tasks[Copy_u8Priority];
+    Local_pTask->pvContext = pvContext;
+    Local_pTask->Events = 0;
+    Local_pTask->Stats.Runs = 0;
+    Local_pTask->Stats.LastCycles = 0;
+    Local_pTask->Stats.MaxCycles = 0;
+    Local_pTask->Stats.TotalCycles = 0;
+    Local_pTask->pfTask = pfTask;
+    return STD_OK;
+}
+
+void SSCHED_voidSignal(u8 Copy_u8Priority, u32 Copy_u32Events) {
+    if ((Copy_u8Priority < SSCHED_MAX_TASKS) && (Copy_u32Events != 0)) {
+        // Events first, so the task never becomes ready without them
+        (void)ATOMIC_u32FetchOr(&Global_Tasks[Copy_u8Priority].Events, Copy_u32Events);
+        (void)ATOMIC_u32FetchOr(&Global_u32Ready, SSCHED_READY_BIT(Copy_u8Priority));
+    }
+}
+
+void SSCHED_voidSetIdleHook(void (*pfIdle)(void)) {
+    Global_pfIdle = pfIdle;
+}
+
+void SSCHED_voidRun(void) {
+    SSCHED_Task_t *Local_pTask;
+    u32 Local_u32Ready, Local_u32Events, Local_u32Start, Local_u32Cycles;
+    u8 Local_u8Priority;
+
+    while (1) {
+        Local_u32Ready = Global_u32Ready;
+
+        if (Local_u32Ready == 0) {
+            // Check again with interrupts off: a signal arriving after this
+            // point leaves its interrupt pending, which ends the sleep
+            u32 Local_u32State = MNVIC_u32DisableInterrupts();
+            if (Global_u32Ready == 0) {
+                if (Global_pfIdle != NULL) {
+                    Global_pfIdle();
+                } else {
+                    __asm__ volatile ("dsb\n\twfi\n\tisb" : : : "memory");
+                }
+            }
+            MNVIC_voidRestoreInterrupts(Local_u32State);
+            continue;
+        }
+
+        Local_u8Priority = (u8)__builtin_clz(Local_u32Ready);
+        Local_pTask = &Global_Tasks[Local_u8Priority];
+
+        // Clear the ready bit before taking the events: a signal in between
+        // makes the task ready again instead of being lost
+        (void)ATOMIC_u32FetchAnd(&Global_u32Ready, ~SSCHED_READY_BIT(Local_u8Priority));
+        Local_u32Events = ATOMIC_u32Exchange(&Local_pTask->Events, 0);
+        if ((Local_u32Events == 0) || (Local_pTask->pfTask == NULL)) {
+            continue;
+        }
+
+        Local_u32Start = MDWT_u32GetCycles();
+        Local_pTask->pfTask(Local_pTask->pvContext, Local_u32Events);
+        Local_u32Cycles = MDWT_u32GetCycles() - Local_u32Start;
+
+        Local_pTask->Stats.Runs++;
+        Local_pTask->Stats.LastCycles = Local_u32Cycles;
+        Local_pTask->Stats.TotalCycles += Local_u32Cycles;
+        if (Local_u32Cycles > Local_pTask->Stats.MaxCycles) {
+            Local_pTask->Stats.MaxCycles = Local_u32Cycles;
+        }
+    }
+}
+
+void SSCHED_voidGetTaskStats(u8 Copy_u8Priority, SSCHED_TaskStats_t *Copy_pStats) {
+    if ((Copy_u8Priority < SSCHED_MAX_TASKS) && (Copy_pStats != NULL)) {
+        *Copy_pStats = Global_Tasks[Copy_u8Priority].Stats;
+    }
+}
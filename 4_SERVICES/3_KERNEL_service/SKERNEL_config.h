@@ -0,0 +1,30 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_config.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SKERNEL_CONFIG_H_
+#define SKERNEL_CONFIG_H_
+
+/* Number of thread priorities, from 1 to 32 (the idle thread is extra) */
+#define SKERNEL_MAX_PRIORITIES      8
+
+/* Stack of the idle thread in words */
+#define SKERNEL_IDLE_STACK_WORDS    64
+
+/*
+ * Options :-
+ *  1- SKERNEL_PORT_CM4     PendSV context switch on the Cortex-M4
+ *  2- SKERNEL_PORT_HOST    ucontext threads on a POSIX host, the idle
+ *                          thread advances the tick (simulated time)
+ */
+#ifndef SKERNEL_PORT
+#define SKERNEL_PORT                SKERNEL_PORT_CM4    // The host test defines SKERNEL_PORT_HOST
+#endif
+
+/* Stack of each thread on the host port in bytes (thread stacks are unused there) */
+#define SKERNEL_HOST_STACK_BYTES    65536
+
+#endif /* SKERNEL_CONFIG_H_ */
@@ -0,0 +1,156 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_interface.h              */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SKERNEL_INTERFACE_H_
+#define SKERNEL_INTERFACE_H_
+
+/* Timeouts, in kernel ticks */
+#define SKERNEL_NO_WAIT         0UL
+#define SKERNEL_WAIT_FOREVER    0xFFFFFFFFUL
+
+/**
+ * @brief Thread control block. Allocated by the application, fields are
+ *        managed by the kernel.
+ */
+typedef struct
+{
+    u32            *StackPtr;           /**< Saved stack pointer, must stay first */
+    void          (*pfEntry)(void *);   /**< Thread body */
+    void           *pvArg;              /**< Argument of the thread body */
+    volatile u32   *pWaitList;          /**< Wait bitmap the thread is blocked on */
+    void           *pvMessage;          /**< Message handed over by a queue */
+    u32             WakeTick;           /**< Tick of the timeout */
+    u8              Priority;           /**< Priority, 0 is the highest */
+    u8              Result;             /**< STD_OK if woken by an object, STD_NOK on timeout */
+} SKERNEL_Thread_t;
+
+/**
+ * @brief Counting semaphore.
+ */
+typedef struct
+{
+    u32          Count;      /**< Available units */
+    volatile u32 Waiters;    /**< Blocked threads (ready bitmap format) */
+} SKERNEL_Sem_t;
+
+/**
+ * @brief Message queue of pointers.
+ */
+typedef struct
+{
+    void       **Buffer;        /**< Storage, Size entries */
+    u32          Size;          /**< Capacity in messages */
+    u32          Head;          /**< Index of the oldest message */
+    u32          Count;         /**< Messages in the queue */
+    volatile u32 RecvWaiters;   /**< Threads blocked on an empty queue */
+    volatile u32 SendWaiters;   /**< Threads blocked on a full queue */
+} SKERNEL_Queue_t;
+
+/**
+ * @brief Context switch statistics, in cycles of SKERNEL_u32PortCycles.
+ */
+typedef struct
+{
+    u32 Switches;   /**< Context switches */
+    u32 Last;       /**< Cycles from the switch request to the new thread selection */
+    u32 Max;        /**< Worst case of Last */
+} SKERNEL_SwitchStats_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Creates a thread. Each priority holds one thread.
+ * @param Copy_pThread Thread control block.
+ * @param Copy_u8Priority Priority from 0 (highest) to SKERNEL_MAX_PRIORITIES - 1.
+ * @param Copy_pu32Stack Stack memory, 8-byte aligned.
+ * @param Copy_u32StackWords Stack size in words.
+ * @param pfEntry Thread body, the thread stops if it returns.
+ * @param pvArg Argument passed to the body.
+ * @return STD_OK, or STD_NOK if the priority is out of range or used.
+ */
+u8 SKERNEL_u8CreateThread(SKERNEL_Thread_t *Copy_pThread, u8 Copy_u8Priority, u32 *Copy_pu32Stack,
+                          u32 Copy_u32StackWords, void (*pfEntry)(void *), void *pvArg);
+
+/**
+ * @brief Starts the kernel with a SysTick period, never returns. MDWT_voidInit
+ *        must be called before, the switch statistics use the cycle counter.
+ * @param Copy_u32TickPeriod Kernel tick in SysTick counts.
+ */
+void SKERNEL_voidStart(u32 Copy_u32TickPeriod);
+
+/**
+ * @brief Kernel tick, subscribed to SysTick by SKERNEL_voidStart.
+ * @param pvContext Unused.
+ */
+void SKERNEL_voidTick(void *pvContext);
+
+/**
+ * @brief Gets the kernel tick count.
+ * @return Ticks since start.
+ */
+u32 SKERNEL_u32GetTicks(void);
+
+/**
+ * @brief Blocks the calling thread for a number of ticks.
+ * @param Copy_u32Ticks Ticks to wait.
+ */
+void SKERNEL_voidDelay(u32 Copy_u32Ticks);
+
+/**
+ * @brief Initializes a semaphore.
+ * @param Copy_pSem Semaphore.
+ * @param Copy_u32Count Initial count.
+ */
+void SKERNEL_voidSemInit(SKERNEL_Sem_t *Copy_pSem, u32 Copy_u32Count);
+
+/**
+ * @brief Takes a semaphore unit. Only SKERNEL_NO_WAIT may be used from an ISR.
+ * @param Copy_pSem Semaphore.
+ * @param Copy_u32Timeout Ticks to wait, SKERNEL_NO_WAIT or SKERNEL_WAIT_FOREVER.
+ * @return STD_OK, or STD_NOK on timeout.
+ */
+u8 SKERNEL_u8SemTake(SKERNEL_Sem_t *Copy_pSem, u32 Copy_u32Timeout);
+
+/**
+ * @brief Gives a semaphore unit, waking the highest priority waiter. ISR safe.
+ * @param Copy_pSem Semaphore.
+ */
+void SKERNEL_voidSemGive(SKERNEL_Sem_t *Copy_pSem);
+
+/**
+ * @brief Initializes a message queue.
+ * @param Copy_pQueue Queue.
+ * @param Copy_pBuffer Storage of Copy_u32Size messages.
+ * @param Copy_u32Size Capacity in messages.
+ */
+void SKERNEL_voidQueueInit(SKERNEL_Queue_t *Copy_pQueue, void **Copy_pBuffer, u32 Copy_u32Size);
+
+/**
+ * @brief Sends a message. Only SKERNEL_NO_WAIT may be used from an ISR.
+ * @param Copy_pQueue Queue.
+ * @param Copy_pvMessage Message.
+ * @param Copy_u32Timeout Ticks to wait while the queue is full.
+ * @return STD_OK, or STD_NOK on timeout.
+ */
+u8 SKERNEL_u8QueueSend(SKERNEL_Queue_t *Copy_pQueue, void *Copy_pvMessage, u32 Copy_u32Timeout);
+
+/**
+ * @brief Receives the oldest message. Only SKERNEL_NO_WAIT may be used from an ISR.
+ * @param Copy_pQueue Queue.
+ * @param Copy_ppvMessage Receives the message.
+ * @param Copy_u32Timeout Ticks to wait while the queue is empty.
+ * @return STD_OK, or STD_NOK on timeout.
+ */
+u8 SKERNEL_u8QueueReceive(SKERNEL_Queue_t *Copy_pQueue, void **Copy_ppvMessage, u32 Copy_u32Timeout);
+
+/**
+ * @brief Gets the context switch statistics.
+ * @param Copy_pStats Receives the statistics.
+ */
+void SKERNEL_voidGetSwitchStats(SKERNEL_SwitchStats_t *Copy_pStats);
+
+#endif /* SKERNEL_INTERFACE_H_ */
@@ -0,0 +1,256 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_port.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+
+/****************************************************/
+/* KERNEL Directives                                */
+/****************************************************/
+#include "SKERNEL_interface.h"
+#include "SKERNEL_config.h"
+#include "SKERNEL_private.h"
+
+#if SKERNEL_PORT == SKERNEL_PORT_CM4
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "CALLBACK.h"
+#include "NVIC_interface.h"
+#include "MSYSTICK_interface.h"
+#include "MDWT_interface.h"
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static u32 Global_u32BootStack[SKERNEL_BOOT_STACK_WORDS] __attribute__((aligned(8)));
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Called by PendSV with the stack of the outgoing thread.
+ * @return Stack of the incoming thread.
+ */
+static __attribute__((used)) u32 *SKERNEL_pu32PortSwitch(u32 *Copy_pu32Sp) {
+    SKERNEL_Thread_t *Local_pThread;
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+
+    Local_pThread = SKERNEL_pGetCurrentThread();
+    if (Local_pThread != NULL) {
+        Local_pThread->StackPtr = Copy_pu32Sp;
+    }
+    Local_pThread = SKERNEL_pSelectThread();
+
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return Local_pThread->StackPtr;
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+u32 SKERNEL_u32PortEnterCritical(void) {
+    return MNVIC_u32DisableInterrupts();
+}
+
+void SKERNEL_voidPortExitCritical(u32 Copy_u32State) {
+    MNVIC_voidRestoreInterrupts(Copy_u32State);
+    // Take a pended PendSV before the next instruction
+    __asm__ volatile ("isb" : : : "memory");
+}
+
+void SKERNEL_voidPortInitThread(SKERNEL_Thread_t *Copy_pThread, u32 *Copy_pu32Stack, u32 Copy_u32StackWords) {
+    u32 *Local_pu32Sp = &Copy_pu32Stack[Copy_u32StackWords & ~1UL];
+    u8 Local_u8Reg;
+
+    // Exception frame, popped by the hardware on the first return to the thread
+    *--Local_pu32Sp = SKERNEL_INITIAL_XPSR;
+    *--Local_pu32Sp = (u32)Copy_pThread->pfEntry & ~1UL;   // PC
+    *--Local_pu32Sp = (u32)SKERNEL_voidThreadExit;          // LR
+    for (Local_u8Reg = 0; Local_u8Reg < 4; Local_u8Reg++) { // R12, R3, R2, R1
+        *--Local_pu32Sp = 0;
+    }
+    *--Local_pu32Sp = (u32)Copy_pThread->pvArg;             // R0
+
+    // Frame saved by PendSV: EXC_RETURN then R11 to R4
+    *--Local_pu32Sp = SKERNEL_EXC_RETURN;
+    for (Local_u8Reg = 0; Local_u8Reg < 8; Local_u8Reg++) {
+        *--Local_pu32Sp = 0;
+    }
+
+    Copy_pThread->StackPtr = Local_pu32Sp;
+}
+
+void SKERNEL_voidPortPendSwitch(void) {
+    // ICSR set bits are write-one, no read-modify-write needed
+    SKERNEL_SCB_ICSR = (1UL << ICSR_PENDSVSET);
+    __asm__ volatile ("dsb" : : : "memory");
+}
+
+void SKERNEL_voidPortStart(u32 Copy_u32TickPeriod) {
+    (void)MNVIC_u32DisableInterrupts();
+
+    // PendSV at the lowest priority so switches never preempt an ISR
+    SKERNEL_SCB_SHPR3 |= (0xFFUL << SHPR3_PENDSV_SHIFT);
+
+    (void)SysTick_u8Subscribe(SKERNEL_voidTick, NULL);
+    SysTick_voidStartFreeRunning(Copy_u32TickPeriod);
+
+    // Move thread mode to PSP on a boot stack that takes the first PendSV
+    // save, pend the switch to the first thread and enable interrupts
+    __asm__ volatile (
+        "msr     psp, %0        \n\t"
+        "movs    r0, #2         \n\t"
+        "msr     control, r0    \n\t"
+        "isb                    \n\t"
+        "str     %2, [%1]       \n\t"
+        "dsb                    \n\t"
+        "cpsie   i              \n\t"
+        "isb                    \n\t"
+        "1: b    1b             \n\t"
+        :
+        : "r" (&Global_u32BootStack[SKERNEL_BOOT_STACK_WORDS]), "r" (&SKERNEL_SCB_ICSR),
+          "r" (1UL << ICSR_PENDSVSET)
+        : "r0", "memory");
+
+    while (1) {
+    }
+}
+
+void SKERNEL_voidPortIdle(void) {
+    __asm__ volatile ("dsb\n\twfi\n\tisb" : : : "memory");
+}
+
+u32 SKERNEL_u32PortElapsedTicks(void) {
+    return SysTick_u32GetElapsedPeriods();
+}
+
+u32 SKERNEL_u32PortCycles(void) {
+    return MDWT_u32GetCycles();
+}
+
+/****************************************************/
+/* ISR                                              */
+/****************************************************/
+
+/* Saves R4-R11 (and S16-S31 when the thread used the FPU, from EXC_RETURN
+ * bit 4) on the outgoing stack, switches, and restores the incoming one */
+void PendSV_Handler(void) __attribute__((naked));
+void PendSV_Handler(void) {
+    __asm__ volatile (
+        "mrs     r0, psp                    \n\t"
+#if defined(__VFP_FP__) && !defined(__SOFTFP__)
+        "tst     lr, #0x10                  \n\t"
+        "it      eq                         \n\t"
+        "vstmdbeq r0!, {s16-s31}            \n\t"
+#endif
+        "stmdb   r0!, {r4-r11, lr}          \n\t"
+        "bl      SKERNEL_pu32PortSwitch     \n\t"
+        "ldmia   r0!, {r4-r11, lr}          \n\t"
+#if defined(__VFP_FP__) && !defined(__SOFTFP__)
+        "tst     lr, #0x10                  \n\t"
+        "it      eq                         \n\t"
+        "vldmiaeq r0!, {s16-s31}            \n\t"
+#endif
+        "msr     psp, r0                    \n\t"
+        "isb                                \n\t"
+        "bx      lr                         \n\t");
+}
+
+#elif SKERNEL_PORT == SKERNEL_PORT_HOST
+
+#include <ucontext.h>
+#include <time.h>
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static ucontext_t Global_Contexts[SKERNEL_MAX_PRIORITIES + 1];       // Indexed by priority, idle last
+static SKERNEL_Thread_t *Global_pHostThreads[SKERNEL_MAX_PRIORITIES + 1];
+static u8 Global_u8HostStacks[SKERNEL_MAX_PRIORITIES + 1][SKERNEL_HOST_STACK_BYTES] __attribute__((aligned(16)));
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+static void SKERNEL_voidHostEntry(int Copy_intPriority) {
+    SKERNEL_Thread_t *Local_pThread = Global_pHostThreads[Copy_intPriority];
+
+    Local_pThread->pfEntry(Local_pThread->pvArg);
+    SKERNEL_voidThreadExit();
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+/* One host thread and no interrupts: nothing to mask */
+u32 SKERNEL_u32PortEnterCritical(void) {
+    return 0;
+}
+
+void SKERNEL_voidPortExitCritical(u32 Copy_u32State) {
+    (void)Copy_u32State;
+}
+
+void SKERNEL_voidPortInitThread(SKERNEL_Thread_t *Copy_pThread, u32 *Copy_pu32Stack, u32 Copy_u32StackWords) {
+    u8 Local_u8Priority = Copy_pThread->Priority;
+    ucontext_t *Local_pContext = &Global_Contexts[Local_u8Priority];
+
+    (void)Copy_u32StackWords;
+    Global_pHostThreads[Local_u8Priority] = Copy_pThread;
+    Copy_pThread->StackPtr = Copy_pu32Stack;
+
+    getcontext(Local_pContext);
+    Local_pContext->uc_stack.ss_sp = Global_u8HostStacks[Local_u8Priority];
+    Local_pContext->uc_stack.ss_size = SKERNEL_HOST_STACK_BYTES;
+    Local_pContext->uc_link = 0;
+    makecontext(Local_pContext, (void (*)(void))SKERNEL_voidHostEntry, 1, (int)Local_u8Priority);
+}
+
+/* Switches at once: the caller resumes here when it is selected again */
+void SKERNEL_voidPortPendSwitch(void) {
+    SKERNEL_Thread_t *Local_pPrevious = SKERNEL_pGetCurrentThread();
+    SKERNEL_Thread_t *Local_pNext = SKERNEL_pSelectThread();
+
+    if (Local_pNext != Local_pPrevious) {
+        swapcontext(&Global_Contexts[Local_pPrevious->Priority], &Global_Contexts[Local_pNext->Priority]);
+    }
+}
+
+void SKERNEL_voidPortStart(u32 Copy_u32TickPeriod) {
+    (void)Copy_u32TickPeriod;
+    setcontext(&Global_Contexts[SKERNEL_pSelectThread()->Priority]);
+    while (1) {
+    }
+}
+
+/* Nothing can wake a thread but time: idle advances it one tick */
+void SKERNEL_voidPortIdle(void) {
+    SKERNEL_voidTick(NULL);
+}
+
+u32 SKERNEL_u32PortElapsedTicks(void) {
+    return 1;
+}
+
+u32 SKERNEL_u32PortCycles(void) {
+    struct timespec Local_Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return (u32)((u64)Local_Time.tv_sec * 1000000000ULL + (u64)Local_Time.tv_nsec) & 0xFFFFFFFFUL;
+}
+
+#else
+#error "Wrong SKERNEL_PORT configuration"
+#endif
@@ -0,0 +1,105 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_private.h                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SKERNEL_PRIVATE_H_
+#define SKERNEL_PRIVATE_H_
+
+/* Ports */
+#define SKERNEL_PORT_CM4        1
+#define SKERNEL_PORT_HOST       2
+
+/* Priority bitmaps: priority 0 is bit 31 so a count of leading zeros gives
+ * the highest priority in one instruction */
+#define SKERNEL_PRIO_BIT(PRIO)  (0x80000000UL >> (PRIO))
+
+/* Cortex-M4 system control block */
+#define SKERNEL_SCB_ICSR        (*(volatile u32 *)0xE000ED04)
+#define SKERNEL_SCB_SHPR3       (*(volatile u32 *)0xE000ED20)
+#define ICSR_PENDSVSET          28
+#define SHPR3_PENDSV_SHIFT      16
+
+/* Initial exception frame */
+#define SKERNEL_INITIAL_XPSR    0x01000000UL    // Thumb state
+#define SKERNEL_EXC_RETURN      0xFFFFFFFDUL    // Thread mode, PSP, no FPU frame
+#define SKERNEL_BOOT_STACK_WORDS 64             // Takes the first PendSV save
+
+/****************************************************/
+/* Kernel core, for the port                        */
+/****************************************************/
+
+/**
+ * @brief Gets the running thread.
+ * @return Running thread, NULL before the first switch.
+ */
+SKERNEL_Thread_t *SKERNEL_pGetCurrentThread(void);
+
+/**
+ * @brief Makes the highest priority ready thread current. Interrupts must
+ *        be disabled.
+ * @return New running thread.
+ */
+SKERNEL_Thread_t *SKERNEL_pSelectThread(void);
+
+/**
+ * @brief Stops the calling thread when its body returns.
+ */
+void SKERNEL_voidThreadExit(void);
+
+/****************************************************/
+/* Port, for the kernel core                        */
+/****************************************************/
+
+/**
+ * @brief Disables interrupts.
+ * @return Previous state, for SKERNEL_voidPortExitCritical.
+ */
+u32 SKERNEL_u32PortEnterCritical(void);
+
+/**
+ * @brief Restores interrupts; a pended switch happens before returning.
+ * @param Copy_u32State State from SKERNEL_u32PortEnterCritical.
+ */
+void SKERNEL_voidPortExitCritical(u32 Copy_u32State);
+
+/**
+ * @brief Builds the initial context of a thread.
+ * @param Copy_pThread Thread, with pfEntry and pvArg set.
+ * @param Copy_pu32Stack Stack memory.
+ * @param Copy_u32StackWords Stack size in words.
+ */
+void SKERNEL_voidPortInitThread(SKERNEL_Thread_t *Copy_pThread, u32 *Copy_pu32Stack, u32 Copy_u32StackWords);
+
+/**
+ * @brief Requests a context switch to the thread SKERNEL_pSelectThread picks.
+ */
+void SKERNEL_voidPortPendSwitch(void);
+
+/**
+ * @brief Starts the tick and the first thread, never returns.
+ * @param Copy_u32TickPeriod Kernel tick in SysTick counts.
+ */
+void SKERNEL_voidPortStart(u32 Copy_u32TickPeriod);
+
+/**
+ * @brief Body of the idle loop, waits for the next event.
+ */
+void SKERNEL_voidPortIdle(void);
+
+/**
+ * @brief Gets the ticks the current kernel tick accounts for, more than one
+ *        when the port slept through several of them.
+ * @return Elapsed ticks.
+ */
+u32 SKERNEL_u32PortElapsedTicks(void);
+
+/**
+ * @brief Gets a free-running cycle counter for the switch statistics.
+ * @return Core cycles (DWT) on the target, nanoseconds on the host.
+ */
+u32 SKERNEL_u32PortCycles(void);
+
+#endif /* SKERNEL_PRIVATE_H_ */
@@ -0,0 +1,356 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_program.c                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+
+/****************************************************/
+/* KERNEL Directives                                */
+/****************************************************/
+#include "SKERNEL_interface.h"
+#include "SKERNEL_config.h"
+#include "SKERNEL_private.h"
+
+#if (SKERNEL_MAX_PRIORITIES < 1) || (SKERNEL_MAX_PRIORITIES > 32)
+#error "SKERNEL_MAX_PRIORITIES must be from 1 to 32"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static SKERNEL_Thread_t *Global_pThreads[SKERNEL_MAX_PRIORITIES];  // Thread of each priority
+static SKERNEL_Thread_t *volatile Global_pCurrent = NULL;          // Running thread
+static volatile u32 Global_u32Ready = 0;                           // Ready threads (SKERNEL_PRIO_BIT)
+static volatile u32 Global_u32Delayed = 0;                         // Threads with a timeout
+static volatile u32 Global_u32Ticks = 0;                           // Kernel tick count
+static u8 Global_u8Started = FALSE;
+
+static SKERNEL_Thread_t Global_IdleThread;
+static u32 Global_u32IdleStack[SKERNEL_IDLE_STACK_WORDS] __attribute__((aligned(8)));
+
+static SKERNEL_SwitchStats_t Global_SwitchStats;
+static u32 Global_u32SwitchStamp = 0;       // Cycles at the pending switch request
+static u8 Global_u8SwitchPending = FALSE;
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/**
+ * @brief Highest priority ready thread, the idle thread if none.
+ */
+static SKERNEL_Thread_t *SKERNEL_pHighestReady(void) {
+    u32 Local_u32Ready = Global_u32Ready;
+
+    if (Local_u32Ready == 0) {
+        return &Global_IdleThread;
+    }
+    return Global_pThreads[__builtin_clz(Local_u32Ready)];
+}
+
+/**
+ * @brief Pends a switch if a higher priority thread is ready or the current
+ *        one blocked. Interrupts must be disabled.
+ */
+static void SKERNEL_voidReschedule(void) {
+    if ((Global_u8Started == TRUE) && (SKERNEL_pHighestReady() != Global_pCurrent)) {
+        if (Global_u8SwitchPending == FALSE) {
+            Global_u32SwitchStamp = SKERNEL_u32PortCycles();
+            Global_u8SwitchPending = TRUE;
+        }
+        SKERNEL_voidPortPendSwitch();
+    }
+}
+
+/**
+ * @brief Makes a blocked thread ready. Interrupts must be disabled.
+ */
+static void SKERNEL_voidWake(SKERNEL_Thread_t *Copy_pThread, u8 Copy_u8Result) {
+    u32 Local_u32Bit = SKERNEL_PRIO_BIT(Copy_pThread->Priority);
+
+    if (Copy_pThread->pWaitList != NULL) {
+        *Copy_pThread->pWaitList &= ~Local_u32Bit;
+        Copy_pThread->pWaitList = NULL;
+    }
+    Global_u32Delayed &= ~Local_u32Bit;
+    Copy_pThread->Result = Copy_u8Result;
+    Global_u32Ready |= Local_u32Bit;
+}
+
+/**
+ * @brief Blocks the running thread on a wait list and/or a timeout, then
+ *        leaves the critical section, which performs the switch.
+ * @return STD_OK if woken by an object, STD_NOK on timeout.
+ */
+static u8 SKERNEL_u8Block(volatile u32 *Copy_pWaitList, u32 Copy_u32Timeout, u32 Copy_u32State) {
+    SKERNEL_Thread_t *Local_pThread = Global_pCurrent;
+    u32 Local_u32Bit = SKERNEL_PRIO_BIT(Local_pThread->Priority);
+
+    Global_u32Ready &= ~Local_u32Bit;
+    if (Copy_pWaitList != NULL) {
+        *Copy_pWaitList |= Local_u32Bit;
+        Local_pThread->pWaitList = Copy_pWaitList;
+    }
+    if (Copy_u32Timeout != SKERNEL_WAIT_FOREVER) {
+        Local_pThread->WakeTick = Global_u32Ticks + Copy_u32Timeout;
+        Global_u32Delayed |= Local_u32Bit;
+    }
+    Local_pThread->Result = STD_NOK;
+
+    SKERNEL_voidReschedule();
+    SKERNEL_voidPortExitCritical(Copy_u32State);
+
+    return Local_pThread->Result;
+}
+
+static void SKERNEL_voidIdleThread(void *pvArg) {
+    (void)pvArg;
+    while (1) {
+        SKERNEL_voidPortIdle();
+    }
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+u8 SKERNEL_u8CreateThread(SKERNEL_Thread_t *Copy_pThread, u8 Copy_u8Priority, u32 *Copy_pu32Stack,
+                          u32 Copy_u32StackWords, void (*pfEntry)(void *), void *pvArg) {
+    u32 Local_u32State;
+
+    if ((Copy_pThread == NULL) || (pfEntry == NULL) || (Copy_u8Priority >= SKERNEL_MAX_PRIORITIES) ||
+        (Global_pThreads[Copy_u8Priority] != NULL)) {
+        return STD_NOK;
+    }
+
+    Copy_pThread->pfEntry = pfEntry;
+    Copy_pThread->pvArg = pvArg;
+    Copy_pThread->pWaitList = NULL;
+    Copy_pThread->pvMessage = NULL;
+    Copy_pThread->WakeTick = 0;
+    Copy_pThread->Priority = Copy_u8Priority;
+    Copy_pThread->Result = STD_OK;
+    SKERNEL_voidPortInitThread(Copy_pThread, Copy_pu32Stack, Copy_u32StackWords);
+
+    Local_u32State = SKERNEL_u32PortEnterCritical();
+    Global_pThreads[Copy_u8Priority] = Copy_pThread;
+    Global_u32Ready |= SKERNEL_PRIO_BIT(Copy_u8Priority);
+    SKERNEL_voidReschedule();
+    SKERNEL_voidPortExitCritical(Local_u32State);
+
+    return STD_OK;
+}
+
+void SKERNEL_voidStart(u32 Copy_u32TickPeriod) {
+    Global_IdleThread.pfEntry = SKERNEL_voidIdleThread;
+    Global_IdleThread.pvArg = NULL;
+    Global_IdleThread.pWaitList = NULL;
+    Global_IdleThread.Priority = SKERNEL_MAX_PRIORITIES;
+    SKERNEL_voidPortInitThread(&Global_IdleThread, Global_u32IdleStack, SKERNEL_IDLE_STACK_WORDS);
+
+    Global_u8Started = TRUE;
+    SKERNEL_voidPortStart(Copy_u32TickPeriod);
+}
+
+void SKERNEL_voidTick(void *pvContext) {
+    SKERNEL_Thread_t *Local_pThread;
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+    u32 Local_u32Now = Global_u32Ticks + SKERNEL_u32PortElapsedTicks();
+    u32 Local_u32Delayed = Global_u32Delayed;
+    u8 Local_u8Priority;
+
+    (void)pvContext;
+    Global_u32Ticks = Local_u32Now;
+    while (Local_u32Delayed != 0) {
+        Local_u8Priority = (u8)__builtin_clz(Local_u32Delayed);
+        Local_u32Delayed &= ~SKERNEL_PRIO_BIT(Local_u8Priority);
+
+        Local_pThread = Global_pThreads[Local_u8Priority];
+        // Wrap-safe: expired once the tick reached WakeTick
+        if (((Local_u32Now - Local_pThread->WakeTick) & 0x80000000UL) == 0) {
+            SKERNEL_voidWake(Local_pThread, STD_NOK);
+        }
+    }
+
+    SKERNEL_voidReschedule();
+    SKERNEL_voidPortExitCritical(Local_u32State);
+}
+
+u32 SKERNEL_u32GetTicks(void) {
+    return Global_u32Ticks;
+}
+
+void SKERNEL_voidDelay(u32 Copy_u32Ticks) {
+    if (Copy_u32Ticks != 0) {
+        (void)SKERNEL_u8Block(NULL, Copy_u32Ticks, SKERNEL_u32PortEnterCritical());
+    }
+}
+
+void SKERNEL_voidSemInit(SKERNEL_Sem_t *Copy_pSem, u32 Copy_u32Count) {
+    Copy_pSem->Count = Copy_u32Count;
+    Copy_pSem->Waiters = 0;
+}
+
+u8 SKERNEL_u8SemTake(SKERNEL_Sem_t *Copy_pSem, u32 Copy_u32Timeout) {
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    if (Copy_pSem->Count > 0) {
+        Copy_pSem->Count--;
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_OK;
+    }
+    if (Copy_u32Timeout == SKERNEL_NO_WAIT) {
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_NOK;
+    }
+    return SKERNEL_u8Block(&Copy_pSem->Waiters, Copy_u32Timeout, Local_u32State);
+}
+
+void SKERNEL_voidSemGive(SKERNEL_Sem_t *Copy_pSem) {
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    if (Copy_pSem->Waiters != 0) {
+        // Hand the unit straight to the highest priority waiter
+        SKERNEL_voidWake(Global_pThreads[__builtin_clz(Copy_pSem->Waiters)], STD_OK);
+        SKERNEL_voidReschedule();
+    } else {
+        Copy_pSem->Count++;
+    }
+
+    SKERNEL_voidPortExitCritical(Local_u32State);
+}
+
+void SKERNEL_voidQueueInit(SKERNEL_Queue_t *Copy_pQueue, void **Copy_pBuffer, u32 Copy_u32Size) {
+    Copy_pQueue->Buffer = Copy_pBuffer;
+    Copy_pQueue->Size = (Copy_u32Size != 0) ? Copy_u32Size : 1;
+    Copy_pQueue->Head = 0;
+    Copy_pQueue->Count = 0;
+    Copy_pQueue->RecvWaiters = 0;
+    Copy_pQueue->SendWaiters = 0;
+}
+
+u8 SKERNEL_u8QueueSend(SKERNEL_Queue_t *Copy_pQueue, void *Copy_pvMessage, u32 Copy_u32Timeout) {
+    SKERNEL_Thread_t *Local_pThread;
+    u32 Local_u32Tail;
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    if (Copy_pQueue->RecvWaiters != 0) {
+        // Receivers only wait on an empty queue: hand the message over directly
+        Local_pThread = Global_pThreads[__builtin_clz(Copy_pQueue->RecvWaiters)];
+        Local_pThread->pvMessage = Copy_pvMessage;
+        SKERNEL_voidWake(Local_pThread, STD_OK);
+        SKERNEL_voidReschedule();
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_OK;
+    }
+    if (Copy_pQueue->Count < Copy_pQueue->Size) {
+        Local_u32Tail = Copy_pQueue->Head + Copy_pQueue->Count;
+        if (Local_u32Tail >= Copy_pQueue->Size) {
+            Local_u32Tail -= Copy_pQueue->Size;
+        }
+        Copy_pQueue->Buffer[Local_u32Tail] = Copy_pvMessage;
+        Copy_pQueue->Count++;
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_OK;
+    }
+    if (Copy_u32Timeout == SKERNEL_NO_WAIT) {
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_NOK;
+    }
+
+    // The receiver moves the message into the queue when space frees up
+    Global_pCurrent->pvMessage = Copy_pvMessage;
+    return SKERNEL_u8Block(&Copy_pQueue->SendWaiters, Copy_u32Timeout, Local_u32State);
+}
+
+u8 SKERNEL_u8QueueReceive(SKERNEL_Queue_t *Copy_pQueue, void **Copy_ppvMessage, u32 Copy_u32Timeout) {
+    SKERNEL_Thread_t *Local_pThread;
+    u32 Local_u32Tail;
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    if (Copy_pQueue->Count > 0) {
+        *Copy_ppvMessage = Copy_pQueue->Buffer[Copy_pQueue->Head];
+        if (++Copy_pQueue->Head == Copy_pQueue->Size) {
+            Copy_pQueue->Head = 0;
+        }
+        Copy_pQueue->Count--;
+
+        if (Copy_pQueue->SendWaiters != 0) {
+            // Refill the freed entry from the highest priority blocked sender
+            Local_pThread = Global_pThreads[__builtin_clz(Copy_pQueue->SendWaiters)];
+            Local_u32Tail = Copy_pQueue->Head + Copy_pQueue->Count;
+            if (Local_u32Tail >= Copy_pQueue->Size) {
+                Local_u32Tail -= Copy_pQueue->Size;
+            }
+            Copy_pQueue->Buffer[Local_u32Tail] = Local_pThread->pvMessage;
+            Copy_pQueue->Count++;
+            SKERNEL_voidWake(Local_pThread, STD_OK);
+            SKERNEL_voidReschedule();
+        }
+
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_OK;
+    }
+    if (Copy_u32Timeout == SKERNEL_NO_WAIT) {
+        SKERNEL_voidPortExitCritical(Local_u32State);
+        return STD_NOK;
+    }
+
+    Local_pThread = Global_pCurrent;
+    if (SKERNEL_u8Block(&Copy_pQueue->RecvWaiters, Copy_u32Timeout, Local_u32State) == STD_NOK) {
+        return STD_NOK;
+    }
+    *Copy_ppvMessage = Local_pThread->pvMessage;
+    return STD_OK;
+}
+
+void SKERNEL_voidGetSwitchStats(SKERNEL_SwitchStats_t *Copy_pStats) {
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    *Copy_pStats = Global_SwitchStats;
+    SKERNEL_voidPortExitCritical(Local_u32State);
+}
+
+/****************************************************/
+/* PORT SERVICES                                    */
+/****************************************************/
+
+SKERNEL_Thread_t *SKERNEL_pGetCurrentThread(void) {
+    return Global_pCurrent;
+}
+
+SKERNEL_Thread_t *SKERNEL_pSelectThread(void) {
+    SKERNEL_Thread_t *Local_pNext = SKERNEL_pHighestReady();
+    u32 Local_u32Cycles;
+
+    if (Local_pNext != Global_pCurrent) {
+        Global_SwitchStats.Switches++;
+    }
+    if (Global_u8SwitchPending == TRUE) {
+        Local_u32Cycles = SKERNEL_u32PortCycles() - Global_u32SwitchStamp;
+        Global_SwitchStats.Last = Local_u32Cycles;
+        if (Local_u32Cycles > Global_SwitchStats.Max) {
+            Global_SwitchStats.Max = Local_u32Cycles;
+        }
+        Global_u8SwitchPending = FALSE;
+    }
+
+    Global_pCurrent = Local_pNext;
+    return Local_pNext;
+}
+
+void SKERNEL_voidThreadExit(void) {
+    u32 Local_u32State = SKERNEL_u32PortEnterCritical();
+
+    Global_pThreads[Global_pCurrent->Priority] = NULL;
+    (void)SKERNEL_u8Block(NULL, SKERNEL_WAIT_FOREVER, Local_u32State);
+    while (1) {
+    }
+}
@@ -0,0 +1,181 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SKERNEL_test.c                   */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/* Host test of the kernel, built with the Makefile next to it.
+ *
+ * The kernel runs on its ucontext port: one host thread, switches at once
+ * when a higher priority thread gets ready, and the idle thread advancing
+ * the tick, so time only moves when every thread is blocked. Each thread
+ * logs its steps with the tick they happen at, and the lowest priority one
+ * compares the log with the expected one and exits the process. What runs:
+ * - start on the highest priority thread, preemption by a woken thread of
+ *   higher priority and none by a woken thread of lower priority;
+ * - delays ending at the exact tick;
+ * - semaphore hand-over to a waiter and a take timing out;
+ * - queue hand-over to a blocked receiver, a sender blocked on a full
+ *   queue refilled by the receiver, receive timeouts;
+ * - a thread returning from its body;
+ * - the context switch statistics, printed in nanoseconds. */
+
+#define SKERNEL_PORT    SKERNEL_PORT_HOST
+
+#include "STD_TYPES.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SKERNEL_program.c"
+#include "SKERNEL_port.c"
+
+/****************************************************/
+/* HELPERS                                          */
+/****************************************************/
+static u32 Global_u32Failures = 0;
+
+#define CHECK(COND, ...)    do { if (!(COND)) { Global_u32Failures++; printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+#define TEST_STACK_WORDS    64
+
+static char Global_Log[1024];
+static u32 Global_u32LogLength = 0;
+
+/* Appends a step and the tick it happened at */
+static void Test_voidLog(const char *Copy_pcStep) {
+    Global_u32LogLength += (u32)snprintf(&Global_Log[Global_u32LogLength], sizeof(Global_Log) - Global_u32LogLength,
+                                         "%s@%lu ", Copy_pcStep, (unsigned long)SKERNEL_u32GetTicks());
+}
+
+static SKERNEL_Thread_t Global_Threads[SKERNEL_MAX_PRIORITIES];
+static u32 Global_u32Stacks[SKERNEL_MAX_PRIORITIES][TEST_STACK_WORDS] __attribute__((aligned(8)));
+
+static SKERNEL_Sem_t Global_Sem;
+static SKERNEL_Queue_t Global_Queue;        // two entries
+static SKERNEL_Queue_t Global_Empty;        // never written
+static void *Global_QueueBuffer[2];
+static void *Global_EmptyBuffer[1];
+static u32 Global_Messages[4] = { 1, 2, 3, 4 };
+
+/****************************************************/
+/* THREADS                                          */
+/****************************************************/
+
+/* Priority 0: a delay, then a message to a blocked receiver of lower priority */
+static void Test_voidDelayer(void *pvArg) {
+    (void)pvArg;
+    Test_voidLog("A0");
+    SKERNEL_voidDelay(3);
+    Test_voidLog("A1");
+    CHECK(SKERNEL_u8QueueSend(&Global_Queue, &Global_Messages[3], SKERNEL_NO_WAIT) == STD_OK, "hand-over refused");
+    Test_voidLog("A2");     // the receiver is woken but does not preempt
+}
+
+/* Priority 1: a semaphore handed over, then a take timing out */
+static void Test_voidWaiter(void *pvArg) {
+    (void)pvArg;
+    Test_voidLog("B0");
+    CHECK(SKERNEL_u8SemTake(&Global_Sem, 5) == STD_OK, "semaphore not handed over");
+    Test_voidLog("B1");
+    CHECK(SKERNEL_u8SemTake(&Global_Sem, 5) == STD_NOK, "take did not time out");
+    Test_voidLog("B2");
+    CHECK(Global_Sem.Count == 0, "unit left in the semaphore");
+}
+
+/* Priority 2: gives to the waiter, which preempts at once */
+static void Test_voidGiver(void *pvArg) {
+    (void)pvArg;
+    Test_voidLog("C0");
+    SKERNEL_voidSemGive(&Global_Sem);
+    Test_voidLog("C1");
+    SKERNEL_voidDelay(10);
+    Test_voidLog("C2");
+}
+
+/* Priority 3: fills the queue and blocks on the third message */
+static void Test_voidProducer(void *pvArg) {
+    void *Local_pvMessage;
+
+    (void)pvArg;
+    Test_voidLog("D0");
+    CHECK(SKERNEL_u8QueueSend(&Global_Queue, &Global_Messages[0], SKERNEL_WAIT_FOREVER) == STD_OK, "send 1");
+    CHECK(SKERNEL_u8QueueSend(&Global_Queue, &Global_Messages[1], SKERNEL_WAIT_FOREVER) == STD_OK, "send 2");
+    CHECK(SKERNEL_u8QueueSend(&Global_Queue, &Global_Messages[2], SKERNEL_NO_WAIT) == STD_NOK, "send to a full queue");
+    Test_voidLog("D1");
+    CHECK(SKERNEL_u8QueueSend(&Global_Queue, &Global_Messages[2], SKERNEL_WAIT_FOREVER) == STD_OK, "send 3");
+    Test_voidLog("D2");
+    CHECK(SKERNEL_u8QueueReceive(&Global_Empty, &Local_pvMessage, 4) == STD_NOK, "receive did not time out");
+    Test_voidLog("D3");
+}
+
+/* Priority 4: drains the queue in order, times out, then gets a message handed over */
+static void Test_voidConsumer(void *pvArg) {
+    void *Local_pvMessage = NULL;
+    u32 Local_u32Idx;
+
+    (void)pvArg;
+    Test_voidLog("E0");
+    for (Local_u32Idx = 0; Local_u32Idx < 3; Local_u32Idx++) {
+        CHECK(SKERNEL_u8QueueReceive(&Global_Queue, &Local_pvMessage, SKERNEL_NO_WAIT) == STD_OK, "receive %lu",
+              (unsigned long)Local_u32Idx);
+        CHECK(Local_pvMessage == &Global_Messages[Local_u32Idx], "message %lu out of order", (unsigned long)Local_u32Idx);
+    }
+    Test_voidLog("E1");
+    CHECK(SKERNEL_u8QueueReceive(&Global_Queue, &Local_pvMessage, 2) == STD_NOK, "receive did not time out");
+    Test_voidLog("E2");
+    CHECK(SKERNEL_u8QueueReceive(&Global_Queue, &Local_pvMessage, SKERNEL_WAIT_FOREVER) == STD_OK, "no hand-over");
+    CHECK(Local_pvMessage == &Global_Messages[3], "wrong message handed over");
+    Test_voidLog("E3");
+}
+
+/* Lowest priority: runs when everything else is done or blocked, checks and exits */
+static void Test_voidChecker(void *pvArg) {
+    static const char Local_Expected[] =
+        "A0@0 B0@0 C0@0 B1@0 C1@0 D0@0 D1@0 E0@0 D2@0 E1@0 "
+        "E2@2 A1@3 A2@3 E3@3 D3@4 B2@5 C2@10 ";
+    SKERNEL_SwitchStats_t Local_Stats;
+
+    (void)pvArg;
+    SKERNEL_voidDelay(100);
+
+    CHECK(strcmp(Global_Log, Local_Expected) == 0, "\n  log      %s\n  expected %s", Global_Log, Local_Expected);
+    CHECK(SKERNEL_u32GetTicks() == 100, "checker woke at %lu", (unsigned long)SKERNEL_u32GetTicks());
+    CHECK(Global_pThreads[0] == NULL, "returned thread still registered");
+
+    SKERNEL_voidGetSwitchStats(&Local_Stats);
+    printf("context switches: %lu, request to selection: last %lu ns, max %lu ns\n",
+           (unsigned long)Local_Stats.Switches, (unsigned long)Local_Stats.Last, (unsigned long)Local_Stats.Max);
+    CHECK(Local_Stats.Switches >= 20, "%lu switches", (unsigned long)Local_Stats.Switches);
+
+    printf("%s: %lu failure(s)\n", (Global_u32Failures == 0) ? "PASS" : "FAIL", (unsigned long)Global_u32Failures);
+    exit((Global_u32Failures == 0) ? 0 : 1);
+}
+
+int main(void) {
+    static void (*const Local_Entries[])(void *) = {
+        Test_voidDelayer, Test_voidWaiter, Test_voidGiver, Test_voidProducer, Test_voidConsumer
+    };
+    u8 Local_u8Priority;
+
+    SKERNEL_voidSemInit(&Global_Sem, 0);
+    SKERNEL_voidQueueInit(&Global_Queue, Global_QueueBuffer, 2);
+    SKERNEL_voidQueueInit(&Global_Empty, Global_EmptyBuffer, 1);
+
+    for (Local_u8Priority = 0; Local_u8Priority < 5; Local_u8Priority++) {
+        CHECK(SKERNEL_u8CreateThread(&Global_Threads[Local_u8Priority], Local_u8Priority, Global_u32Stacks[Local_u8Priority],
+                                     TEST_STACK_WORDS, Local_Entries[Local_u8Priority], NULL) == STD_OK,
+              "create %u", Local_u8Priority);
+    }
+    CHECK(SKERNEL_u8CreateThread(&Global_Threads[7], SKERNEL_MAX_PRIORITIES - 1, Global_u32Stacks[7], TEST_STACK_WORDS,
+                                 Test_voidChecker, NULL) == STD_OK, "create checker");
+    CHECK(SKERNEL_u8CreateThread(&Global_Threads[6], 0, Global_u32Stacks[6], TEST_STACK_WORDS, Test_voidChecker, NULL) == STD_NOK,
+          "priority created twice");
+    CHECK(SKERNEL_u8CreateThread(&Global_Threads[6], SKERNEL_MAX_PRIORITIES, Global_u32Stacks[6], TEST_STACK_WORDS,
+                                 Test_voidChecker, NULL) == STD_NOK, "priority out of range");
+
+    SKERNEL_voidStart(1);
+    return 1;
+}
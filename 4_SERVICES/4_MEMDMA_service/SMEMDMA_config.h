@@ -0,0 +1,36 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SMEMDMA_config.h                 */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SMEMDMA_CONFIG_H_
+#define SMEMDMA_CONFIG_H_
+
+/* DMA2 stream running the copies (0 to 7). Stream 1 is shared with USART6 RX:
+ * while another driver holds it, the requests of the threshold or longer are
+ * refused (the CRC unit uses MCRC_DMA_STREAM) */
+#define SMEMDMA_STREAM              1
+
+/* Stream priority against the other DMA2 streams, MDMA_Priority_e */
+#define SMEMDMA_DMA_PRIORITY        MDMA_PRIORITY_LOW
+
+/* NVIC priority of the stream interrupt that chains the queued requests */
+#define SMEMDMA_IRQ_GROUP           2
+#define SMEMDMA_IRQ_SUBGROUP        0
+
+/* Requests shorter than this number of bytes are done by the CPU,
+ * changed at run time with SMEMDMA_voidSetThreshold.
+ * Crossover from SMEMDMA_u32MeasureCrossover: not measured on a board yet.
+ * 128 is an estimate of the length whose CPU copy costs about as much CPU
+ * time as submitting a request and taking its interrupt. Once measured,
+ * note the result here with the clock and flash wait states it was taken at,
+ * and keep the threshold at or under it. */
+#define SMEMDMA_THRESHOLD           128
+
+/* SMEMDMA_u32MeasureCrossover, needs the DWT cycle counter.
+ * Options: ENABLE or DISABLE */
+#define SMEMDMA_BENCHMARK           ENABLE
+
+#endif /* SMEMDMA_CONFIG_H_ */
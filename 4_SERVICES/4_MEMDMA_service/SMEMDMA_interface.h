@@ -0,0 +1,137 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SMEMDMA_interface.h              */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SMEMDMA_INTERFACE_H_
+#define SMEMDMA_INTERFACE_H_
+
+/*
+ * Memory copies and fills on a DMA2 memory-to-memory stream.
+ *
+ * Requests are queued in submission order; the stream interrupt starts the
+ * next one as soon as the previous one completes, so the CPU only runs the
+ * few register writes between them. Requests shorter than the threshold are
+ * done by the CPU instead: at once when the queue is empty, or in their turn
+ * from the interrupt, which keeps the order. While another driver holds the
+ * stream, the requests that need it are refused.
+ *
+ * The transfer width is the largest one the addresses and the length allow
+ * (word, halfword or byte): keep big buffers word aligned.
+ */
+
+typedef enum {
+    SMEMDMA_IDLE = 0,   // never submitted
+    SMEMDMA_QUEUED,     // waiting or in progress
+    SMEMDMA_DONE,
+    SMEMDMA_FAILED      // bus error, the destination is partly written
+} SMEMDMA_Status_e;
+
+/**
+ * @brief Request object, allocated by the user and only handled through the
+ *        SMEMDMA APIs. Zero-initialize it before its first use, and keep it
+ *        and its buffers alive until it is done.
+ */
+typedef struct SMEMDMA_Request_s
+{
+    struct SMEMDMA_Request_s *Next;     /**< Next request in the queue */
+    u8          *Dst;                   /**< Destination */
+    const u8    *Src;                   /**< Source, NULL for a fill */
+    u32          Length;                /**< Bytes to write */
+    u32          Done;                  /**< Bytes written by the finished chunks */
+    u32          Pattern;               /**< Fill byte repeated in the 4 bytes, source of a fill */
+    volatile u8  Status;                /**< SMEMDMA_Status_e */
+    CallBackFn_t pfHandler;             /**< Completion callback (CALLBACK.h), NULL for none */
+    void        *pvContext;             /**< Context passed to the callback */
+} SMEMDMA_Request_t;
+
+/* Function Prototypes */
+
+/**
+ * @brief Configures the DMA2 stream and its interrupt. While another driver
+ *        holds SMEMDMA_STREAM only the requests shorter than the threshold
+ *        are accepted; the stream is claimed again by the next longer one.
+ */
+void SMEMDMA_voidInit(void);
+
+/**
+ * @brief Queues a copy (the areas must not overlap).
+ * @param Copy_pRequest Request object, not queued.
+ * @param Copy_pvDst Destination.
+ * @param Copy_pvSrc Source.
+ * @param Copy_u32Length Bytes to copy.
+ * @param pfHandler Callback run on completion (from the stream interrupt,
+ *        or from this call if the CPU did the copy), NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK if the request is already queued, or needs the
+ *         stream while another driver holds it.
+ */
+u8 SMEMDMA_u8Copy(SMEMDMA_Request_t *Copy_pRequest, void *Copy_pvDst, const void *Copy_pvSrc,
+                  u32 Copy_u32Length, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Queues a fill.
+ * @param Copy_pRequest Request object, not queued.
+ * @param Copy_pvDst Destination.
+ * @param Copy_u8Value Byte written.
+ * @param Copy_u32Length Bytes to write.
+ * @param pfHandler Callback run on completion, NULL to poll.
+ * @param pvContext Context passed to the callback.
+ * @return STD_OK, or STD_NOK if the request is already queued, or needs the
+ *         stream while another driver holds it.
+ */
+u8 SMEMDMA_u8Fill(SMEMDMA_Request_t *Copy_pRequest, void *Copy_pvDst, u8 Copy_u8Value,
+                  u32 Copy_u32Length, CallBackFn_t pfHandler, void *pvContext);
+
+/**
+ * @brief Gets the state of a request.
+ * @param Copy_pRequest Request object.
+ * @return SMEMDMA_Status_e.
+ */
+u8 SMEMDMA_u8GetStatus(const SMEMDMA_Request_t *Copy_pRequest);
+
+/**
+ * @brief Checks whether the queue is empty.
+ * @return TRUE if no request is queued, FALSE otherwise.
+ */
+u8 SMEMDMA_u8IsIdle(void);
+
+/**
+ * @brief Sets the length under which requests are done by the CPU.
+ * @param Copy_u32Bytes Threshold in bytes, 0 to send everything to the DMA.
+ */
+void SMEMDMA_voidSetThreshold(u32 Copy_u32Bytes);
+
+/**
+ * @brief Copies with the CPU, words at a time when both areas have the same
+ *        alignment (the fallback of the short requests).
+ * @param Copy_pvDst Destination.
+ * @param Copy_pvSrc Source.
+ * @param Copy_u32Length Bytes to copy.
+ */
+void SMEMDMA_voidCpuCopy(void *Copy_pvDst, const void *Copy_pvSrc, u32 Copy_u32Length);
+
+/**
+ * @brief Fills with the CPU, words at a time.
+ * @param Copy_pvDst Destination.
+ * @param Copy_u8Value Byte written.
+ * @param Copy_u32Length Bytes to write.
+ */
+void SMEMDMA_voidCpuFill(void *Copy_pvDst, u8 Copy_u8Value, u32 Copy_u32Length);
+
+/**
+ * @brief Measures the copy length from which the DMA completes a word-aligned
+ *        request no later than the CPU copy, setup and interrupt included.
+ *        The queue must be idle and interrupts enabled; MDWT_voidInit must
+ *        have been called. Only built with SMEMDMA_BENCHMARK enabled.
+ *        The DMA frees the CPU well below that length: the result is an upper
+ *        bound for SMEMDMA_voidSetThreshold when the CPU must wait anyway.
+ * @param Copy_pu32Scratch Word-aligned scratch area, split in source and destination.
+ * @param Copy_u32Bytes Size of the scratch area.
+ * @return The crossover length in bytes, 0xFFFFFFFF if the CPU wins up to half the scratch.
+ */
+u32 SMEMDMA_u32MeasureCrossover(u32 *Copy_pu32Scratch, u32 Copy_u32Bytes);
+
+#endif /* SMEMDMA_INTERFACE_H_ */
@@ -0,0 +1,30 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SMEMDMA_private.h                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+#ifndef SMEMDMA_PRIVATE_H_
+#define SMEMDMA_PRIVATE_H_
+
+#define ENABLE              1
+#define DISABLE             2
+
+/* Operation of a request */
+#define SMEMDMA_OP_COPY     0
+#define SMEMDMA_OP_FILL     1
+
+/* Stream configuration not applied yet */
+#define SMEMDMA_NO_CONFIG   0xFFU
+
+/* Largest transfer of a stream, in items */
+#define SMEMDMA_MAX_ITEMS   0xFFFFUL
+
+/* Benchmark sizes, doubled from the first one */
+#define SMEMDMA_BENCH_FIRST 8UL
+
+/* Returned by the benchmark when the CPU always wins */
+#define SMEMDMA_NO_CROSSOVER    0xFFFFFFFFUL
+
+#endif /* SMEMDMA_PRIVATE_H_ */
@@ -0,0 +1,496 @@
+/****************************************************/
+/*   AUTHOR      : Abdullah Ahmed                   */
+/*   Description : SMEMDMA_program.c                */
+/*   DATE        : 19 OCT 2026                      */
+/*   VERSION     : V01                              */
+/****************************************************/
+
+/****************************************************/
+/* Library Directives                               */
+/****************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "CALLBACK.h"
+
+/****************************************************/
+/* MCAL Directives                                  */
+/****************************************************/
+#include "NVIC_interface.h"
+#include "MDMA_interface.h"
+#include "MDWT_interface.h"
+
+/****************************************************/
+/* SMEMDMA Directives                               */
+/****************************************************/
+#include "SMEMDMA_interface.h"
+#include "SMEMDMA_config.h"
+#include "SMEMDMA_private.h"
+
+#if (SMEMDMA_STREAM < 0) || (SMEMDMA_STREAM > 7)
+#error "SMEMDMA_STREAM must be from 0 to 7"
+#endif
+
+/****************************************************/
+/* GLOBAL VARIABLES                                 */
+/****************************************************/
+static SMEMDMA_Request_t *Global_pHead = NULL;      // Request on the stream (or next to run), oldest first
+static SMEMDMA_Request_t *Global_pTail = NULL;      // Last queued request
+static u8  Global_u8Busy = FALSE;                   // TRUE while the head request runs on the stream
+static u32 Global_u32ChunkBytes = 0;                // Bytes of the chunk on the stream
+static u8  Global_u8Config = SMEMDMA_NO_CONFIG;     // Configuration applied to the stream (size << 1 | fill)
+static volatile u32 Global_u32Threshold = SMEMDMA_THRESHOLD;
+
+/****************************************************/
+/* PRIVATE FUNCTIONS                                */
+/****************************************************/
+
+/* Stream callbacks, set by SMEMDMA_u8Configure once the stream is claimed */
+static void SMEMDMA_voidOnFull(void *pvContext);
+static void SMEMDMA_voidOnError(void *pvContext);
+
+/**
+ * @brief Reconfigures the stream when the width or the operation changes.
+ *
+ * @return u8: STD_OK, or STD_NOK while another driver holds the stream.
+ */
+static u8 SMEMDMA_u8Configure(u8 Copy_u8Size, u8 Copy_u8Op)
+{
+    u8 Local_u8Config = (u8)((Copy_u8Size << 1) | Copy_u8Op);
+    MDMA_StreamConfig_t Local_Config = {
+        .Channel = 0, .Direction = MDMA_MEM_TO_MEM, .Priority = SMEMDMA_DMA_PRIORITY,
+        .PeriphSize = Copy_u8Size, .MemSize = Copy_u8Size,
+        .PeriphInc = (Copy_u8Op == SMEMDMA_OP_COPY) ? TRUE : FALSE, .MemInc = TRUE,
+        .Mode = MDMA_MODE_NORMAL, .Fifo = MDMA_FIFO_FULL,
+        .PeriphBurst = MDMA_BURST_SINGLE, .MemBurst = MDMA_BURST_SINGLE,
+        .Interrupts = MDMA_IT_FULL | MDMA_IT_ERROR,
+        .IrqGroup = SMEMDMA_IRQ_GROUP, .IrqSubGroup = SMEMDMA_IRQ_SUBGROUP,
+        .Owner = &Global_pHead
+    };
+
+    if (Local_u8Config != Global_u8Config)
+    {
+        if (MDMA_u8Init(MDMA_DMA2, SMEMDMA_STREAM, &Local_Config) == STD_NOK)
+        {
+            return STD_NOK;
+        }
+        MDMA_voidSetCallback(MDMA_DMA2, SMEMDMA_STREAM, MDMA_EVENT_FULL, SMEMDMA_voidOnFull, NULL);
+        MDMA_voidSetCallback(MDMA_DMA2, SMEMDMA_STREAM, MDMA_EVENT_ERROR, SMEMDMA_voidOnError, NULL);
+        Global_u8Config = Local_u8Config;
+    }
+    return STD_OK;
+}
+
+/**
+ * @brief Starts the next chunk of a request on the stream.
+ *
+ * The width follows the alignment of the addresses; the 1 to 3 bytes left
+ * under one item (the tail of an odd length) are written by the CPU.
+ *
+ * @return u8: SMEMDMA_QUEUED if a chunk is started, SMEMDMA_DONE if the
+ *             request is finished, SMEMDMA_FAILED if the stream was lost.
+ */
+static u8 SMEMDMA_u8StartChunk(SMEMDMA_Request_t *Copy_pRequest)
+{
+    u8 *Local_pu8Dst = Copy_pRequest->Dst + Copy_pRequest->Done;
+    const u8 *Local_pu8Src = (Copy_pRequest->Src != NULL) ? (Copy_pRequest->Src + Copy_pRequest->Done)
+                                                          : (const u8 *)&Copy_pRequest->Pattern;
+    u32 Local_u32Left = Copy_pRequest->Length - Copy_pRequest->Done;
+    u32 Local_u32Align = (u32)Local_pu8Dst | (u32)Local_pu8Src;
+    u32 Local_u32Items;
+    u8 Local_u8Size;
+
+    Local_u8Size = ((Local_u32Align & 3UL) == 0) ? MDMA_SIZE_WORD
+                 : (((Local_u32Align & 1UL) == 0) ? MDMA_SIZE_HALFWORD : MDMA_SIZE_BYTE);
+    Local_u32Items = Local_u32Left >> Local_u8Size;
+    if (Local_u32Items == 0)
+    {
+        // Tail under one item
+        if (Copy_pRequest->Src != NULL)
+        {
+            SMEMDMA_voidCpuCopy(Local_pu8Dst, Local_pu8Src, Local_u32Left);
+        }
+        else
+        {
+            SMEMDMA_voidCpuFill(Local_pu8Dst, (u8)Copy_pRequest->Pattern, Local_u32Left);
+        }
+        Copy_pRequest->Done = Copy_pRequest->Length;
+        return SMEMDMA_DONE;
+    }
+    if (SMEMDMA_u8Configure(Local_u8Size, (Copy_pRequest->Src != NULL) ? SMEMDMA_OP_COPY : SMEMDMA_OP_FILL) == STD_NOK)
+    {
+        return SMEMDMA_FAILED;
+    }
+    if (Local_u32Items > SMEMDMA_MAX_ITEMS)
+    {
+        Local_u32Items = SMEMDMA_MAX_ITEMS;
+    }
+
+    Global_u32ChunkBytes = Local_u32Items << Local_u8Size;
+    MDMA_u8Start(MDMA_DMA2, SMEMDMA_STREAM, (u32)Local_pu8Src, (u32)Local_pu8Dst, 0, (u16)Local_u32Items);
+    return SMEMDMA_QUEUED;
+}
+
+/**
+ * @brief Removes the head request and reports its result.
+ */
+static void SMEMDMA_voidComplete(u8 Copy_u8Status)
+{
+    SMEMDMA_Request_t *Local_pRequest = Global_pHead;
+
+    Global_pHead = Local_pRequest->Next;
+    if (Global_pHead == NULL)
+    {
+        Global_pTail = NULL;
+    }
+    Local_pRequest->Status = Copy_u8Status;
+    if (Local_pRequest->pfHandler != NULL)
+    {
+        Local_pRequest->pfHandler(Local_pRequest->pvContext);
+    }
+}
+
+/**
+ * @brief Runs the queue until a request is on the stream or the queue is empty.
+ *        Short requests are done by the CPU in their turn.
+ *        Interrupts must be disabled or the caller must be the stream interrupt.
+ */
+static void SMEMDMA_voidRunQueue(void)
+{
+    SMEMDMA_Request_t *Local_pRequest;
+    u8 Local_u8Status;
+
+    while ((Global_pHead != NULL) && (Global_u8Busy == FALSE))
+    {
+        Local_pRequest = Global_pHead;
+        if (Local_pRequest->Length < Global_u32Threshold)
+        {
+            Local_pRequest->Done = Local_pRequest->Length;
+            if (Local_pRequest->Src != NULL)
+            {
+                SMEMDMA_voidCpuCopy(Local_pRequest->Dst, Local_pRequest->Src, Local_pRequest->Length);
+            }
+            else
+            {
+                SMEMDMA_voidCpuFill(Local_pRequest->Dst, (u8)Local_pRequest->Pattern, Local_pRequest->Length);
+            }
+            SMEMDMA_voidComplete(SMEMDMA_DONE);
+        }
+        else
+        {
+            Local_u8Status = SMEMDMA_u8StartChunk(Local_pRequest);
+            if (Local_u8Status == SMEMDMA_QUEUED)
+            {
+                Global_u8Busy = TRUE;
+            }
+            else
+            {
+                SMEMDMA_voidComplete(Local_u8Status);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Stream transfer complete: next chunk, or next request.
+ */
+static void SMEMDMA_voidOnFull(void *pvContext)
+{
+    SMEMDMA_Request_t *Local_pRequest = Global_pHead;
+    u8 Local_u8Status = SMEMDMA_DONE;
+
+    (void)pvContext;
+    Local_pRequest->Done += Global_u32ChunkBytes;
+    if (Local_pRequest->Done < Local_pRequest->Length)
+    {
+        Local_u8Status = SMEMDMA_u8StartChunk(Local_pRequest);
+        if (Local_u8Status == SMEMDMA_QUEUED)
+        {
+            return;
+        }
+    }
+    Global_u8Busy = FALSE;
+    SMEMDMA_voidComplete(Local_u8Status);
+    SMEMDMA_voidRunQueue();
+}
+
+/**
+ * @brief Stream bus error: the stream is disabled, drop the request.
+ */
+static void SMEMDMA_voidOnError(void *pvContext)
+{
+    (void)pvContext;
+    Global_u8Busy = FALSE;
+    SMEMDMA_voidComplete(SMEMDMA_FAILED);
+    SMEMDMA_voidRunQueue();
+}
+
+/**
+ * @brief Queues a filled-in request, or does it at once on the CPU if it is
+ *        short and nothing is queued before it.
+ *
+ * A request for the stream is refused while another driver holds it, rather
+ * than copied by the CPU with interrupts disabled. The CPU copies made here
+ * run after the critical section: from it, only a DMA start is made, since
+ * a request under one word never reaches the queue when it is empty.
+ */
+static u8 SMEMDMA_u8Submit(SMEMDMA_Request_t *Copy_pRequest)
+{
+    u32 Local_u32State = MNVIC_u32DisableInterrupts();
+
+    if ((Copy_pRequest->Status == SMEMDMA_QUEUED)
+        || ((Copy_pRequest->Length >= Global_u32Threshold) && (Global_u8Config == SMEMDMA_NO_CONFIG)
+            && (SMEMDMA_u8Configure(MDMA_SIZE_WORD, SMEMDMA_OP_COPY) == STD_NOK)))
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        return STD_NOK;
+    }
+    Copy_pRequest->Status = SMEMDMA_QUEUED;
+    Copy_pRequest->Done = 0;
+    Copy_pRequest->Next = NULL;
+
+    if ((Global_pHead == NULL) && ((Copy_pRequest->Length < Global_u32Threshold) || (Copy_pRequest->Length < 4)))
+    {
+        MNVIC_voidRestoreInterrupts(Local_u32State);
+        if (Copy_pRequest->Src != NULL)
+        {
+            SMEMDMA_voidCpuCopy(Copy_pRequest->Dst, Copy_pRequest->Src, Copy_pRequest->Length);
+        }
+        else
+        {
+            SMEMDMA_voidCpuFill(Copy_pRequest->Dst, (u8)Copy_pRequest->Pattern, Copy_pRequest->Length);
+        }
+        Copy_pRequest->Done = Copy_pRequest->Length;
+        Copy_pRequest->Status = SMEMDMA_DONE;
+        if (Copy_pRequest->pfHandler != NULL)
+        {
+            Copy_pRequest->pfHandler(Copy_pRequest->pvContext);
+        }
+        return STD_OK;
+    }
+
+    if (Global_pTail != NULL)
+    {
+        Global_pTail->Next = Copy_pRequest;
+    }
+    else
+    {
+        Global_pHead = Copy_pRequest;
+    }
+    Global_pTail = Copy_pRequest;
+    SMEMDMA_voidRunQueue();
+    MNVIC_voidRestoreInterrupts(Local_u32State);
+    return STD_OK;
+}
+
+/****************************************************/
+/* FUNCTION DEFINITIONS                             */
+/****************************************************/
+
+void SMEMDMA_voidInit(void)
+{
+    Global_pHead = NULL;
+    Global_pTail = NULL;
+    Global_u8Busy = FALSE;
+    Global_u8Config = SMEMDMA_NO_CONFIG;
+    (void)SMEMDMA_u8Configure(MDMA_SIZE_WORD, SMEMDMA_OP_COPY);
+}
+
+u8 SMEMDMA_u8Copy(SMEMDMA_Request_t *Copy_pRequest, void *Copy_pvDst, const void *Copy_pvSrc,
+                  u32 Copy_u32Length, CallBackFn_t pfHandler, void *pvContext)
+{
+    if (Copy_pRequest->Status == SMEMDMA_QUEUED)
+    {
+        return STD_NOK;
+    }
+    Copy_pRequest->Dst = (u8 *)Copy_pvDst;
+    Copy_pRequest->Src = (const u8 *)Copy_pvSrc;
+    Copy_pRequest->Length = Copy_u32Length;
+    Copy_pRequest->pfHandler = pfHandler;
+    Copy_pRequest->pvContext = pvContext;
+    return SMEMDMA_u8Submit(Copy_pRequest);
+}
+
+u8 SMEMDMA_u8Fill(SMEMDMA_Request_t *Copy_pRequest, void *Copy_pvDst, u8 Copy_u8Value,
+                  u32 Copy_u32Length, CallBackFn_t pfHandler, void *pvContext)
+{
+    if (Copy_pRequest->Status == SMEMDMA_QUEUED)
+    {
+        return STD_NOK;
+    }
+    Copy_pRequest->Dst = (u8 *)Copy_pvDst;
+    Copy_pRequest->Src = NULL;
+    Copy_pRequest->Pattern = (u32)Copy_u8Value * 0x01010101UL;
+    Copy_pRequest->Length = Copy_u32Length;
+    Copy_pRequest->pfHandler = pfHandler;
+    Copy_pRequest->pvContext = pvContext;
+    return SMEMDMA_u8Submit(Copy_pRequest);
+}
+
+u8 SMEMDMA_u8GetStatus(const SMEMDMA_Request_t *Copy_pRequest)
+{
+    return Copy_pRequest->Status;
+}
+
+u8 SMEMDMA_u8IsIdle(void)
+{
+    return (Global_pHead == NULL) ? TRUE : FALSE;
+}
+
+void SMEMDMA_voidSetThreshold(u32 Copy_u32Bytes)
+{
+    Global_u32Threshold = Copy_u32Bytes;
+}
+
+void SMEMDMA_voidCpuCopy(void *Copy_pvDst, const void *Copy_pvSrc, u32 Copy_u32Length)
+{
+    u8 *Local_pu8Dst = (u8 *)Copy_pvDst;
+    const u8 *Local_pu8Src = (const u8 *)Copy_pvSrc;
+    u32 *Local_pu32Dst;
+    const u32 *Local_pu32Src;
+
+    if ((((u32)Local_pu8Dst ^ (u32)Local_pu8Src) & 3UL) == 0)
+    {
+        while (((((u32)Local_pu8Dst) & 3UL) != 0) && (Copy_u32Length != 0))
+        {
+            *Local_pu8Dst++ = *Local_pu8Src++;
+            Copy_u32Length--;
+        }
+
+        Local_pu32Dst = (u32 *)Local_pu8Dst;
+        Local_pu32Src = (const u32 *)Local_pu8Src;
+        while (Copy_u32Length >= 16)
+        {
+            // 4 words per pass: the loads pipeline back to back
+            Local_pu32Dst[0] = Local_pu32Src[0];
+            Local_pu32Dst[1] = Local_pu32Src[1];
+            Local_pu32Dst[2] = Local_pu32Src[2];
+            Local_pu32Dst[3] = Local_pu32Src[3];
+            Local_pu32Dst += 4;
+            Local_pu32Src += 4;
+            Copy_u32Length -= 16;
+        }
+        while (Copy_u32Length >= 4)
+        {
+            *Local_pu32Dst++ = *Local_pu32Src++;
+            Copy_u32Length -= 4;
+        }
+        Local_pu8Dst = (u8 *)Local_pu32Dst;
+        Local_pu8Src = (const u8 *)Local_pu32Src;
+    }
+
+    while (Copy_u32Length-- != 0)
+    {
+        *Local_pu8Dst++ = *Local_pu8Src++;
+    }
+}
+
+void SMEMDMA_voidCpuFill(void *Copy_pvDst, u8 Copy_u8Value, u32 Copy_u32Length)
+{
+    u8 *Local_pu8Dst = (u8 *)Copy_pvDst;
+    u32 Local_u32Pattern = (u32)Copy_u8Value * 0x01010101UL;
+    u32 *Local_pu32Dst;
+
+    while (((((u32)Local_pu8Dst) & 3UL) != 0) && (Copy_u32Length != 0))
+    {
+        *Local_pu8Dst++ = Copy_u8Value;
+        Copy_u32Length--;
+    }
+
+    Local_pu32Dst = (u32 *)Local_pu8Dst;
+    while (Copy_u32Length >= 16)
+    {
+        Local_pu32Dst[0] = Local_u32Pattern;
+        Local_pu32Dst[1] = Local_u32Pattern;
+        Local_pu32Dst[2] = Local_u32Pattern;
+        Local_pu32Dst[3] = Local_u32Pattern;
+        Local_pu32Dst += 4;
+        Copy_u32Length -= 16;
+    }
+    while (Copy_u32Length >= 4)
+    {
+        *Local_pu32Dst++ = Local_u32Pattern;
+        Copy_u32Length -= 4;
+    }
+
+    Local_pu8Dst = (u8 *)Local_pu32Dst;
+    while (Copy_u32Length-- != 0)
+    {
+        *Local_pu8Dst++ = Copy_u8Value;
+    }
+}
+
+#if SMEMDMA_BENCHMARK == ENABLE
+/**
+ * @brief Times one copy of a length on the CPU and on the DMA.
+ * @return u8: TRUE if the DMA request completes no later than the CPU copy.
+ */
+static u8 SMEMDMA_u8DmaWins(u32 *Copy_pu32Dst, const u32 *Copy_pu32Src, u32 Copy_u32Bytes)
+{
+    SMEMDMA_Request_t Local_Request = {0};
+    u32 Local_u32Start;
+    u32 Local_u32Cpu;
+    u32 Local_u32Dma;
+
+    Local_u32Start = MDWT_u32GetCycles();
+    SMEMDMA_voidCpuCopy(Copy_pu32Dst, Copy_pu32Src, Copy_u32Bytes);
+    Local_u32Cpu = MDWT_u32GetCycles() - Local_u32Start;
+
+    Local_u32Start = MDWT_u32GetCycles();
+    if (SMEMDMA_u8Copy(&Local_Request, Copy_pu32Dst, Copy_pu32Src, Copy_u32Bytes, NULL, NULL) != STD_OK)
+    {
+        return FALSE;
+    }
+    while (Local_Request.Status == SMEMDMA_QUEUED);
+    Local_u32Dma = MDWT_u32GetCycles() - Local_u32Start;
+
+    return (Local_u32Dma <= Local_u32Cpu) ? TRUE : FALSE;
+}
+
+u32 SMEMDMA_u32MeasureCrossover(u32 *Copy_pu32Scratch, u32 Copy_u32Bytes)
+{
+    u32 Local_u32Half = (Copy_u32Bytes / 2) & ~3UL;
+    u32 *Local_pu32Dst = Copy_pu32Scratch + (Local_u32Half / 4);
+    u32 Local_u32Saved = Global_u32Threshold;
+    u32 Local_u32Low = 0;
+    u32 Local_u32High = SMEMDMA_NO_CROSSOVER;
+    u32 Local_u32Size;
+
+    if ((Global_pHead != NULL) || (Local_u32Half < SMEMDMA_BENCH_FIRST))
+    {
+        return SMEMDMA_NO_CROSSOVER;
+    }
+    Global_u32Threshold = 0;
+
+    // Warm up: the first request applies the word copy configuration
+    SMEMDMA_u8DmaWins(Local_pu32Dst, Copy_pu32Scratch, SMEMDMA_BENCH_FIRST);
+
+    // Double the length until the DMA wins, then bisect in words
+    for (Local_u32Size = SMEMDMA_BENCH_FIRST; Local_u32Size <= Local_u32Half; Local_u32Size <<= 1)
+    {
+        if (SMEMDMA_u8DmaWins(Local_pu32Dst, Copy_pu32Scratch, Local_u32Size) == TRUE)
+        {
+            Local_u32High = Local_u32Size;
+            break;
+        }
+        Local_u32Low = Local_u32Size;
+    }
+    if (Local_u32High != SMEMDMA_NO_CROSSOVER)
+    {
+        while ((Local_u32High - Local_u32Low) > 4)
+        {
+            Local_u32Size = ((Local_u32Low + Local_u32High) / 2) & ~3UL;
+            if (SMEMDMA_u8DmaWins(Local_pu32Dst, Copy_pu32Scratch, Local_u32Size) == TRUE)
+            {
+                Local_u32High = Local_u32Size;
+            }
+            else
+            {
+                Local_u32Low = Local_u32Size;
+            }
+        }
+    }
+
+    Global_u32Threshold = Local_u32Saved;
+    return Local_u32High;
+}
+#endif